@@ -0,0 +1,157 @@
+/**
+ * @file benchmark.hxx
+ * @brief Benchmark harness: warmup and repetitions of a stage, percentiles
+ * of its run times, throughput and peak memory, reported to `io::json`.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sys/resource.h>
+
+#include <gunrock/io/json.hxx>
+
+namespace benchmark {
+
+/**
+ * @brief Runs of every stage: `warmup` untimed, then `repetitions` timed.
+ */
+struct options_t {
+  int warmup{1};
+  int repetitions{5};
+  options_t() = default;
+};
+
+/**
+ * @brief Peak resident set size of the process so far, in bytes.
+ */
+inline std::size_t get_peak_rss() {
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return (std::size_t)usage.ru_maxrss * 1024;  // Linux: kilobytes.
+}
+
+/**
+ * @brief Timed runs of a stage.
+ */
+struct stage_t {
+  std::string name;
+  std::vector<double> times;  // milliseconds, one per repetition.
+  double edges{0};            // edges processed by a run.
+  std::size_t peak_rss{0};    // bytes, after the stage.
+
+  /**
+   * @brief Nearest-rank percentile `p` (in [0, 100]) of the run times.
+   */
+  double percentile(double p) const {
+    if (times.empty())
+      return 0;
+    std::vector<double> sorted(times);
+    std::sort(sorted.begin(), sorted.end());
+    std::size_t rank = (std::size_t)std::ceil(p / 100 * sorted.size());
+    return sorted[std::min(std::max<std::size_t>(rank, 1), sorted.size()) -
+                  1];
+  }
+
+  double mean() const {
+    double sum = 0;
+    for (auto t : times)
+      sum += t;
+    return times.empty() ? 0 : sum / times.size();
+  }
+
+  double standard_deviation() const {
+    double average = mean();
+    double accum = 0;
+    for (auto t : times)
+      accum += (t - average) * (t - average);
+    return times.empty() ? 0 : std::sqrt(accum / times.size());
+  }
+
+  /**
+   * @brief Millions of edges processed per second, at the median time
+   * (traversed edges for traversals, TEPS).
+   */
+  double mteps() const {
+    double median = percentile(50);
+    return (median > 0) ? edges / (median * 1e3) : 0;
+  }
+
+  void print() const {
+    std::cout << std::left << std::setw(24) << name << std::right
+              << std::fixed << std::setprecision(3)
+              << " p50 = " << std::setw(10) << percentile(50)
+              << " p90 = " << std::setw(10) << percentile(90)
+              << " p99 = " << std::setw(10) << percentile(99) << " (ms)"
+              << " MTEPS = " << std::setw(10) << mteps()
+              << " peak RSS = " << std::setw(8) << peak_rss / (1 << 20)
+              << " (MB)" << std::defaultfloat << std::endl;
+  }
+
+  /**
+   * @brief Append the stage to the "stages" array of `json`.
+   */
+  void write(gunrock::io::json& json) const {
+    auto stage = json.new_object();
+    json.set_val("name", name, stage);
+    json.set_val("repetitions", (int)times.size(), stage);
+    json.set_array("times_ms", times, stage);
+    json.set_val("min_ms", percentile(0), stage);
+    json.set_val("p50_ms", percentile(50), stage);
+    json.set_val("p90_ms", percentile(90), stage);
+    json.set_val("p99_ms", percentile(99), stage);
+    json.set_val("max_ms", percentile(100), stage);
+    json.set_val("mean_ms", mean(), stage);
+    json.set_val("stddev_ms", standard_deviation(), stage);
+    json.set_val("edges", edges, stage);
+    json.set_val("mteps", mteps(), stage);
+    json.set_val("peak_rss_bytes", (unsigned long)peak_rss, stage);
+    json.append_object("stages", stage);
+  }
+};
+
+/**
+ * @brief Run a stage `options.warmup` times, then time it
+ * `options.repetitions` times (wall clock, including the stage's own
+ * allocations).
+ *
+ * @param name name of the stage.
+ * @param options see `options_t`.
+ * @param op the stage, returns the number of edges it processed.
+ * @return stage_t run times, edges of the last run and peak memory.
+ */
+template <typename operator_t>
+stage_t run(std::string name, options_t const& options, operator_t op) {
+  using clock_t = std::chrono::high_resolution_clock;
+
+  stage_t stage;
+  stage.name = name;
+  for (int i = 0; i < options.warmup; ++i)
+    stage.edges = op();
+
+  for (int i = 0; i < options.repetitions; ++i) {
+    auto begin = clock_t::now();
+    stage.edges = op();
+    auto end = clock_t::now();
+    stage.times.push_back(
+        std::chrono::duration<double, std::milli>(end - begin).count());
+  }
+
+  stage.peak_rss = get_peak_rss();
+  stage.print();
+  return stage;
+}
+
+}  // namespace benchmark
@@ -0,0 +1,236 @@
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/applications/application.hxx>
+#include <gunrock/applications/color.hxx>
+#include <gunrock/applications/pr.hxx>
+#include <gunrock/applications/cpu/bfs.hxx>
+#include <gunrock/applications/cpu/color.hxx>
+#include <gunrock/applications/cpu/pr.hxx>
+#include <gunrock/applications/cpu/sssp.hxx>
+#include <gunrock/io/json.hxx>
+
+#include "benchmark.hxx"
+
+using namespace gunrock;
+using namespace memory;
+
+void benchmarks(int num_arguments, char** argument_array) {
+  std::string usage =
+      "usage: ./benchmarks filename.mtx [--warmup n] [--repetitions n] "
+      "[--source v] [--json filename.json]";
+  if (num_arguments < 2) {
+    std::cerr << usage << std::endl;
+    exit(1);
+  }
+
+  // --
+  // Define types
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  using csc_t = format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+
+  // --
+  // Options
+
+  std::string filename = argument_array[1];
+  std::string json_filename = "benchmarks.json";
+  benchmark::options_t options;
+  vertex_t single_source = 0;
+
+  for (int i = 2; i < num_arguments; i += 2) {
+    std::string option = argument_array[i];
+    if (i + 1 >= num_arguments) {
+      std::cerr << usage << std::endl;
+      exit(1);
+    }
+    std::string value = argument_array[i + 1];
+    if (option == "--warmup")
+      options.warmup = std::stoi(value);
+    else if (option == "--repetitions")
+      options.repetitions = std::stoi(value);
+    else if (option == "--source")
+      single_source = std::stoi(value);
+    else if (option == "--json")
+      json_filename = value;
+    else {
+      std::cerr << usage << std::endl;
+      exit(1);
+    }
+  }
+
+  io::json json("benchmarks", json_filename);
+  std::vector<benchmark::stage_t> stages;
+
+  // --
+  // IO and formats
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t> coo;
+  stages.push_back(benchmark::run("load (matrix market)", options, [&]() {
+    coo = mm.load(filename);
+    return (double)coo.number_of_nonzeros;
+  }));
+
+  csr_t csr;
+  csc_t csc;
+  stages.push_back(benchmark::run("from_coo (csr + csc)", options, [&]() {
+    format::from_coo(coo, csr, csc);
+    return (double)csr.number_of_nonzeros;
+  }));
+
+  std::string binary_filename =
+      (std::filesystem::temp_directory_path() / "essentials_benchmarks.csr")
+          .string();
+  stages.push_back(benchmark::run("binary csr (write)", options, [&]() {
+    csr.write_binary(binary_filename);
+    return (double)csr.number_of_nonzeros;
+  }));
+
+  stages.push_back(benchmark::run("binary csr (read)", options, [&]() {
+    csr_t binary;
+    binary.read_binary(binary_filename);
+    return (double)binary.number_of_nonzeros;
+  }));
+  std::remove(binary_filename.c_str());
+
+  // --
+  // Build graph
+
+  auto build = [&]() {
+    return graph::build::from_csr_and_csc<
+        memory_space_t::host, graph::view_t::csr | graph::view_t::csc>(
+        csr.number_of_rows,          // rows
+        csr.number_of_columns,       // columns
+        csr.number_of_nonzeros,      // nonzeros
+        csr.row_offsets.data(),      // row_offsets
+        csr.column_indices.data(),   // column_indices
+        csr.nonzero_values.data(),   // values
+        csc.column_offsets.data(),   // column_offsets
+        csc.row_indices.data(),      // row_indices
+        csc.nonzero_values.data());  // values (column order)
+  };
+
+  stages.push_back(benchmark::run("graph build", options, [&]() {
+    auto G = build();
+    return (double)G.get_number_of_edges();
+  }));
+
+  auto G = build();
+  vertex_t n_vertices = G.get_number_of_vertices();
+  edge_t n_edges = G.get_number_of_edges();
+
+  // Edges out of the vertices reached by a traversal.
+  auto traversed_edges = [&](auto reached) {
+    double edges = 0;
+    for (vertex_t v = 0; v < n_vertices; ++v)
+      if (reached(v))
+        edges += G.get_number_of_neighbors(v);
+    return edges;
+  };
+
+  // --
+  // Applications (host)
+
+  std::vector<vertex_t> distances(n_vertices);
+  std::vector<vertex_t> predecessors(n_vertices);
+  stages.push_back(benchmark::run("bfs (cpu)", options, [&]() {
+    bfs::cpu::run(G, single_source, distances.data(), predecessors.data());
+    return traversed_edges([&](vertex_t v) { return distances[v] != -1; });
+  }));
+
+  std::vector<weight_t> weighted_distances(n_vertices);
+  stages.push_back(benchmark::run("sssp (cpu)", options, [&]() {
+    sssp::cpu::run(G, single_source, weighted_distances.data(),
+                   predecessors.data());
+    return traversed_edges([&](vertex_t v) {
+      return weighted_distances[v] != std::numeric_limits<weight_t>::max();
+    });
+  }));
+
+  std::vector<weight_t> ranks(n_vertices);
+  stages.push_back(benchmark::run("pr (host)", options, [&]() {
+    pr::run(G, weight_t(0.85), weight_t(1e-6), ranks.data());
+    return (double)n_edges;
+  }));
+
+  // Edges processed by the iterations of a CPU PageRank.
+  auto pr_cpu = [&](pr::cpu::mode_t mode) {
+    pr::cpu::options_t pr_options;
+    pr_options.mode = mode;
+    pr::cpu::stats_t<weight_t> stats;
+    pr::cpu::run(G, pr::param_t<weight_t>(0.85, 1e-6),
+                 pr::result_t<weight_t>(ranks.data()), &stats, pr_options);
+    double edges = 0;
+    for (auto e : stats.edges)
+      edges += e;
+    return edges;
+  };
+
+  stages.push_back(benchmark::run("pr (cpu)", options,
+                                  [&]() { return pr_cpu(pr::cpu::power); }));
+  stages.push_back(benchmark::run("pr delta (cpu)", options,
+                                  [&]() { return pr_cpu(pr::cpu::delta); }));
+
+  std::vector<vertex_t> colors(n_vertices);
+  stages.push_back(benchmark::run("color (host)", options, [&]() {
+    color::run(G, colors.data());
+    return (double)n_edges;
+  }));
+
+  auto color_cpu = [&](color::cpu::ordering_t ordering) {
+    color::cpu::stats_t<vertex_t> stats;
+    color::cpu::options_t color_options;
+    color_options.ordering = ordering;
+    color::cpu::run(G, colors.data(), &stats, color_options);
+    double edges = 0;
+    for (auto e : stats.edges)
+      edges += e;
+    return edges;
+  };
+
+  stages.push_back(benchmark::run("color (cpu)", options, [&]() {
+    return color_cpu(color::cpu::natural);
+  }));
+  stages.push_back(benchmark::run("color ldf (cpu)", options, [&]() {
+    return color_cpu(color::cpu::largest_degree_first);
+  }));
+
+  // --
+  // Log
+
+  auto dataset = json.new_object();
+  json.set_val("filename", filename, dataset);
+  json.set_val("vertices", n_vertices, dataset);
+  json.set_val("edges", n_edges, dataset);
+  json.set_val("average_degree", graph::get_average_degree(G), dataset);
+  json.set_val("degree_standard_deviation",
+               graph::get_degree_standard_deviation(G), dataset);
+  json.set_object("dataset", dataset);
+
+  auto settings = json.new_object();
+  json.set_val("warmup", options.warmup, settings);
+  json.set_val("repetitions", options.repetitions, settings);
+  json.set_val("threads", omp_get_max_threads(), settings);
+  json.set_val("source", single_source, settings);
+  json.set_object("options", settings);
+
+  for (auto const& stage : stages)
+    stage.write(json);
+  json.write();
+
+  std::cout << "Git SHA1 : " << g_GIT_SHA1 << std::endl;
+  std::cout << "Results : " << json_filename << std::endl;
+}
+
+int main(int argc, char** argv) {
+  benchmarks(argc, argv);
+}
@@ -0,0 +1,15 @@
+# Write the Git SHA1 of SOURCE_DIR to OUTPUT, from the template INPUT
+# (util/gitsha1.c.in). Runs at configure time and again at every build (see
+# the gitsha1 target), so the SHA1 follows commits made after configuring;
+# configure_file() leaves OUTPUT untouched when the SHA1 did not change.
+execute_process(
+  COMMAND git rev-parse HEAD
+  WORKING_DIRECTORY ${SOURCE_DIR}
+  OUTPUT_VARIABLE GIT_SHA1
+  OUTPUT_STRIP_TRAILING_WHITESPACE
+  ERROR_QUIET
+)
+if(NOT GIT_SHA1)
+  set(GIT_SHA1 "GIT-SHA-NOT-FOUND")
+endif()
+configure_file(${INPUT} ${OUTPUT} @ONLY)
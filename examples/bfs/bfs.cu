@@ -26,9 +26,16 @@ void test_bfs(int num_arguments, char** argument_array) {
 
   using csr_t =
       format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t>;
+  auto coo = mm.load(filename);
+
   csr_t csr;
-  csr.from_coo(mm.load(filename));
-  
+  csr.from_coo(coo);
+
+  // Host CSR and CSC (built in the same pass) for the reference BFS.
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csr;
+  format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csc;
+  format::from_coo(coo, h_csr, h_csc);
+
   thrust::device_vector<vertex_t> row_indices(csr.number_of_nonzeros);
   thrust::device_vector<edge_t> column_offsets(csr.number_of_columns + 1);
 
@@ -47,6 +54,19 @@ void test_bfs(int num_arguments, char** argument_array) {
       column_offsets.data().get()       // column_offsets
   );
 
+  auto H = graph::build::from_csr_and_csc<
+      memory_space_t::host, graph::view_t::csr | graph::view_t::csc>(
+      h_csr.number_of_rows,                 // rows
+      h_csr.number_of_columns,              // columns
+      h_csr.number_of_nonzeros,             // nonzeros
+      h_csr.row_offsets.data(),             // row_offsets
+      h_csr.column_indices.data(),          // column_indices
+      h_csr.nonzero_values.data(),          // values
+      h_csc.column_offsets.data(),          // column_offsets
+      h_csc.row_indices.data(),             // row_indices
+      h_csc.nonzero_values.data()           // values (column order)
+  );
+
   // --
   // Params and memory allocation
 
@@ -68,11 +88,24 @@ void test_bfs(int num_arguments, char** argument_array) {
   thrust::host_vector<vertex_t> h_distances(n_vertices);
   thrust::host_vector<vertex_t> h_predecessors(n_vertices);
 
-  float cpu_elapsed = bfs_cpu::run<csr_t, vertex_t, edge_t>(
-      csr, single_source, h_distances.data(), h_predecessors.data());
+  gunrock::bfs::cpu::stats_t<vertex_t> stats;
+  float cpu_elapsed = bfs_cpu::run(H, single_source, h_distances.data(),
+                                   h_predecessors.data(), &stats);
 
   int n_errors = bfs_cpu::compute_error(distances, h_distances);
 
+  // --
+  // Host Run (the same application on the host backend)
+
+  thrust::host_vector<vertex_t> e_distances(n_vertices);
+  thrust::host_vector<vertex_t> e_predecessors(n_vertices);
+
+  float host_elapsed = gunrock::bfs::run(H, single_source, e_distances.data(),
+                                         e_predecessors.data());
+  int n_host_errors = bfs_cpu::compute_error(distances, e_distances);
+  int n_predecessor_errors = bfs_cpu::compute_predecessor_error(
+      H, single_source, h_distances.data(), h_predecessors.data());
+
   // --
   // Log
 
@@ -94,7 +127,18 @@ void test_bfs(int num_arguments, char** argument_array) {
   std::cout << "GPU Elapsed Time : " << gpu_elapsed << " (ms)" << std::endl;
   std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms)" << std::endl;
   std::cout << "Number of errors : " << n_errors << std::endl;
-  
+  std::cout << "Host Elapsed Time : " << host_elapsed << " (ms)" << std::endl;
+  std::cout << "Host errors : " << n_host_errors << std::endl;
+  std::cout << "Predecessor errors (CPU) : " << n_predecessor_errors
+            << std::endl;
+
+  std::cout << "CPU Frontier sizes (per level) = ";
+  for (std::size_t level = 0; level < stats.frontier_sizes.size(); ++level)
+    std::cout << stats.frontier_sizes[level]
+              << ((stats.directions[level] == gunrock::bfs::cpu::push) ? "(push) "
+                                                                   : "(pull) ");
+  std::cout << std::endl;
+
 }
 
 int main(int argc, char** argv) {
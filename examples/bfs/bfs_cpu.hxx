@@ -1,66 +1,54 @@
 #pragma once
 
-#include <chrono>
 #include <vector>
-#include <queue>
+
+#include <gunrock/applications/cpu/bfs.hxx>
 
 namespace bfs_cpu {
 
 using namespace std;
-using namespace std::chrono;
-
-template <typename vertex_t>
-class prioritize {
- public:
-  bool operator()(pair<vertex_t, vertex_t>& p1, pair<vertex_t, vertex_t>& p2) {
-    return p1.second > p2.second;
-  }
-};
 
-template <typename csr_t, typename vertex_t, typename edge_t>
-float run(csr_t& csr,
+/**
+ * @brief Reference (host) BFS, see `gunrock::bfs::cpu::run`. `G` is a host
+ * graph with CSR and CSC views.
+ */
+template <typename graph_t, typename vertex_t>
+float run(graph_t& G,
           vertex_t& single_source,
           vertex_t* distances,
-          vertex_t* predecessors) {
-  thrust::host_vector<edge_t> row_offsets(csr.row_offsets);  // Copy data to CPU
-  thrust::host_vector<vertex_t> column_indices(csr.column_indices);
-
-  for (vertex_t i = 0; i < csr.number_of_rows; i++)
-    distances[i] = std::numeric_limits<vertex_t>::max();
-
-  auto t_start = high_resolution_clock::now();
-
-  distances[single_source] = 0;
-
-  priority_queue<pair<vertex_t, vertex_t>,
-                 std::vector<pair<vertex_t, vertex_t>>,
-                 prioritize<vertex_t>> pq;
-  
-  pq.push(make_pair(single_source, 0.0));
-
-  while (!pq.empty()) {
-    pair<vertex_t, vertex_t> curr = pq.top();
-    pq.pop();
-
-    vertex_t curr_node = curr.first;
-    vertex_t curr_dist = curr.second;
-
-    vertex_t start = row_offsets[curr_node];
-    vertex_t end = row_offsets[curr_node + 1];
+          vertex_t* predecessors,
+          gunrock::bfs::cpu::stats_t<vertex_t>* stats = nullptr) {
+  return gunrock::bfs::cpu::run(G, single_source, distances, predecessors,
+                                stats);
+}
 
-    for (vertex_t offset = start; offset < end; offset++) {
-      vertex_t neib = column_indices[offset];
-      vertex_t new_dist = curr_dist + 1;
-      if (new_dist < distances[neib]) {
-        distances[neib] = new_dist;
-        pq.push(make_pair(neib, new_dist));
-      }
+/**
+ * @brief Check that every reached vertex (other than the source) has a
+ * predecessor one level above it, connected to it by an edge.
+ */
+template <typename graph_t, typename vertex_t>
+int compute_predecessor_error(graph_t& G,
+                              vertex_t const& single_source,
+                              vertex_t const* distances,
+                              vertex_t const* predecessors) {
+  int n_errors = 0;
+  for (vertex_t v = 0; v < G.get_number_of_vertices(); ++v) {
+    if (v == single_source || distances[v] == -1)
+      continue;
+
+    vertex_t u = predecessors[v];
+    bool valid = (u >= 0) && (distances[u] == distances[v] - 1);
+    if (valid) {
+      valid = false;
+      for (auto e = G.get_row_offsets()[u]; e < G.get_row_offsets()[u + 1];
+           ++e)
+        valid = valid || (G.get_column_indices()[e] == v);
     }
-  }
 
-  auto t_stop = high_resolution_clock::now();
-  auto elapsed = duration_cast<microseconds>(t_stop - t_start).count();
-  return (float)elapsed / 1000;
+    if (!valid)
+      n_errors++;
+  }
+  return n_errors;
 }
 
 template <typename val_t>
@@ -77,4 +65,4 @@ int compute_error(thrust::device_vector<val_t> _gpu_result,
   return n_errors;
 }
 
-}  // namespace bfs_cpu
\ No newline at end of file
+}  // namespace bfs_cpu
@@ -43,6 +43,24 @@ void test_color(int num_arguments, char** argument_array) {
       csr.nonzero_values.data().get()   // values
   );  // supports row_indices and column_offsets (default = nullptr)
 
+  // Host copy of the graph, for the host backend.
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csr;
+  h_csr.number_of_rows = csr.number_of_rows;
+  h_csr.number_of_columns = csr.number_of_columns;
+  h_csr.number_of_nonzeros = csr.number_of_nonzeros;
+  h_csr.row_offsets = csr.row_offsets;
+  h_csr.column_indices = csr.column_indices;
+  h_csr.nonzero_values = csr.nonzero_values;
+
+  auto H = graph::build::from_csr<memory_space_t::host, graph::view_t::csr>(
+      h_csr.number_of_rows,         // rows
+      h_csr.number_of_columns,      // columns
+      h_csr.number_of_nonzeros,     // nonzeros
+      h_csr.row_offsets.data(),     // row_offsets
+      h_csr.column_indices.data(),  // column_indices
+      h_csr.nonzero_values.data()   // values
+  );
+
   // --
   // Params and memory allocation
 
@@ -56,15 +74,29 @@ void test_color(int num_arguments, char** argument_array) {
   std::cout << "GPU Elapsed Time : " << gpu_elapsed << " (ms)" << std::endl;
   
   // --
-  // CPU Run
-  
+  // CPU Run (speculative coloring, both orderings)
+
   thrust::host_vector<vertex_t> h_colors(n_vertices);
-  
-  float cpu_elapsed = color_cpu::run<csr_t, vertex_t, edge_t, weight_t>(
-      csr, h_colors.data());
-  
-  int n_errors = color_cpu::compute_error<csr_t, vertex_t, edge_t, weight_t>(
-    csr, colors, h_colors);
+  gunrock::color::cpu::stats_t<vertex_t> stats;
+  float cpu_elapsed = color_cpu::run(H, h_colors.data(), &stats);
+
+  thrust::host_vector<vertex_t> l_colors(n_vertices);
+  gunrock::color::cpu::stats_t<vertex_t> l_stats;
+  gunrock::color::cpu::options_t options;
+  options.ordering = gunrock::color::cpu::largest_degree_first;
+  float ldf_elapsed = color_cpu::run(H, l_colors.data(), &l_stats, options);
+
+  thrust::host_vector<vertex_t> g_colors(colors);
+  int n_errors = color_cpu::compute_error(H, g_colors.data());
+  int n_cpu_errors = color_cpu::compute_error(H, h_colors.data()) +
+                     color_cpu::compute_error(H, l_colors.data());
+
+  // --
+  // Host Run (the same application on the host backend)
+
+  thrust::host_vector<vertex_t> e_colors(n_vertices);
+  float host_elapsed = gunrock::color::run(H, e_colors.data());
+  int n_host_errors = color_cpu::compute_error(H, e_colors.data());
 
   // --
   // Log
@@ -77,7 +109,18 @@ void test_color(int num_arguments, char** argument_array) {
 
   std::cout << "GPU Elapsed Time : " << gpu_elapsed << " (ms)" << std::endl;
   std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms)" << std::endl;
+  std::cout << "CPU Colors : " << stats.colors << " in " << stats.rounds
+            << " rounds, conflicts per round :";
+  for (auto conflicts : stats.conflicts)
+    std::cout << " " << conflicts;
+  std::cout << std::endl;
+  std::cout << "CPU (largest degree first) Elapsed Time : " << ldf_elapsed
+            << " (ms), " << l_stats.colors << " colors in " << l_stats.rounds
+            << " rounds" << std::endl;
   std::cout << "Number of errors : " << n_errors << std::endl;
+  std::cout << "CPU errors : " << n_cpu_errors << std::endl;
+  std::cout << "Host Elapsed Time : " << host_elapsed << " (ms)" << std::endl;
+  std::cout << "Host errors : " << n_host_errors << std::endl;
 }
 
 int main(int argc, char** argv) {
@@ -0,0 +1,192 @@
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <gunrock/applications/application.hxx>
+#include <gunrock/applications/cpu/bfs.hxx>
+#include <gunrock/applications/cpu/sssp.hxx>
+#include <gunrock/applications/cpu/repair.hxx>
+#include <gunrock/algorithms/generate/random.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+void test_dynamic(int num_arguments, char** argument_array) {
+  if (num_arguments < 2 || num_arguments > 4) {
+    std::cerr << "usage: ./bin/<program-name> filename.mtx [batch_size] "
+                 "[batches]"
+              << std::endl;
+    exit(1);
+  }
+
+  // --
+  // Define types
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  using dynamic_csr_t =
+      format::dynamic_csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+  using update_t = format::edge_update_t<vertex_t, weight_t>;
+
+  // --
+  // IO
+
+  std::string filename = argument_array[1];
+  std::size_t batch_size =
+      (num_arguments > 2) ? std::stoul(argument_array[2]) : 1024;
+  int batches = (num_arguments > 3) ? std::stoi(argument_array[3]) : 10;
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto coo = mm.load(filename);
+
+  csr_t csr, csr_t_;
+  format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t> csc;
+  format::from_coo(coo, csr, csc);
+  csr_t_.number_of_rows = csc.number_of_columns;
+  csr_t_.number_of_columns = csc.number_of_rows;
+  csr_t_.number_of_nonzeros = csc.number_of_nonzeros;
+  csr_t_.row_offsets = csc.column_offsets;
+  csr_t_.column_indices = csc.row_indices;
+  csr_t_.nonzero_values = csc.nonzero_values;
+
+  // --
+  // Build the dynamic graph and its reverse (for the repairs)
+
+  dynamic_csr_t D, T;
+  D.from_csr(csr);
+  T.from_csr(csr_t_);
+
+  vertex_t n = D.number_of_rows;
+  vertex_t source = 0;
+  std::vector<weight_t> distances(n), expected(n);
+  std::vector<vertex_t> predecessors(n), depths(n), parents(n),
+      expected_depths(n), scratch(n);
+
+  // From scratch: rebuild a static CSR from the dynamic one, then solve.
+  float rebuild_elapsed = 0, sssp_elapsed = 0, bfs_elapsed = 0;
+  auto recompute = [&](std::vector<weight_t>& sssp_distances,
+                       std::vector<vertex_t>& sssp_predecessors,
+                       std::vector<vertex_t>& bfs_depths,
+                       std::vector<vertex_t>& bfs_parents) {
+    auto t_start = std::chrono::high_resolution_clock::now();
+    csr_t S;
+    D.to_csr(S);
+    auto H = graph::build::from_csr<memory_space_t::host, graph::view_t::csr>(
+        S.number_of_rows,         // rows
+        S.number_of_columns,      // columns
+        S.number_of_nonzeros,     // nonzeros
+        S.row_offsets.data(),     // row_offsets
+        S.column_indices.data(),  // column_indices
+        S.nonzero_values.data()   // values
+    );
+    auto t_stop = std::chrono::high_resolution_clock::now();
+    rebuild_elapsed +=
+        std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+    sssp_elapsed += sssp::cpu::run(H, source, sssp_distances.data(),
+                                   sssp_predecessors.data());
+    bfs_elapsed +=
+        bfs::cpu::run(H, source, bfs_depths.data(), bfs_parents.data());
+  };
+  recompute(distances, predecessors, depths, parents);
+  rebuild_elapsed = sssp_elapsed = bfs_elapsed = 0;
+
+  // --
+  // Stream of batches: erase existing edges, insert random ones (weights
+  // drawn from existing edges)
+
+  algo::generate::random::counter_t rng(1);
+  std::uint64_t draw = 0;
+  auto random_edge = [&]() {
+    for (;;) {
+      vertex_t u = rng(draw++) % n;
+      if (D.row_lengths[u] > 0)
+        return D.row_offsets[u] + (edge_t)(rng(draw++) % D.row_lengths[u]);
+    }
+  };
+
+  float update_elapsed = 0, sssp_repair_elapsed = 0, bfs_repair_elapsed = 0;
+  std::size_t updates = 0, invalidated = 0, settled = 0;
+  int n_errors = 0;
+
+  for (int b = 0; b < batches; ++b) {
+    std::vector<update_t> batch, reverse;
+    for (std::size_t k = 0; k < batch_size; ++k) {
+      edge_t e = random_edge();
+      if (k % 2 == 0)
+        batch.push_back({D.row_indices[e], D.column_indices[e],
+                         D.nonzero_values[e], format::update_t::erase});
+      else
+        batch.push_back({(vertex_t)(rng(draw++) % n),
+                         (vertex_t)(rng(draw++) % n), D.nonzero_values[e],
+                         format::update_t::insert});
+    }
+    std::stable_sort(batch.begin(), batch.end());
+    reverse = batch;
+    for (auto& update : reverse)
+      std::swap(update.source, update.destination);
+    std::stable_sort(reverse.begin(), reverse.end());
+
+    auto t_start = std::chrono::high_resolution_clock::now();
+    D.update(batch);
+    T.update(reverse);
+    auto t_stop = std::chrono::high_resolution_clock::now();
+    update_elapsed +=
+        std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+    updates += batch.size();
+
+    auto G = graph::build::from_dynamic_csr<memory_space_t::host,
+                                            graph::view_t::dynamic_csr>(D);
+    auto R = graph::build::from_dynamic_csr<memory_space_t::host,
+                                            graph::view_t::dynamic_csr>(T);
+
+    repair::cpu::stats_t stats;
+    sssp_repair_elapsed +=
+        repair::cpu::sssp(G, R, source, batch.data(), batch.size(),
+                          distances.data(), predecessors.data(), &stats);
+    invalidated += stats.invalidated;
+    settled += stats.settled;
+    bfs_repair_elapsed +=
+        repair::cpu::bfs(G, R, source, batch.data(), batch.size(),
+                         depths.data(), parents.data());
+
+    recompute(expected, scratch, expected_depths, scratch);
+    for (vertex_t v = 0; v < n; ++v)
+      n_errors += (distances[v] != expected[v]) +
+                  (depths[v] != expected_depths[v]);
+  }
+
+  // --
+  // Log
+
+  std::cout << "Batches : " << batches << " x " << batch_size << " updates ("
+            << D.stats.inserted << " inserted, " << D.stats.erased
+            << " erased, " << D.stats.reweighted << " reweighted)"
+            << std::endl;
+  std::cout << "Storage : " << D.stats.relocations << " relocations, "
+            << D.stats.compactions << " compactions, "
+            << D.get_size_in_bytes() / (1 << 20) << " MiB" << std::endl;
+  std::cout << "Update rate : "
+            << 2 * updates / std::max(update_elapsed / 1000.0f, 1e-9f)
+            << " updates/s (graph and reverse graph)" << std::endl;
+  std::cout << "SSSP repair : " << sssp_repair_elapsed << " (ms), "
+            << invalidated << " invalidated, " << settled
+            << " settled; recompute : " << sssp_elapsed << " + "
+            << rebuild_elapsed << " (rebuild) (ms), speedup "
+            << (sssp_elapsed + rebuild_elapsed) /
+                   std::max(sssp_repair_elapsed, 1e-6f)
+            << "x" << std::endl;
+  std::cout << "BFS repair : " << bfs_repair_elapsed
+            << " (ms); recompute : " << bfs_elapsed << " + "
+            << rebuild_elapsed << " (rebuild) (ms), speedup "
+            << (bfs_elapsed + rebuild_elapsed) /
+                   std::max(bfs_repair_elapsed, 1e-6f)
+            << "x" << std::endl;
+  std::cout << "Number of errors : " << n_errors << std::endl;
+}
+
+int main(int argc, char** argv) {
+  test_dynamic(argc, argv);
+}
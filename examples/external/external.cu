@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include <gunrock/applications/application.hxx>
+#include <gunrock/applications/cpu/bfs.hxx>
+#include <gunrock/applications/cpu/sssp.hxx>
+#include <gunrock/applications/cpu/pr.hxx>
+#include <gunrock/applications/cpu/external.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+void log_stats(std::string name,
+               float elapsed,
+               external::cpu::stats_t const& stats) {
+  std::cout << name << " : " << elapsed << " (ms), " << stats.iterations
+            << " iterations, " << stats.total_bytes_read / (1 << 20)
+            << " MiB read ("
+            << stats.total_bytes_read / (1 << 20) /
+                   std::max(elapsed / 1000.0f, 1e-6f)
+            << " MiB/s), waited " << stats.wait_time << " (ms) on reads"
+            << std::endl;
+  std::cout << "  bytes read per iteration :";
+  for (auto bytes : stats.bytes_read)
+    std::cout << " " << bytes;
+  std::cout << std::endl;
+}
+
+void test_external(int num_arguments, char** argument_array) {
+  std::string filename;
+  std::size_t block_mib = 64;
+  bool validate = false;
+  for (int i = 1; i < num_arguments; ++i) {
+    if (std::strcmp(argument_array[i], "--validate") == 0)
+      validate = true;
+    else if (filename.empty())
+      filename = argument_array[i];
+    else
+      block_mib = std::stoul(argument_array[i]);
+  }
+
+  if (filename.empty()) {
+    std::cerr << "usage: ./bin/<program-name> filename.{mtx,csr} [block_MiB] "
+                 "[--validate]"
+              << std::endl;
+    exit(1);
+  }
+
+  // --
+  // Define types
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+
+  // --
+  // IO: Matrix Market inputs are converted (next to the input) first.
+
+  if (util::is_market(filename)) {
+    io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+    csr_t csr;
+    csr.from_coo(mm.load(filename));
+    filename += ".csr";
+    csr.write_binary(filename);
+    validate = true;
+  } else if (!util::is_binary_csr(filename)) {
+    std::cerr << "Unknown file format: " << filename << std::endl;
+    exit(1);
+  }
+
+  format::binary::external_csr_properties_t properties;
+  properties.block_bytes = block_mib << 20;
+  format::binary::external_csr_t<vertex_t, edge_t, weight_t> E(filename,
+                                                               properties);
+
+  vertex_t n = E.number_of_rows;
+  vertex_t source = 0;
+
+  std::cout << "Graph : " << n << " vertices, " << E.number_of_nonzeros
+            << " edges, " << E.get_number_of_blocks() << " blocks of "
+            << block_mib << " MiB" << std::endl;
+
+  // --
+  // Semi-external runs
+
+  std::vector<vertex_t> depths(n), parents(n), predecessors(n);
+  std::vector<weight_t> distances(n), ranks(n);
+  external::cpu::stats_t bfs_stats, sssp_stats, pr_stats;
+
+  float bfs_elapsed = external::cpu::bfs(E, source, depths.data(),
+                                         parents.data(), &bfs_stats);
+  float sssp_elapsed = external::cpu::sssp(
+      E, source, distances.data(), predecessors.data(), &sssp_stats);
+  pr::param_t<weight_t> param(0.85, 1e-6);
+  float pr_elapsed = external::cpu::pr(
+      E, param, pr::result_t<weight_t>(ranks.data()), &pr_stats);
+
+  // --
+  // Log
+
+  log_stats("BFS", bfs_elapsed, bfs_stats);
+  log_stats("SSSP", sssp_elapsed, sssp_stats);
+  log_stats("PR", pr_elapsed, pr_stats);
+
+  // --
+  // Validate against the in-memory runs (the whole graph has to fit).
+
+  if (!validate)
+    return;
+
+  csr_t csr;
+  csr.read_binary(filename);
+  format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t> coo(
+      csr.number_of_rows, csr.number_of_columns, csr.number_of_nonzeros);
+  for (vertex_t v = 0; v < csr.number_of_rows; ++v)
+    for (edge_t e = csr.row_offsets[v]; e < csr.row_offsets[v + 1]; ++e) {
+      coo.row_indices[e] = v;
+      coo.column_indices[e] = csr.column_indices[e];
+      coo.nonzero_values[e] = csr.nonzero_values[e];
+    }
+  format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t> csc;
+  csc.from_coo(coo);
+
+  auto H = graph::build::from_csr_and_csc<
+      memory_space_t::host, graph::view_t::csr | graph::view_t::csc>(
+      csr.number_of_rows,         // rows
+      csr.number_of_columns,      // columns
+      csr.number_of_nonzeros,     // nonzeros
+      csr.row_offsets.data(),     // row_offsets
+      csr.column_indices.data(),  // column_indices
+      csr.nonzero_values.data(),  // values
+      csc.column_offsets.data(),  // column_offsets
+      csc.row_indices.data(),     // row_indices
+      csc.nonzero_values.data()   // values (column order)
+  );
+
+  std::vector<vertex_t> expected_depths(n), scratch(n);
+  std::vector<weight_t> expected_distances(n), expected_ranks(n);
+  bfs::cpu::run(H, source, expected_depths.data(), scratch.data());
+  sssp::cpu::run(H, source, expected_distances.data(), scratch.data());
+  pr::cpu::run(H, param, pr::result_t<weight_t>(expected_ranks.data()));
+
+  int n_errors = 0;
+  weight_t largest = 0;
+  for (vertex_t v = 0; v < n; ++v) {
+    n_errors += (depths[v] != expected_depths[v]) +
+                (distances[v] != expected_distances[v]);
+    largest = std::max(largest, std::abs(ranks[v] - expected_ranks[v]));
+  }
+
+  std::cout << "Number of errors : " << n_errors << std::endl;
+  std::cout << "PR largest difference : " << largest << std::endl;
+}
+
+int main(int argc, char** argv) {
+  test_external(argc, argv);
+}
@@ -1,109 +1,13 @@
+#include <chrono>
 #include <iostream>
-#include <sstream>
 
 #include <gunrock/applications/geo.hxx>
+#include <gunrock/applications/cpu/geo.hxx>
+#include <gunrock/io/labels.hxx>
 
 using namespace gunrock;
 using namespace memory;
 
-/**
- * @brief Reads a coordinates file from an input-stream a dense array.
- *
- * Here is an example of the labels file
- * +-------------------------+
- * |%%Labels Formatted File  | <-- header
- * |%                        | <-+
- * |% comments               |   |-- comments
- * |%                        | <-+
- * |  N L L                  | <-- num_nodes, num_labels, num_labels
- * |  I0 L1A L1B             | <-- node id, latitude, longutude
- * |  I4                     | <-- coordinates missing, populated as invalids
- * |  I5 L5A L5B             |
- * |  . . .                  |
- * |  IN LNA LNB             |
- * +-------------------------+
- *
- * @note Node ID (first column) must be 0-based.
- * @note If a Node ID is present but coordinates are missing,
- *       the coordinates are filled as invalids.
- * @note If Node ID and coordinates are missing, the coordinates
- *       for those Node IDs are filled as invalids.
- */
-void read_coordinates_file(std::string filename,
-                           geo::coordinates_t* coordinates) {
-  FILE* f_in = fopen(filename.c_str(), "r");
-  int labels_read = gunrock::numeric_limits<int>::invalid();
-  char line[1024];
-
-  while (true) {
-    if (fscanf(f_in, "%[^\n]\n", line) <= 0) {
-      break;
-    }
-
-    if (line[0] == '%') {  // Comment
-      if (strlen(line) >= 2 && line[1] == '%') {
-        // Header -> Can be used to extract info for labels
-      }
-    }  // -> if
-
-    else if (!gunrock::util::limits::is_valid(
-                 labels_read)) {  // Problem description-> First line
-                                  // with nodes and labels info
-      long long ll_nodes, ll_label_x, ll_label_y;
-      int items_scanned =
-          sscanf(line, "%lld %lld %lld", &ll_nodes, &ll_label_x, &ll_label_y);
-      labels_read = 0;
-    }  // -> else if
-
-    else {                // Now we can start storing labels
-      long long ll_node;  // Active node
-
-      // Used for sscanf
-      float lf_label_a = gunrock::numeric_limits<float>::invalid();
-      float lf_label_b = gunrock::numeric_limits<float>::invalid();
-
-      float ll_label_a, ll_label_b;  // Used to parse float/double
-
-      int num_input =
-          sscanf(line, "%lld %f %f", &ll_node, &lf_label_a, &lf_label_b);
-
-      if (num_input == 1) {
-        // if only node id exists in the line, populate the coordinates with
-        // invalid values.
-        ll_label_a = gunrock::numeric_limits<float>::invalid();
-        ll_label_b = gunrock::numeric_limits<float>::invalid();
-      }
-
-      else if (num_input == 3) {
-        // if all three; node id, latitude and longitude exist, populate all
-        // three.
-        ll_label_a = lf_label_a;
-        ll_label_b = lf_label_b;
-
-        labels_read++;
-      }
-
-      else {
-        // else print an error.
-        std::cerr << "Invalid coordinates file format." << std::endl;
-        exit(1);
-      }
-
-      // XXX: Make sure these are 0-based;
-      coordinates[ll_node].latitude = ll_label_a;
-      coordinates[ll_node].longitude = ll_label_b;
-
-    }  // -> else
-  }    // -> while
-
-  if (labels_read) {
-    std::cout << "Valid coordinates read: " << labels_read << std::endl;
-  } else if (labels_read <= 0) {
-    std::cerr << "Error: No coordinates read." << std::endl;
-    exit(1);
-  }
-}
-
 void test_geo(int num_arguments, char** argument_array) {
   if (num_arguments != 3) {
     std::cerr << "usage: ./bin/<program-name> filename.mtx filename.labels"
@@ -142,6 +46,24 @@ void test_geo(int num_arguments, char** argument_array) {
       csr.nonzero_values.data().get()   // values
   );  // supports row_indices and column_offsets (default = nullptr)
 
+  // Host copy of the graph, for the host engine.
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csr;
+  h_csr.number_of_rows = csr.number_of_rows;
+  h_csr.number_of_columns = csr.number_of_columns;
+  h_csr.number_of_nonzeros = csr.number_of_nonzeros;
+  h_csr.row_offsets = csr.row_offsets;
+  h_csr.column_indices = csr.column_indices;
+  h_csr.nonzero_values = csr.nonzero_values;
+
+  auto H = graph::build::from_csr<memory_space_t::host, graph::view_t::csr>(
+      h_csr.number_of_rows,         // rows
+      h_csr.number_of_columns,      // columns
+      h_csr.number_of_nonzeros,     // nonzeros
+      h_csr.row_offsets.data(),     // row_offsets
+      h_csr.column_indices.data(),  // column_indices
+      h_csr.nonzero_values.data()   // values
+  );
+
   // --
   // Params and memory allocation
 
@@ -150,15 +72,27 @@ void test_geo(int num_arguments, char** argument_array) {
 
   vertex_t n_vertices = G.get_number_of_vertices();
 
-  // Coordinates: Latitude/Longitude
+  // Coordinates: Latitude/Longitude (structure of arrays)
   std::string coordinates_filename = argument_array[2];
-  geo::coordinates_t default_invalid;
-  default_invalid.latitude = gunrock::numeric_limits<float>::invalid();
-  default_invalid.longitude = gunrock::numeric_limits<float>::invalid();
+  thrust::host_vector<float> latitudes(n_vertices), longitudes(n_vertices);
 
-  thrust::host_vector<geo::coordinates_t> load_coordinates(n_vertices,
-                                                           default_invalid);
-  read_coordinates_file(coordinates_filename, load_coordinates.data());
+  io::labels_t<vertex_t> labels;
+  auto t_start = std::chrono::high_resolution_clock::now();
+  std::size_t valid = labels.load(coordinates_filename, n_vertices,
+                                  latitudes.data(), longitudes.data());
+  auto t_stop = std::chrono::high_resolution_clock::now();
+  float load_elapsed =
+      std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+
+  if (valid == 0) {
+    std::cerr << "Error: No coordinates read." << std::endl;
+    exit(1);
+  }
+  std::cout << "Valid coordinates read: " << valid << std::endl;
+
+  thrust::host_vector<geo::coordinates_t> load_coordinates(n_vertices);
+  for (vertex_t v = 0; v < n_vertices; ++v)
+    load_coordinates[v] = {latitudes[v], longitudes[v]};
   thrust::device_vector<geo::coordinates_t> coordinates(load_coordinates);
 
   // --
@@ -167,6 +101,16 @@ void test_geo(int num_arguments, char** argument_array) {
   float gpu_elapsed = gunrock::geo::run(G, coordinates.data().get(),
                                         total_iterations, spatial_iterations);
 
+  // --
+  // CPU Run
+
+  gunrock::geo::cpu::options_t options;
+  options.total_iterations = total_iterations;
+  options.spatial_iterations = spatial_iterations;
+  gunrock::geo::cpu::stats_t stats;
+  float cpu_elapsed = gunrock::geo::cpu::run(
+      H, latitudes.data(), longitudes.data(), &stats, options);
+
   // --
   // Log + Validate
 
@@ -178,7 +122,18 @@ void test_geo(int num_arguments, char** argument_array) {
     std::cout << "Node (" << i << ") = " << h_coordinates_data[i].latitude
               << ", " << h_coordinates_data[i].longitude << std::endl;
 
+  std::size_t located = 0;
+  for (vertex_t v = 0; v < n_vertices; ++v)
+    located += gunrock::util::limits::is_valid(latitudes[v]);
+
+  std::cout << "Load Elapsed Time : " << load_elapsed << " (ms)" << std::endl;
   std::cout << "GPU Elapsed Time : " << gpu_elapsed << " (ms)" << std::endl;
+  std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms)" << std::endl;
+  std::cout << "CPU Located : " << located << " of " << n_vertices << " in "
+            << stats.iterations << " rounds (" << stats.copies << " copies, "
+            << stats.midpoints << " midpoints, " << stats.medians
+            << " spatial medians, " << stats.median_steps << " steps)"
+            << std::endl;
 }
 
 int main(int argc, char** argv) {
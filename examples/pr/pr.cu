@@ -1,4 +1,5 @@
 #include <gunrock/applications/pr.hxx>
+#include <gunrock/applications/cpu/pr.hxx>
 
 using namespace gunrock;
 using namespace memory;
@@ -46,6 +47,40 @@ void test_sssp(int num_arguments, char** argument_array) {
       csr.nonzero_values.data().get()   // values
   );  // supports row_indices and column_offsets (default = nullptr)
 
+  // Host CSR and CSC of the graph, for the host backend and the CPU runs.
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csr;
+  h_csr.number_of_rows = csr.number_of_rows;
+  h_csr.number_of_columns = csr.number_of_columns;
+  h_csr.number_of_nonzeros = csr.number_of_nonzeros;
+  h_csr.row_offsets = csr.row_offsets;
+  h_csr.column_indices = csr.column_indices;
+  h_csr.nonzero_values = csr.nonzero_values;
+
+  format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_coo(
+      h_csr.number_of_rows, h_csr.number_of_columns, h_csr.number_of_nonzeros);
+  for (vertex_t v = 0; v < h_csr.number_of_rows; ++v)
+    for (edge_t e = h_csr.row_offsets[v]; e < h_csr.row_offsets[v + 1]; ++e) {
+      h_coo.row_indices[e] = v;
+      h_coo.column_indices[e] = h_csr.column_indices[e];
+      h_coo.nonzero_values[e] = h_csr.nonzero_values[e];
+    }
+
+  format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csc;
+  h_csc.from_coo(h_coo);
+
+  auto H = graph::build::from_csr_and_csc<
+      memory_space_t::host, graph::view_t::csr | graph::view_t::csc>(
+      h_csr.number_of_rows,         // rows
+      h_csr.number_of_columns,      // columns
+      h_csr.number_of_nonzeros,     // nonzeros
+      h_csr.row_offsets.data(),     // row_offsets
+      h_csr.column_indices.data(),  // column_indices
+      h_csr.nonzero_values.data(),  // values
+      h_csc.column_offsets.data(),  // column_offsets
+      h_csc.row_indices.data(),     // row_indices
+      h_csc.nonzero_values.data()   // values (column order)
+  );
+
   // --
   // Params and memory allocation
   
@@ -62,12 +97,68 @@ void test_sssp(int num_arguments, char** argument_array) {
   
   float gpu_elapsed = gunrock::pr::run(G, alpha, tol, p.data().get());
 
+  // --
+  // Host Run (the same application on the host backend)
+
+  thrust::host_vector<weight_t> h_p(n_vertices);
+  float host_elapsed = gunrock::pr::run(H, alpha, tol, h_p.data());
+
+  // --
+  // CPU Runs (cache-blocked pull, power iteration and delta updates)
+
+  gunrock::pr::param_t<weight_t> param(alpha, tol);
+
+  thrust::host_vector<weight_t> c_p(n_vertices);
+  gunrock::pr::cpu::stats_t<weight_t> stats;
+  float cpu_elapsed = gunrock::pr::cpu::run(
+      H, param, gunrock::pr::result_t<weight_t>(c_p.data()), &stats);
+
+  thrust::host_vector<weight_t> d_p(n_vertices);
+  gunrock::pr::cpu::options_t options;
+  options.mode = gunrock::pr::cpu::delta;
+  gunrock::pr::cpu::stats_t<weight_t> delta_stats;
+  float delta_elapsed = gunrock::pr::cpu::run(
+      H, param, gunrock::pr::result_t<weight_t>(d_p.data()), &delta_stats,
+      options);
+
+  thrust::host_vector<weight_t> gpu_p(p);
+  auto max_difference = [&](thrust::host_vector<weight_t> const& q) {
+    weight_t difference = 0;
+    for (vertex_t v = 0; v < n_vertices; ++v)
+      difference = std::max(difference, std::abs(gpu_p[v] - q[v]));
+    return difference;
+  };
+
   // --
   // Log + Validate
 
   std::cout << "GPU p[:40] = ";
   gunrock::print::head<weight_t>(p, 40);
   std::cout << "GPU Elapsed Time : " << gpu_elapsed << " (ms)" << std::endl;
+
+  std::cout << "Host p[:40] = ";
+  gunrock::print::head<weight_t>(h_p, 40);
+  std::cout << "Host Elapsed Time : " << host_elapsed << " (ms)" << std::endl;
+  std::cout << "Max |GPU - Host| : " << max_difference(h_p) << std::endl;
+
+  std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms), "
+            << stats.iterations << " iterations" << std::endl;
+  std::cout << "Max |GPU - CPU| : " << max_difference(c_p) << std::endl;
+  std::cout << "CPU Delta Elapsed Time : " << delta_elapsed << " (ms), "
+            << delta_stats.iterations << " iterations" << std::endl;
+  std::cout << "Max |GPU - CPU Delta| : " << max_difference(d_p) << std::endl;
+
+  std::cout << "CPU L1 residuals (per iteration) = ";
+  for (auto residual : stats.residuals)
+    std::cout << residual << " ";
+  std::cout << std::endl;
+  std::cout << "CPU Delta L1 residuals (per iteration) = ";
+  for (std::size_t i = 0; i < delta_stats.residuals.size(); ++i)
+    std::cout << delta_stats.residuals[i]
+              << ((delta_stats.directions[i] == gunrock::pr::cpu::push)
+                      ? "(push) "
+                      : "(pull) ");
+  std::cout << std::endl;
 }
 
 int main(int argc, char** argv) {
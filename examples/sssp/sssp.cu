@@ -26,8 +26,13 @@ void test_sssp(int num_arguments, char** argument_array) {
 
   using csr_t =
       format::csr_t<memory_space_t::device, vertex_t, edge_t, weight_t>;
+  auto coo = mm.load(filename);
+
   csr_t csr;
-  csr.from_coo(mm.load(filename));
+  csr.from_coo(coo);
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> h_csr;
+  h_csr.from_coo(coo);
 
   // --
   // Build graph
@@ -41,6 +46,15 @@ void test_sssp(int num_arguments, char** argument_array) {
       csr.nonzero_values.data().get()   // values
   );  // supports row_indices and column_offsets (default = nullptr)
 
+  auto H = graph::build::from_csr<memory_space_t::host, graph::view_t::csr>(
+      h_csr.number_of_rows,         // rows
+      h_csr.number_of_columns,      // columns
+      h_csr.number_of_nonzeros,     // nonzeros
+      h_csr.row_offsets.data(),     // row_offsets
+      h_csr.column_indices.data(),  // column_indices
+      h_csr.nonzero_values.data()   // values
+  );
+
   // --
   // Params and memory allocation
   srand(time(NULL));
@@ -68,6 +82,25 @@ void test_sssp(int num_arguments, char** argument_array) {
 
   int n_errors = sssp_cpu::compute_error(distances, h_distances);
 
+  thrust::host_vector<weight_t> ds_distances(n_vertices);
+  thrust::host_vector<vertex_t> ds_predecessors(n_vertices);
+  gunrock::sssp::cpu::stats_t<weight_t> stats;
+
+  float ds_elapsed = sssp_cpu::run_delta_stepping(
+      H, single_source, ds_distances.data(), ds_predecessors.data(), &stats);
+
+  int n_ds_errors = sssp_cpu::compute_error(distances, ds_distances);
+
+  // --
+  // Host Run (the same application on the host backend)
+
+  thrust::host_vector<weight_t> e_distances(n_vertices);
+  thrust::host_vector<vertex_t> e_predecessors(n_vertices);
+
+  float host_elapsed = gunrock::sssp::run(H, single_source, e_distances.data(),
+                                          e_predecessors.data());
+  int n_host_errors = sssp_cpu::compute_error(distances, e_distances);
+
   // --
   // Log + Validate
 
@@ -80,6 +113,12 @@ void test_sssp(int num_arguments, char** argument_array) {
   std::cout << "GPU Elapsed Time : " << gpu_elapsed << " (ms)" << std::endl;
   std::cout << "CPU Elapsed Time : " << cpu_elapsed << " (ms)" << std::endl;
   std::cout << "Number of errors : " << n_errors << std::endl;
+  std::cout << "Delta-Stepping Elapsed Time : " << ds_elapsed << " (ms)"
+            << " (delta = " << stats.delta << ", buckets = " << stats.buckets
+            << ")" << std::endl;
+  std::cout << "Delta-Stepping errors : " << n_ds_errors << std::endl;
+  std::cout << "Host Elapsed Time : " << host_elapsed << " (ms)" << std::endl;
+  std::cout << "Host errors : " << n_host_errors << std::endl;
 }
 
 int main(int argc, char** argv) {
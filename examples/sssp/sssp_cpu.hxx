@@ -4,6 +4,8 @@
 #include <vector>
 #include <queue>
 
+#include <gunrock/applications/cpu/sssp.hxx>
+
 namespace sssp_cpu {
 
 using namespace std;
@@ -46,10 +48,13 @@ float run(csr_t& csr,
     vertex_t curr_node = curr.first;
     weight_t curr_dist = curr.second;
 
-    vertex_t start = row_offsets[curr_node];
-    vertex_t end = row_offsets[curr_node + 1];
+    if (curr_dist > distances[curr_node])
+      continue;  // stale entry (lazy deletion).
+
+    edge_t start = row_offsets[curr_node];
+    edge_t end = row_offsets[curr_node + 1];
 
-    for (vertex_t offset = start; offset < end; offset++) {
+    for (edge_t offset = start; offset < end; offset++) {
       vertex_t neib = column_indices[offset];
       weight_t new_dist = curr_dist + nonzero_values[offset];
       if (new_dist < distances[neib]) {
@@ -64,6 +69,20 @@ float run(csr_t& csr,
   return (float)elapsed / 1000;
 }
 
+/**
+ * @brief Parallel delta-stepping SSSP on a host graph, see
+ * `gunrock::sssp::cpu::run`.
+ */
+template <typename graph_t, typename vertex_t, typename weight_t>
+float run_delta_stepping(graph_t& G,
+                         vertex_t& single_source,
+                         weight_t* distances,
+                         vertex_t* predecessors,
+                         gunrock::sssp::cpu::stats_t<weight_t>* stats) {
+  return gunrock::sssp::cpu::run(G, single_source, distances, predecessors,
+                                 weight_t(0) /* auto delta */, stats);
+}
+
 template <typename val_t>
 int compute_error(thrust::device_vector<val_t> _gpu_result,
                   thrust::host_vector<val_t> cpu_result) {
@@ -32,4 +32,5 @@ namespace algo {
 
 // Sort Algorithms
 #include <gunrock/algorithms/sort/radix_sort.hxx>
-#include <gunrock/algorithms/sort/stable_sort.hxx>
\ No newline at end of file
+#include <gunrock/algorithms/sort/stable_sort.hxx>
+#include <gunrock/algorithms/sort/host.hxx>
\ No newline at end of file
@@ -0,0 +1,145 @@
+/**
+ * @file erdos_renyi.hxx
+ * @brief Erdős–Rényi G(n, p) graph generator.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include <gunrock/algorithms/generate/random.hxx>
+#include <gunrock/algorithms/generate/weights.hxx>
+
+namespace gunrock {
+namespace algo {
+namespace generate {
+
+/**
+ * @brief Properties of an Erdős–Rényi graph.
+ */
+struct erdos_renyi_properties_t {
+  bool symmetric{false};   // undirected: (u, v) and (v, u) together.
+  bool self_loops{false};  // (u, u) may be an edge.
+  erdos_renyi_properties_t() = default;
+};
+
+/**
+ * @brief Erdős–Rényi G(n, p) generator: every (ordered, or unordered if
+ * symmetric) pair of vertices is an edge with probability `p`, about
+ * `p * n^2` edges in total; see `erdos_renyi_t::with_average_degree()`.
+ *
+ * @par Overview
+ * Row `u` is sampled on its own, by geometric skips over its candidate
+ * columns (`O(degree)` per row rather than `O(n)`), using the `u`-th stream
+ * of a counter-based generator (see `random::counter_t`). A row, and so the
+ * graph, only depends on the seed. Symmetric graphs sample the columns
+ * greater than `u` and emit both directions. See `to_coo()` and `to_csr()`
+ * to generate the graph.
+ *
+ * @tparam vertex_t
+ * @tparam edge_t
+ * @tparam weight_t
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct erdos_renyi_t {
+  using vertex_type = vertex_t;
+  using edge_type = edge_t;
+  using weight_type = weight_t;
+
+  erdos_renyi_t(vertex_t _n,
+                double _p,
+                std::uint64_t _seed = 1,
+                erdos_renyi_properties_t _properties =
+                    erdos_renyi_properties_t(),
+                weights_t<weight_t> _weights = weights_t<weight_t>())
+      : n(_n),
+        p(_p),
+        seed(_seed),
+        properties(_properties),
+        weights(_weights),
+        weights_rng(_seed, 0),
+        log_q(std::log1p(-_p)) {}
+
+  /**
+   * @brief G(n, p) with `p` chosen for an expected out-degree of `degree`.
+   */
+  static erdos_renyi_t with_average_degree(
+      vertex_t n,
+      double degree,
+      std::uint64_t seed = 1,
+      erdos_renyi_properties_t properties = erdos_renyi_properties_t(),
+      weights_t<weight_t> weights = weights_t<weight_t>()) {
+    double candidates = properties.self_loops ? n : n - 1;
+    double p = (candidates > 0) ? std::fmin(1.0, degree / candidates) : 0;
+    return erdos_renyi_t(n, p, seed, properties, weights);
+  }
+
+  vertex_t get_number_of_vertices() const { return n; }
+
+  /**
+   * @brief Number of samples (the rows), see `sample()`.
+   */
+  std::uint64_t get_number_of_samples() const { return n; }
+
+  /**
+   * @brief Edges emitted by every sample (0 if it varies).
+   */
+  std::size_t get_edges_per_sample() const { return 0; }
+
+  /**
+   * @brief Call `op(source, destination, weight)` for the edges of sample
+   * `u`: the sampled columns of row `u` (and their reverses if symmetric).
+   */
+  template <typename operator_t>
+  void sample(std::uint64_t u, operator_t op) const {
+    // Candidate columns [first, n), without u unless self-loops are allowed.
+    std::uint64_t first =
+        properties.symmetric ? (properties.self_loops ? u : u + 1) : 0;
+    bool skip_u = !properties.symmetric && !properties.self_loops;
+    std::uint64_t candidates = (std::uint64_t)n - first - (skip_u ? 1 : 0);
+    if (p <= 0 || first >= (std::uint64_t)n)
+      return;
+
+    random::counter_t rng(seed, u + 1);
+    std::uint64_t draw = 0;
+    for (std::uint64_t k = 0;; ++k) {
+      if (p < 1) {
+        // Skip a geometric number of candidates.
+        double skip = std::floor(std::log1p(-rng.uniform(draw++)) / log_q);
+        if (skip >= (double)(candidates - k))
+          return;
+        k += (std::uint64_t)skip;
+      }
+      if (k >= candidates)
+        return;
+
+      std::uint64_t v = first + k;
+      if (skip_u && v >= u)
+        ++v;
+      weight_t w = weights(weights_rng, u * (std::uint64_t)n + v);
+      op((vertex_t)u, (vertex_t)v, w);
+      if (properties.symmetric && v != u)
+        op((vertex_t)v, (vertex_t)u, w);
+    }
+  }
+
+ private:
+  vertex_t n;
+  double p;
+  std::uint64_t seed;
+  erdos_renyi_properties_t properties;
+  weights_t<weight_t> weights;
+
+  random::counter_t weights_rng;
+  double log_q;  // log(1 - p).
+};  // struct erdos_renyi_t
+
+}  // namespace generate
+}  // namespace algo
+}  // namespace gunrock
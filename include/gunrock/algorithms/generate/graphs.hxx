@@ -0,0 +1,250 @@
+/**
+ * @file graphs.hxx
+ * @brief Parallel, seed-deterministic graph generation on the host (R-MAT,
+ * Erdős–Rényi, 2D grids) to COO or directly to CSR.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/memory.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/algorithms/scan/host.hxx>
+
+#include <gunrock/algorithms/generate/random.hxx>
+#include <gunrock/algorithms/generate/weights.hxx>
+#include <gunrock/algorithms/generate/rmat.hxx>
+#include <gunrock/algorithms/generate/erdos_renyi.hxx>
+#include <gunrock/algorithms/generate/grid.hxx>
+
+namespace gunrock {
+namespace algo {
+
+/**
+ * @namespace generate
+ * Graph generators. A generator (`rmat_t`, `erdos_renyi_t`, `grid_t`)
+ * describes its graph as a sequence of independent samples, each emitting a
+ * few edges with `sample(i, op)`; `to_coo()` and `to_csr()` run the samples
+ * in parallel. Every sample only depends on the seed and its index, and the
+ * output is laid out by sample index, so a seed gives the same graph for any
+ * number of threads.
+ */
+namespace generate {
+
+namespace detail {
+
+/*!
+ * Samples per block: the unit of work of the parallel loops, and of the
+ * layout of the generated edges (fixed, independent of the threads).
+ */
+constexpr std::uint64_t samples_per_block = 1 << 12;
+
+/**
+ * @brief Call `op(block, begin, end)` for every block of samples, in
+ * parallel.
+ */
+template <typename generator_t, typename operator_t>
+void for_each_block(generator_t const& generator, operator_t op) {
+  std::uint64_t samples = generator.get_number_of_samples();
+  std::int64_t blocks = (samples + samples_per_block - 1) / samples_per_block;
+#pragma omp parallel for schedule(dynamic, 1)
+  for (std::int64_t b = 0; b < blocks; ++b)
+    op(b, b * samples_per_block,
+       std::min(samples, (b + 1) * samples_per_block));
+}
+
+/**
+ * @brief Exit if `edges` (counted in 64 bits) does not fit in `edge_t`.
+ */
+template <typename edge_t>
+void check_number_of_edges(std::uint64_t edges) {
+  if (edges > (std::uint64_t)std::numeric_limits<edge_t>::max()) {
+    std::cerr << "Number of generated edges (" << edges
+              << ") does not fit in edge_t" << std::endl;
+    exit(1);
+  }
+}
+
+/**
+ * @brief First edge of every block of samples (and the number of edges at
+ * the end): known if every sample emits the same number of edges, otherwise
+ * counted (by running the samples) and scanned.
+ */
+template <typename generator_t, typename edge_t>
+edge_t block_offsets(generator_t const& generator,
+                     std::vector<edge_t>& offsets) {
+  using vertex_t = typename generator_t::vertex_type;
+  using weight_t = typename generator_t::weight_type;
+
+  std::uint64_t samples = generator.get_number_of_samples();
+  std::int64_t blocks = (samples + samples_per_block - 1) / samples_per_block;
+  offsets.assign(blocks + 1, 0);
+
+  std::size_t edges_per_sample = generator.get_edges_per_sample();
+  if (edges_per_sample) {
+    constexpr auto saturated = std::numeric_limits<std::uint64_t>::max();
+    check_number_of_edges<edge_t>((samples > saturated / edges_per_sample)
+                                      ? saturated
+                                      : samples * edges_per_sample);
+    for (std::int64_t b = 0; b <= blocks; ++b)
+      offsets[b] = (edge_t)(std::min(samples, b * samples_per_block) *
+                            edges_per_sample);
+    return offsets[blocks];
+  }
+
+  for_each_block(generator, [&](std::int64_t b, std::uint64_t begin,
+                                std::uint64_t end) {
+    std::uint64_t count = 0;
+    for (std::uint64_t i = begin; i < end; ++i)
+      generator.sample(i, [&](vertex_t const&, vertex_t const&,
+                              weight_t const&) { ++count; });
+    check_number_of_edges<edge_t>(count);
+    offsets[b] = (edge_t)count;
+  });
+
+  std::uint64_t edges = 0;
+  for (std::int64_t b = 0; b < blocks; ++b)
+    edges += offsets[b];
+  check_number_of_edges<edge_t>(edges);
+
+  edge_t total = scan::host::exclusive_scan(offsets.data(), blocks,
+                                            offsets.data(), edge_t(0));
+  offsets[blocks] = total;
+  return total;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Generate the graph of `generator` as a coordinate list, edges in
+ * sample order. Samples are run twice if their number of edges varies (once
+ * to count, once to write).
+ *
+ * @param generator e.g. `rmat_t`, `erdos_renyi_t`, `grid_t`.
+ * @return format::coo_t<memory_space_t::host, ...> the edges, weighted.
+ */
+template <typename generator_t>
+auto to_coo(generator_t const& generator) {
+  using vertex_t = typename generator_t::vertex_type;
+  using edge_t = typename generator_t::edge_type;
+  using weight_t = typename generator_t::weight_type;
+
+  std::vector<edge_t> offsets;
+  edge_t edges = detail::block_offsets(generator, offsets);
+  vertex_t n = generator.get_number_of_vertices();
+
+  format::coo_t<memory::memory_space_t::host, vertex_t, edge_t, weight_t> coo(
+      n, n, edges);
+  auto I = coo.row_indices.data();
+  auto J = coo.column_indices.data();
+  auto V = coo.nonzero_values.data();
+
+  detail::for_each_block(generator, [&](std::int64_t b, std::uint64_t begin,
+                                        std::uint64_t end) {
+    edge_t e = offsets[b];
+    for (std::uint64_t i = begin; i < end; ++i)
+      generator.sample(i, [&](vertex_t const& u, vertex_t const& v,
+                              weight_t const& w) {
+        I[e] = u;
+        J[e] = v;
+        V[e] = w;
+        ++e;
+      });
+  });
+
+  return coo;
+}
+
+/**
+ * @brief Generate the graph of `generator` directly as a CSR, without an
+ * intermediate coordinate list (for graphs too large to hold twice). Samples
+ * are run twice: once to count the degrees, once to place the edges (with
+ * atomics); rows are then sorted by column (and weight), which makes them
+ * independent of the placement order. Duplicates are kept.
+ *
+ * @param generator e.g. `rmat_t`, `erdos_renyi_t`, `grid_t`.
+ * @return format::csr_t<memory_space_t::host, ...> sorted CSR, weighted.
+ */
+template <typename generator_t>
+auto to_csr(generator_t const& generator) {
+  using vertex_t = typename generator_t::vertex_type;
+  using edge_t = typename generator_t::edge_type;
+  using weight_t = typename generator_t::weight_type;
+
+  vertex_t n = generator.get_number_of_vertices();
+  format::csr_t<memory::memory_space_t::host, vertex_t, edge_t, weight_t> csr(
+      n, n, 0);
+  auto Ap = csr.row_offsets.data();
+  std::fill(Ap, Ap + n + 1, edge_t(0));
+
+  // Counted in 64 bits as well: a degree fits in `edge_t` if the total does.
+  std::uint64_t counted = 0;
+  detail::for_each_block(generator, [&](std::int64_t, std::uint64_t begin,
+                                        std::uint64_t end) {
+    std::uint64_t count = 0;
+    for (std::uint64_t i = begin; i < end; ++i)
+      generator.sample(i, [&](vertex_t const& u, vertex_t const&,
+                              weight_t const&) {
+        __atomic_fetch_add(&Ap[u], edge_t(1), __ATOMIC_RELAXED);
+        ++count;
+      });
+    __atomic_fetch_add(&counted, count, __ATOMIC_RELAXED);
+  });
+  detail::check_number_of_edges<edge_t>(counted);
+
+  edge_t edges = scan::host::exclusive_scan(Ap, n, Ap, edge_t(0));
+  Ap[n] = edges;
+  csr.number_of_nonzeros = edges;
+  csr.column_indices.resize(edges);
+  csr.nonzero_values.resize(edges);
+  auto Aj = csr.column_indices.data();
+  auto Ax = csr.nonzero_values.data();
+
+  std::vector<edge_t> cursors(Ap, Ap + n);
+  auto cursor = cursors.data();
+  detail::for_each_block(generator, [&](std::int64_t, std::uint64_t begin,
+                                        std::uint64_t end) {
+    for (std::uint64_t i = begin; i < end; ++i)
+      generator.sample(i, [&](vertex_t const& u, vertex_t const& v,
+                              weight_t const& w) {
+        edge_t e = __atomic_fetch_add(&cursor[u], edge_t(1), __ATOMIC_RELAXED);
+        Aj[e] = v;
+        Ax[e] = w;
+      });
+  });
+
+#pragma omp parallel
+  {
+    std::vector<std::pair<vertex_t, weight_t>> row;
+#pragma omp for schedule(dynamic, 1024)
+    for (std::int64_t u = 0; u < (std::int64_t)n; ++u) {
+      row.clear();
+      for (edge_t e = Ap[u]; e < Ap[u + 1]; ++e)
+        row.emplace_back(Aj[e], Ax[e]);
+      std::sort(row.begin(), row.end());
+      for (std::size_t k = 0; k < row.size(); ++k) {
+        Aj[Ap[u] + k] = row[k].first;
+        Ax[Ap[u] + k] = row[k].second;
+      }
+    }
+  }
+
+  return csr;
+}
+
+}  // namespace generate
+}  // namespace algo
+}  // namespace gunrock
@@ -0,0 +1,122 @@
+/**
+ * @file grid.hxx
+ * @brief 2D grid and road-like graph generator.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <gunrock/algorithms/generate/random.hxx>
+#include <gunrock/algorithms/generate/weights.hxx>
+
+namespace gunrock {
+namespace algo {
+namespace generate {
+
+/**
+ * @brief Properties of a grid graph. The defaults give a full 2D grid
+ * (4-neighborhood); removing edges and adding some diagonals gives road-like
+ * graphs (low, irregular degrees, large diameter).
+ */
+struct grid_properties_t {
+  double removal_probability{0};   // of every horizontal or vertical edge.
+  double diagonal_probability{0};  // of every (down-right) diagonal edge.
+  grid_properties_t() = default;
+};
+
+/**
+ * @brief Undirected 2D grid generator: `width * height` vertices, vertex
+ * `(x, y)` is `y * width + x` and is linked to its right and down neighbors
+ * (and, with some probability, to its down-right one). Every undirected edge
+ * is emitted in both directions, with the same weight.
+ *
+ * @par Overview
+ * Vertex `v` has up to 3 undirected edges, `3v` (right), `3v + 1` (down) and
+ * `3v + 2` (diagonal); whether an edge exists, and its weight, are drawn from
+ * its id with counter-based streams (see `random::counter_t`), so the graph
+ * only depends on the seed. See `to_coo()` and `to_csr()` to generate the
+ * graph.
+ *
+ * @tparam vertex_t
+ * @tparam edge_t
+ * @tparam weight_t
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct grid_t {
+  using vertex_type = vertex_t;
+  using edge_type = edge_t;
+  using weight_type = weight_t;
+
+  grid_t(vertex_t _width,
+         vertex_t _height,
+         std::uint64_t seed = 1,
+         grid_properties_t _properties = grid_properties_t(),
+         weights_t<weight_t> _weights = weights_t<weight_t>())
+      : width(_width),
+        height(_height),
+        properties(_properties),
+        weights(_weights),
+        edges_rng(seed, 0),
+        weights_rng(seed, 1) {}
+
+  vertex_t get_number_of_vertices() const { return width * height; }
+
+  /**
+   * @brief Number of samples (the vertices), see `sample()`.
+   */
+  std::uint64_t get_number_of_samples() const {
+    return (std::uint64_t)width * height;
+  }
+
+  /**
+   * @brief Edges emitted by every sample (0 if it varies).
+   */
+  std::size_t get_edges_per_sample() const { return 0; }
+
+  /**
+   * @brief Call `op(source, destination, weight)` for the edges of sample
+   * `v`: its right, down and diagonal edges that exist, both directions.
+   */
+  template <typename operator_t>
+  void sample(std::uint64_t v, operator_t op) const {
+    std::uint64_t x = v % width;
+    std::uint64_t y = v / width;
+    bool right = (x + 1 < (std::uint64_t)width);
+    bool down = (y + 1 < (std::uint64_t)height);
+
+    auto link = [&](std::uint64_t id, std::uint64_t u, double probability) {
+      if (edges_rng.uniform(id) >= probability)
+        return;
+      weight_t w = weights(weights_rng, id);
+      op((vertex_t)v, (vertex_t)u, w);
+      op((vertex_t)u, (vertex_t)v, w);
+    };
+
+    double keep = 1 - properties.removal_probability;
+    if (right)
+      link(3 * v, v + 1, keep);
+    if (down)
+      link(3 * v + 1, v + width, keep);
+    if (right && down)
+      link(3 * v + 2, v + width + 1, properties.diagonal_probability);
+  }
+
+ private:
+  vertex_t width;
+  vertex_t height;
+  grid_properties_t properties;
+  weights_t<weight_t> weights;
+
+  random::counter_t edges_rng;
+  random::counter_t weights_rng;
+};  // struct grid_t
+
+}  // namespace generate
+}  // namespace algo
+}  // namespace gunrock
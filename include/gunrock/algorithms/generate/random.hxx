@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/random.h>
 
@@ -24,8 +26,45 @@ void uniform_distribution(index_t begin, index_t end, iterator_t input) {
                     thrust::make_counting_iterator(end), input,
                     generate_random);
 }
+
+/**
+ * @brief SplitMix64 finalizer, a bijective 64-bit mix.
+ */
+__host__ __device__ inline std::uint64_t mix(std::uint64_t x) {
+  x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+  x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+  return x ^ (x >> 31);
+}
+
+/**
+ * @brief Counter-based random numbers: the `i`-th number of a stream is a
+ * hash of the seed, the stream and `i`, and does not depend on any other
+ * number drawn. Parallel generators index their draws (e.g. by edge id) and
+ * produce the same numbers for any number of threads and in any order.
+ */
+struct counter_t {
+  std::uint64_t key;
+
+  __host__ __device__ counter_t(std::uint64_t seed, std::uint64_t stream = 0)
+      : key(mix(seed ^ mix(stream + 0x9e3779b97f4a7c15ull))) {}
+
+  /**
+   * @brief `i`-th 64-bit number of the stream.
+   */
+  __host__ __device__ std::uint64_t operator()(std::uint64_t i) const {
+    return mix(key + i * 0x9e3779b97f4a7c15ull);
+  }
+
+  /**
+   * @brief `i`-th number of the stream, uniform in [0, 1).
+   */
+  __host__ __device__ double uniform(std::uint64_t i) const {
+    return (double)((*this)(i) >> 11) * 0x1.0p-53;
+  }
+};
+
 }  // namespace random
 }  // namespace generate
 
 }  // namespace algo
-}  // namespace gunrock
\ No newline at end of file
+}  // namespace gunrock
@@ -0,0 +1,164 @@
+/**
+ * @file rmat.hxx
+ * @brief R-MAT (recursive matrix, Graph500 Kronecker) graph generator.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <gunrock/algorithms/generate/random.hxx>
+#include <gunrock/algorithms/generate/weights.hxx>
+
+namespace gunrock {
+namespace algo {
+namespace generate {
+
+/**
+ * @brief Properties of an R-MAT graph, the defaults are Graph500's: quadrant
+ * probabilities `a`, `b`, `c` (and `d = 1 - a - b - c`), scrambled vertex
+ * ids, directed edges.
+ */
+struct rmat_properties_t {
+  double a{0.57};
+  double b{0.19};
+  double c{0.19};
+  bool scramble{true};    // permute vertex ids (hides the id-degree skew).
+  bool symmetric{false};  // also emit (v, u) for every edge (u, v).
+  rmat_properties_t() = default;
+};
+
+/**
+ * @brief R-MAT generator: `2^scale` vertices and `edge_factor * 2^scale`
+ * edges (twice as many if symmetric), each placed by descending `scale`
+ * levels of the adjacency matrix and picking a quadrant with probabilities
+ * `a`, `b`, `c`, `d` at every level. Self-loops and duplicates are kept, as
+ * in Graph500.
+ *
+ * @par Overview
+ * Edge `e` only depends on the seed and `e`: its quadrants are drawn from the
+ * `e`-th numbers of a counter-based stream (see `random::counter_t`, two
+ * levels per 64-bit number), and its weight from another. Vertex ids are
+ * scrambled with a seeded bijection of `[0, 2^scale)`. See `to_coo()` and
+ * `to_csr()` to generate the graph.
+ *
+ * @tparam vertex_t
+ * @tparam edge_t
+ * @tparam weight_t
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct rmat_t {
+  using vertex_type = vertex_t;
+  using edge_type = edge_t;
+  using weight_type = weight_t;
+
+  rmat_t(int _scale,
+         edge_t _edge_factor = 16,
+         std::uint64_t seed = 1,
+         rmat_properties_t _properties = rmat_properties_t(),
+         weights_t<weight_t> _weights = weights_t<weight_t>())
+      : scale(_scale),
+        edge_factor(_edge_factor),
+        properties(_properties),
+        weights(_weights),
+        edges_rng(seed, 0),
+        weights_rng(seed, 1),
+        scramble_rng(seed, 2),
+        mask((std::uint64_t(1) << _scale) - 1),
+        draws((_scale + 1) / 2),
+        a(threshold(_properties.a)),
+        ab(threshold(_properties.a + _properties.b)),
+        abc(threshold(_properties.a + _properties.b + _properties.c)) {}
+
+  vertex_t get_number_of_vertices() const { return (vertex_t)(mask + 1); }
+
+  /**
+   * @brief Number of samples, see `sample()`.
+   */
+  std::uint64_t get_number_of_samples() const {
+    return (std::uint64_t)edge_factor << scale;
+  }
+
+  /**
+   * @brief Edges emitted by every sample (0 if it varies).
+   */
+  std::size_t get_edges_per_sample() const {
+    return properties.symmetric ? 2 : 1;
+  }
+
+  /**
+   * @brief Call `op(source, destination, weight)` for the edges of sample
+   * `i`: edge `i` (and its reverse if symmetric).
+   */
+  template <typename operator_t>
+  void sample(std::uint64_t i, operator_t op) const {
+    std::uint64_t u = 0, v = 0;
+    std::uint64_t bits = 0;
+    for (int level = 0; level < scale; ++level) {
+      // 32 random bits per level, two levels per number.
+      if (level & 1)
+        bits >>= 32;
+      else
+        bits = edges_rng(i * draws + level / 2);
+      std::uint64_t r = bits & 0xffffffffull;
+      std::uint64_t row = (r >= ab);
+      std::uint64_t column = (std::uint64_t)(r >= a) ^ row ^ (r >= abc);
+      u = (u << 1) | row;
+      v = (v << 1) | column;
+    }
+
+    if (properties.scramble) {
+      u = permute(u);
+      v = permute(v);
+    }
+
+    weight_t w = weights(weights_rng, i);
+    op((vertex_t)u, (vertex_t)v, w);
+    if (properties.symmetric)
+      op((vertex_t)v, (vertex_t)u, w);
+  }
+
+ private:
+  static std::uint64_t threshold(double probability) {
+    return (std::uint64_t)(probability * 0x1.0p32);
+  }
+
+  /**
+   * @brief Seeded bijection of `[0, 2^scale)`: odd multiplications and
+   * xor-shifts modulo `2^scale`.
+   */
+  std::uint64_t permute(std::uint64_t x) const {
+    int shift = (scale + 1) / 2;
+    for (std::uint64_t round = 0; round < 2; ++round) {
+      x = ((x ^ scramble_rng(2 * round)) * (scramble_rng(2 * round + 1) | 1)) &
+          mask;
+      x ^= x >> shift;
+    }
+    return x;
+  }
+
+  int scale;
+  edge_t edge_factor;
+  rmat_properties_t properties;
+  weights_t<weight_t> weights;
+
+  random::counter_t edges_rng;
+  random::counter_t weights_rng;
+  random::counter_t scramble_rng;
+  std::uint64_t mask;   // 2^scale - 1.
+  std::uint64_t draws;  // random numbers per edge.
+
+  // Quadrant thresholds, out of 2^32.
+  std::uint64_t a;
+  std::uint64_t ab;
+  std::uint64_t abc;
+};  // struct rmat_t
+
+}  // namespace generate
+}  // namespace algo
+}  // namespace gunrock
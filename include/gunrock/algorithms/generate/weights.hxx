@@ -0,0 +1,76 @@
+/**
+ * @file weights.hxx
+ * @brief Edge weight distributions of the graph generators.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+#include <gunrock/algorithms/generate/random.hxx>
+
+namespace gunrock {
+namespace algo {
+namespace generate {
+
+/**
+ * @brief Distribution of the generated edge weights.
+ * - `constant`: every weight is `low`.
+ * - `uniform_real`: uniform in `[low, high)`.
+ * - `uniform_integer`: uniform integer in `[low, high]`.
+ * - `exponential`: `low` plus an exponential of mean `high`.
+ */
+enum weight_distribution_t {
+  constant,
+  uniform_real,
+  uniform_integer,
+  exponential
+};  // enum: weight_distribution_t
+
+/**
+ * @brief Edge weights of a generator. The weight of an edge is drawn from its
+ * own counter (see `random::counter_t`), so it only depends on the seed and
+ * the edge.
+ *
+ * @tparam weight_t
+ */
+template <typename weight_t>
+struct weights_t {
+  weight_distribution_t distribution;
+  double low;
+  double high;
+
+  weights_t(weight_distribution_t _distribution = constant,
+            double _low = 1,
+            double _high = 1)
+      : distribution(_distribution), low(_low), high(_high) {}
+
+  /**
+   * @brief Weight of the edge drawn with the `i`-th number of `rng`.
+   */
+  weight_t operator()(random::counter_t const& rng, std::uint64_t i) const {
+    switch (distribution) {
+      case uniform_real:
+        return (weight_t)(low + (high - low) * rng.uniform(i));
+      case uniform_integer:
+        return (weight_t)(std::floor(low) +
+                          (double)(rng(i) % (std::uint64_t)(std::floor(high) -
+                                                            std::floor(low) +
+                                                            1)));
+      case exponential:
+        return (weight_t)(low - high * std::log1p(-rng.uniform(i)));
+      default:
+        return (weight_t)low;
+    }
+  }
+};
+
+}  // namespace generate
+}  // namespace algo
+}  // namespace gunrock
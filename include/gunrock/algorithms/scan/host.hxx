@@ -0,0 +1,150 @@
+/**
+ * @file host.hxx
+ * @brief Parallel (OpenMP) scan on the host.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include <omp.h>
+
+#include <gunrock/container/scratch.hxx>
+
+namespace gunrock {
+namespace algo {
+namespace scan {
+
+/**
+ * @namespace host
+ * Namespace for host (CPU, system) related functions. These maybe serial or
+ * parallel using openmp.
+ */
+namespace host {
+
+/**
+ * @brief Exclusive prefix sum of `input[0, count)` into `output[0, count)`
+ * (may be the same array). Three phases: every thread sums a contiguous
+ * block, the block sums are scanned serially, and every thread scans its own
+ * block starting at its block's offset. Small inputs are scanned serially.
+ *
+ * @param input input array.
+ * @param count number of elements.
+ * @param output output array (`output[i]` = sum of `input[0, i)`).
+ * @param initial value added to all the outputs.
+ * @return output_t total sum, `initial + sum of input[0, count)`.
+ */
+template <typename input_t, typename output_t, typename int_t>
+output_t exclusive_scan(input_t const* input,
+                        int_t const& count,
+                        output_t* output,
+                        output_t initial = output_t(0)) {
+  constexpr std::int64_t serial_threshold = 1 << 16;
+  std::int64_t n = (std::int64_t)count;
+  int number_of_blocks = std::max(
+      1, (int)std::min<std::int64_t>(omp_get_max_threads(),
+                                     n / serial_threshold));
+
+  if (number_of_blocks == 1) {
+    output_t sum = initial;
+    for (std::int64_t i = 0; i < n; ++i) {
+      output_t value = (output_t)input[i];
+      output[i] = sum;
+      sum += value;
+    }
+    return sum;
+  }
+
+  struct block_sums_tag_t {};  // reused across calls, see `get_scratch()`.
+  output_t* block_sums =
+      get_scratch<output_t, block_sums_tag_t>(number_of_blocks + 1);
+  auto block_begin = [&](int b) { return (n * b) / number_of_blocks; };
+
+#pragma omp parallel num_threads(number_of_blocks)
+  {
+#pragma omp for schedule(static)
+    for (int b = 0; b < number_of_blocks; ++b) {
+      output_t sum = 0;
+      for (std::int64_t i = block_begin(b); i < block_begin(b + 1); ++i)
+        sum += (output_t)input[i];
+      block_sums[b + 1] = sum;
+    }
+
+#pragma omp single
+    {
+      block_sums[0] = initial;
+      for (int b = 0; b < number_of_blocks; ++b)
+        block_sums[b + 1] += block_sums[b];
+    }
+
+#pragma omp for schedule(static)
+    for (int b = 0; b < number_of_blocks; ++b) {
+      output_t sum = block_sums[b];
+      for (std::int64_t i = block_begin(b); i < block_begin(b + 1); ++i) {
+        output_t value = (output_t)input[i];
+        output[i] = sum;
+        sum += value;
+      }
+    }
+  }
+
+  return block_sums[number_of_blocks];
+}
+
+/**
+ * @brief Inclusive prefix sum of `input[0, count)` into `output[0, count)`
+ * (may be the same array), see `exclusive_scan()`.
+ *
+ * @return output_t total sum.
+ */
+template <typename input_t, typename output_t, typename int_t>
+output_t inclusive_scan(input_t const* input,
+                        int_t const& count,
+                        output_t* output) {
+  constexpr std::int64_t serial_threshold = 1 << 16;
+  std::int64_t n = (std::int64_t)count;
+  int number_of_blocks = std::max(
+      1, (int)std::min<std::int64_t>(omp_get_max_threads(),
+                                     n / serial_threshold));
+
+  struct block_sums_tag_t {};
+  output_t* block_sums =
+      get_scratch<output_t, block_sums_tag_t>(number_of_blocks + 1);
+  block_sums[0] = output_t(0);
+  auto block_begin = [&](int b) { return (n * b) / number_of_blocks; };
+
+#pragma omp parallel num_threads(number_of_blocks)
+  {
+#pragma omp for schedule(static)
+    for (int b = 0; b < number_of_blocks; ++b) {
+      output_t sum = 0;
+      for (std::int64_t i = block_begin(b); i < block_begin(b + 1); ++i) {
+        sum += (output_t)input[i];
+        output[i] = sum;
+      }
+      block_sums[b + 1] = sum;
+    }
+
+#pragma omp single
+    for (int b = 0; b < number_of_blocks; ++b)
+      block_sums[b + 1] += block_sums[b];
+
+#pragma omp for schedule(static)
+    for (int b = 1; b < number_of_blocks; ++b)
+      for (std::int64_t i = block_begin(b); i < block_begin(b + 1); ++i)
+        output[i] += block_sums[b];
+  }
+
+  return block_sums[number_of_blocks];
+}
+
+}  // namespace host
+}  // namespace scan
+}  // namespace algo
+}  // namespace gunrock
@@ -17,6 +17,8 @@
 #include <moderngpu/cta_segscan.hxx>
 #include <moderngpu/kernel_scan.hxx>
 
+#include <gunrock/algorithms/scan/host.hxx>
+
 namespace gunrock {
 namespace algo {
 
@@ -33,11 +35,6 @@ enum scan_t
   exclusive
 };
 
-namespace host
-{
-  // XXX: CPU scan
-} // namespace: host
-
 namespace device {
 
 template<scan_t scan_type,
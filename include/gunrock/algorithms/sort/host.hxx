@@ -0,0 +1,91 @@
+/**
+ * @file host.hxx
+ * @brief Parallel (OpenMP) sort on the host.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+
+#include <omp.h>
+
+#include <gunrock/container/scratch.hxx>
+#include <gunrock/algorithms/sort/radix_sort.hxx>
+
+namespace gunrock {
+namespace sort {
+
+/**
+ * @namespace host
+ * Namespace for host (CPU, system) sort, parallel using openmp.
+ */
+namespace host {
+
+/**
+ * @brief Sort `keys[0, num_items)`. Every thread sorts a contiguous block,
+ * then sorted runs are merged pairwise (in parallel, through a scratch copy
+ * reused across calls) until one run is left. Small inputs are sorted
+ * serially.
+ */
+template <typename type_t>
+void sort_keys(type_t* keys,
+               std::size_t num_items,
+               order_t order = order_t::ascending) {
+  constexpr std::size_t serial_threshold = 1 << 16;
+  std::int64_t n = (std::int64_t)num_items;
+  int number_of_blocks = std::max(
+      1, (int)std::min<std::int64_t>(omp_get_max_threads(),
+                                     n / serial_threshold));
+
+  auto sort_range = [order](type_t* first, type_t* last) {
+    if (order == order_t::ascending)
+      std::sort(first, last, std::less<type_t>());
+    else
+      std::sort(first, last, std::greater<type_t>());
+  };
+
+  if (number_of_blocks == 1) {
+    sort_range(keys, keys + n);
+    return;
+  }
+
+  struct bounds_tag_t {};
+  std::int64_t* bounds =
+      get_scratch<std::int64_t, bounds_tag_t>(number_of_blocks + 1);
+  for (int b = 0; b <= number_of_blocks; ++b)
+    bounds[b] = (n * b) / number_of_blocks;
+
+#pragma omp parallel for schedule(static) num_threads(number_of_blocks)
+  for (int b = 0; b < number_of_blocks; ++b)
+    sort_range(keys + bounds[b], keys + bounds[b + 1]);
+
+  struct merged_tag_t {};
+  type_t* merged = get_scratch<type_t, merged_tag_t>(n);
+  for (int width = 1; width < number_of_blocks; width *= 2) {
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int b = 0; b < number_of_blocks - width; b += 2 * width) {
+      int last = std::min(b + 2 * width, number_of_blocks);
+      type_t* first = keys + bounds[b];
+      type_t* middle = keys + bounds[b + width];
+      type_t* end = keys + bounds[last];
+      if (order == order_t::ascending)
+        std::merge(first, middle, middle, end, merged + bounds[b],
+                   std::less<type_t>());
+      else
+        std::merge(first, middle, middle, end, merged + bounds[b],
+                   std::greater<type_t>());
+      std::copy(merged + bounds[b], merged + bounds[last], first);
+    }
+  }
+}
+
+}  // namespace host
+}  // namespace sort
+}  // namespace gunrock
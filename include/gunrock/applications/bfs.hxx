@@ -46,16 +46,29 @@ struct problem_t : gunrock::problem_t<graph_t> {
   using edge_t = typename graph_t::edge_type;
   using weight_t = typename graph_t::weight_type;
 
-  thrust::device_vector<vertex_t> visited;  /// @todo not used.
+  vector_t<vertex_t, graph_t::memory_space()> visited;  /// @todo not used.
 
   void init() override {}
 
   void reset() override {
     auto n_vertices = this->get_graph().get_number_of_vertices();
-    auto d_distances = thrust::device_pointer_cast(this->result.distances);
-    thrust::fill(thrust::device, d_distances + 0, d_distances + n_vertices, -1);
-    thrust::fill(thrust::device, d_distances + this->param.single_source,
-                 d_distances + this->param.single_source + 1, 0);
+    auto policy = this->get_execution_policy();
+    auto distances = this->result.distances;
+    thrust::fill(policy, distances + 0, distances + n_vertices, -1);
+    thrust::fill(policy, distances + this->param.single_source,
+                 distances + this->param.single_source + 1, 0);
+  }
+
+  void reset_vertices(vertex_t const* vertices, std::size_t size) override {
+    auto policy = this->get_execution_policy();
+    auto distances = this->result.distances;
+    thrust::for_each(policy, vertices, vertices + size,
+                     [distances] __host__ __device__(vertex_t const& v) {
+                       if (gunrock::util::limits::is_valid(v))
+                         distances[v] = -1;
+                     });
+    thrust::fill(policy, distances + this->param.single_source,
+                 distances + this->param.single_source + 1, 0);
   }
 };
 
@@ -68,8 +81,9 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
   using vertex_t = typename problem_t::vertex_t;
   using edge_t = typename problem_t::edge_t;
   using weight_t = typename problem_t::weight_t;
+  using frontier_type = typename gunrock::enactor_t<problem_t>::frontier_type;
 
-  void prepare_frontier(frontier_t<vertex_t>* f,
+  void prepare_frontier(frontier_type* f,
                         cuda::multi_context_t& context) override {
     auto P = this->get_problem();
     f->push_back(P->param.single_source);
@@ -83,7 +97,7 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
     auto single_source = P->param.single_source;
     auto distances = P->result.distances;
-    auto visited = P->visited.data().get();
+    auto visited = memory::raw_pointer_cast(P->visited.data());
 
     auto iteration = this->iteration;
 
@@ -123,8 +137,8 @@ template <typename graph_t>
 float run(graph_t& G,
           typename graph_t::vertex_type& single_source,  // Parameter
           typename graph_t::vertex_type* distances,      // Output
-          typename graph_t::vertex_type* predecessors    // Output
-) {
+          typename graph_t::vertex_type* predecessors,   // Output
+          enactor_properties_t properties = enactor_properties_t()) {
   // <user-defined>
   using vertex_t = typename graph_t::vertex_type;
   using param_type = param_t<vertex_t>;
@@ -136,7 +150,8 @@ float run(graph_t& G,
 
   // <boiler-plate>
   auto multi_context =
-      std::shared_ptr<cuda::multi_context_t>(new cuda::multi_context_t(0));
+      std::shared_ptr<cuda::multi_context_t>(new cuda::multi_context_t(
+          (G.memory_space() == memory_space_t::host) ? cuda::host_device : 0));
 
   using problem_type = problem_t<graph_t, param_type, result_type>;
   using enactor_type = enactor_t<problem_type>;
@@ -145,10 +160,41 @@ float run(graph_t& G,
   problem.init();
   problem.reset();
 
-  enactor_type enactor(&problem, multi_context);
+  enactor_type enactor(&problem, multi_context, properties);
   return enactor.enact();
   // </boiler-plate>
 }
 
+/**
+ * @brief Session answering many BFS queries on one graph, see
+ * `gunrock::session_t` and `make_session()`.
+ */
+template <typename graph_t,
+          typename vertex_t = typename graph_t::vertex_type,
+          typename problem_type =
+              problem_t<graph_t, param_t<vertex_t>, result_t<vertex_t>>>
+using session_t = gunrock::session_t<problem_type, enactor_t<problem_type>>;
+
+/**
+ * @brief Bind a query session to `G`, for many single-source queries in a
+ * row: `session.query(source)` writes `distances` like `run()`, but reuses
+ * the problem, the enactor and their buffers, and only resets the vertices
+ * visited by the previous query.
+ *
+ * @param G graph, must outlive the session.
+ * @param distances output, written by every query.
+ * @param predecessors output, written by every query.
+ * @return session_t<graph_t>
+ */
+template <typename graph_t>
+session_t<graph_t> make_session(
+    graph_t& G,
+    typename graph_t::vertex_type* distances,
+    typename graph_t::vertex_type* predecessors) {
+  using vertex_t = typename graph_t::vertex_type;
+  return session_t<graph_t>(G, param_t<vertex_t>(0),  // set per query.
+                            result_t<vertex_t>(distances, predecessors));
+}
+
 }  // namespace bfs
 }  // namespace gunrock
\ No newline at end of file
@@ -44,7 +44,7 @@ struct problem_t : gunrock::problem_t<graph_t> {
   using edge_t = typename graph_t::edge_type;
   using weight_t = typename graph_t::weight_type;
 
-  thrust::device_vector<vertex_t> randoms;
+  vector_t<vertex_t, graph_t::memory_space()> randoms;
 
   void init() override {
     auto g = this->get_graph();
@@ -57,8 +57,8 @@ struct problem_t : gunrock::problem_t<graph_t> {
   void reset() override {
     auto g = this->get_graph();
     auto n_vertices = g.get_number_of_vertices();
-    auto d_colors = thrust::device_pointer_cast(this->result.colors);
-    thrust::fill(thrust::device, d_colors + 0, d_colors + n_vertices,
+    auto colors = this->result.colors;
+    thrust::fill(this->get_execution_policy(), colors + 0, colors + n_vertices,
                  gunrock::numeric_limits<vertex_t>::invalid());
 
     // Generate random numbers.
@@ -74,9 +74,10 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
   using vertex_t = typename problem_t::vertex_t;
   using edge_t = typename problem_t::edge_t;
   using weight_t = typename problem_t::weight_t;
+  using frontier_type = typename gunrock::enactor_t<problem_t>::frontier_type;
 
   // <user-defined>
-  void prepare_frontier(frontier_t<vertex_t>* f,
+  void prepare_frontier(frontier_type* f,
                         cuda::multi_context_t& context) override {
     auto P = this->get_problem();
     auto n_vertices = P->get_graph().get_number_of_vertices();
@@ -92,7 +93,7 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
     auto G = P->get_graph();
 
     auto colors = P->result.colors;
-    auto randoms = P->randoms.data().get();
+    auto randoms = memory::raw_pointer_cast(P->randoms.data());
     auto iteration = E->iteration;
 
     auto color_me_in = [G, colors, randoms, iteration] __host__ __device__(
@@ -143,8 +144,8 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
 template <typename graph_t>
 float run(graph_t& G,
-          typename graph_t::vertex_type* colors  // Output
-) {
+          typename graph_t::vertex_type* colors,  // Output
+          enactor_properties_t properties = enactor_properties_t()) {
   // <user-defined>
   using vertex_t = typename graph_t::vertex_type;
 
@@ -157,7 +158,8 @@ float run(graph_t& G,
 
   // <boiler-plate>
   auto multi_context =
-      std::shared_ptr<cuda::multi_context_t>(new cuda::multi_context_t(0));
+      std::shared_ptr<cuda::multi_context_t>(new cuda::multi_context_t(
+          (G.memory_space() == memory_space_t::host) ? cuda::host_device : 0));
 
   using problem_type = problem_t<graph_t, param_type, result_type>;
   using enactor_type = enactor_t<problem_type>;
@@ -166,7 +168,7 @@ float run(graph_t& G,
   problem.init();
   problem.reset();
 
-  enactor_type enactor(&problem, multi_context);
+  enactor_type enactor(&problem, multi_context, properties);
   return enactor.enact();
   // </boiler-plate>
 }
@@ -0,0 +1,236 @@
+/**
+ * @file bfs.hxx
+ * @brief Direction-optimizing, level-synchronous Breadth-First Search on the
+ * host (OpenMP).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/util/math.hxx>
+#include <gunrock/applications/cpu/detail/gather.hxx>
+
+namespace gunrock {
+namespace bfs {
+namespace cpu {
+
+/**
+ * @brief Direction used to expand a level: top-down (push, from the frontier
+ * to its out-neighbors) or bottom-up (pull, every unvisited vertex looks for a
+ * parent in the frontier through its in-neighbors).
+ */
+enum direction_t { push, pull };
+
+/**
+ * @brief Direction switching heuristics (Beamer et al., "Direction-Optimizing
+ * Breadth-First Search", SC'12). Switch to pull when the edges out of the
+ * frontier exceed `1/alpha` of the edges left to explore, switch back to push
+ * when the frontier is shrinking and has less than `1/beta` of the vertices.
+ */
+struct options_t {
+  double alpha{15};
+  double beta{18};
+  options_t() = default;
+};
+
+/**
+ * @brief Per-level statistics, level `i` expanded `frontier_sizes[i]`
+ * vertices in direction `directions[i]`.
+ */
+template <typename vertex_t>
+struct stats_t {
+  std::vector<vertex_t> frontier_sizes;
+  std::vector<direction_t> directions;
+};
+
+/**
+ * @brief Direction-optimizing BFS. Levels are expanded top-down over the CSR
+ * from a sparse queue, or bottom-up over the CSC from a bitmap, whichever the
+ * frontier size heuristics (see `options_t`) favor. Graphs without a CSC view
+ * are always expanded top-down.
+ *
+ * @param G host graph (`graph::view_t::csr`, optionally `| csc`).
+ * @param single_source source vertex.
+ * @param distances output, depth of every vertex (-1 if unreachable).
+ * @param predecessors output, parent of every vertex in the BFS tree (-1 for
+ * the source and unreachable vertices).
+ * @param stats optional output, per-level frontier sizes and directions.
+ * @param options direction switching heuristics.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t& G,
+          typename graph_t::vertex_type const& single_source,
+          typename graph_t::vertex_type* distances,
+          typename graph_t::vertex_type* predecessors,
+          stats_t<typename graph_t::vertex_type>* stats = nullptr,
+          options_t options = options_t()) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using word_t = std::uint64_t;
+
+  constexpr bool has_csc =
+      std::is_base_of_v<typename graph_t::graph_csc_view_t, graph_t>;
+  constexpr vertex_t invalid = -1;
+  constexpr int bits = 64;
+
+  vertex_t n = G.get_number_of_vertices();
+  edge_t const* Ap = G.get_row_offsets();
+  vertex_t const* Aj = G.get_column_indices();
+
+  auto degree = [Ap](vertex_t v) { return (std::int64_t)(Ap[v + 1] - Ap[v]); };
+
+#pragma omp parallel for schedule(static)
+  for (vertex_t v = 0; v < n; ++v) {
+    distances[v] = invalid;
+    predecessors[v] = invalid;
+  }
+
+  if (stats) {
+    stats->frontier_sizes.clear();
+    stats->directions.clear();
+  }
+
+  auto t_start = std::chrono::high_resolution_clock::now();
+
+  std::size_t words = ((std::size_t)n + bits - 1) / bits;
+  std::vector<vertex_t> frontier(1, single_source);
+  std::vector<word_t> bitmap, next_bitmap;
+  std::vector<std::vector<vertex_t>> buffers(omp_get_max_threads());
+
+  distances[single_source] = 0;
+
+  bool sparse = true;  // frontier is in `frontier` (else, `bitmap`).
+  direction_t direction = push;
+  std::int64_t frontier_size = 1;
+  std::int64_t previous_size = 0;
+  std::int64_t frontier_edges = degree(single_source);
+  std::int64_t unexplored_edges = G.get_number_of_edges();
+
+  for (vertex_t level = 0; frontier_size > 0; ++level) {
+    if constexpr (has_csc) {
+      if (direction == push &&
+          frontier_edges > unexplored_edges / options.alpha)
+        direction = pull;
+      else if (direction == pull && frontier_size < previous_size &&
+               frontier_size < n / options.beta)
+        direction = push;
+    }
+
+    if (stats) {
+      stats->frontier_sizes.push_back((vertex_t)frontier_size);
+      stats->directions.push_back(direction);
+    }
+
+    unexplored_edges -= frontier_edges;
+    std::int64_t next_size = 0;
+    std::int64_t next_edges = 0;
+
+    if (direction == push) {
+      if (!sparse) {
+        // Bitmap to queue.
+#pragma omp parallel
+        {
+          auto& local = buffers[omp_get_thread_num()];
+          local.clear();
+#pragma omp for schedule(static)
+          for (std::size_t w = 0; w < words; ++w)
+            for (word_t b = bitmap[w]; b; b &= b - 1)
+              local.push_back((vertex_t)(w * bits + __builtin_ctzll(b)));
+        }
+        gunrock::cpu::detail::gather(buffers, frontier);
+        sparse = true;
+      }
+
+      // Top-down: claim unvisited out-neighbors of the frontier.
+#pragma omp parallel reduction(+ : next_size, next_edges)
+      {
+        auto& local = buffers[omp_get_thread_num()];
+        local.clear();
+#pragma omp for schedule(dynamic, 64)
+        for (std::size_t i = 0; i < frontier.size(); ++i) {
+          vertex_t u = frontier[i];
+          for (edge_t e = Ap[u]; e < Ap[u + 1]; ++e) {
+            vertex_t v = Aj[e];
+            if (__atomic_load_n(&distances[v], __ATOMIC_RELAXED) != invalid)
+              continue;
+            if (math::atomic::cas(&distances[v], invalid, level + 1) ==
+                invalid) {
+              predecessors[v] = u;
+              local.push_back(v);
+              next_edges += degree(v);
+            }
+          }
+        }
+        next_size += local.size();
+      }
+      gunrock::cpu::detail::gather(buffers, frontier);
+    } else {
+      if constexpr (has_csc) {
+        edge_t const* Ac = G.get_column_offsets();
+        vertex_t const* Ai = G.get_row_indices();
+
+        bitmap.resize(words);
+        next_bitmap.resize(words);
+
+        if (sparse) {
+          // Queue to bitmap.
+          std::fill(bitmap.begin(), bitmap.end(), word_t(0));
+#pragma omp parallel for schedule(static)
+          for (std::size_t i = 0; i < frontier.size(); ++i)
+            __atomic_fetch_or(&bitmap[frontier[i] / bits],
+                              word_t(1) << (frontier[i] % bits),
+                              __ATOMIC_RELAXED);
+          sparse = false;
+        }
+
+        // Bottom-up: every unvisited vertex looks for a parent in the
+        // frontier. A word of the bitmap is owned by a single thread.
+#pragma omp parallel for schedule(dynamic, 64) reduction(+ : next_size, next_edges)
+        for (std::size_t w = 0; w < words; ++w) {
+          word_t found = 0;
+          vertex_t end = (vertex_t)std::min<std::size_t>(n, (w + 1) * bits);
+          for (vertex_t v = (vertex_t)(w * bits); v < end; ++v) {
+            if (distances[v] != invalid)
+              continue;
+            for (edge_t k = Ac[v]; k < Ac[v + 1]; ++k) {
+              vertex_t u = Ai[k];
+              if (bitmap[u / bits] & (word_t(1) << (u % bits))) {
+                distances[v] = level + 1;
+                predecessors[v] = u;
+                found |= word_t(1) << (v % bits);
+                ++next_size;
+                next_edges += degree(v);
+                break;
+              }
+            }
+          }
+          next_bitmap[w] = found;
+        }
+        bitmap.swap(next_bitmap);
+      }
+    }
+
+    previous_size = frontier_size;
+    frontier_size = next_size;
+    frontier_edges = next_edges;
+  }
+
+  auto t_stop = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+}
+
+}  // namespace cpu
+}  // namespace bfs
+}  // namespace gunrock
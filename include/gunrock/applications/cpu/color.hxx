@@ -0,0 +1,200 @@
+/**
+ * @file color.hxx
+ * @brief Speculative greedy Graph Coloring on the host (OpenMP), with a
+ * shrinking worklist of conflicting vertices.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/applications/cpu/detail/gather.hxx>
+
+namespace gunrock {
+namespace color {
+namespace cpu {
+
+/**
+ * @brief Order in which the vertices are colored (and which of two
+ * conflicting vertices keeps its color).
+ * - `natural`: by vertex id.
+ * - `largest_degree_first`: by decreasing degree (ties by id); usually fewer
+ *   colors, since the most constrained vertices pick first.
+ */
+enum ordering_t { natural, largest_degree_first };
+
+struct options_t {
+  ordering_t ordering{natural};
+  options_t() = default;
+};
+
+/**
+ * @brief Statistics of a run: round `i` colored `worklists[i]` vertices (with
+ * `edges[i]` edges), of which `conflicts[i]` had to be colored again.
+ */
+template <typename vertex_t>
+struct stats_t {
+  vertex_t colors{0};  // colors used.
+  int rounds{0};
+  std::vector<std::size_t> worklists;
+  std::vector<std::size_t> edges;
+  std::vector<std::size_t> conflicts;
+};
+
+/**
+ * @brief Speculative parallel greedy coloring (Gebremedhin & Manne, 2000;
+ * Çatalyürek et al., 2012). Every round has two parallel passes over the
+ * worklist (initially every vertex, in `options.ordering`):
+ * 1. Tentative coloring: every vertex takes the smallest color that none of
+ *    its neighbors has at the time (neighbors colored in the same round may
+ *    be missed).
+ * 2. Conflict detection: of two adjacent vertices that took the same color,
+ *    the one later in the ordering goes to the next worklist.
+ * Vertices outside the worklist never change color, so a round only scans
+ * the adjacencies of the worklist, which shrinks quickly (conflicts need two
+ * adjacent vertices to be colored concurrently).
+ *
+ * @param G host graph (`graph::view_t::csr`), symmetric (undirected).
+ * @param colors output, color of every vertex, from 0.
+ * @param stats optional output.
+ * @param options see `options_t`.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t& G,
+          typename graph_t::vertex_type* colors,
+          stats_t<typename graph_t::vertex_type>* stats = nullptr,
+          options_t options = options_t()) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+
+  constexpr vertex_t invalid = -1;
+
+  vertex_t n = G.get_number_of_vertices();
+  auto const& csr = static_cast<typename graph_t::graph_csr_view_t const&>(G);
+  edge_t const* Ap = csr.get_row_offsets();
+  vertex_t const* Aj = csr.get_column_indices();
+
+  auto degree = [Ap](vertex_t v) { return Ap[v + 1] - Ap[v]; };
+
+  if (stats)
+    *stats = stats_t<vertex_t>();
+
+  auto t_start = std::chrono::high_resolution_clock::now();
+
+  // Worklist in coloring order, and the rank of every vertex in it.
+  std::vector<vertex_t> worklist(n);
+  std::vector<vertex_t> rank;
+  edge_t max_degree = 0;
+#pragma omp parallel for schedule(static) reduction(max : max_degree)
+  for (vertex_t v = 0; v < n; ++v) {
+    colors[v] = invalid;
+    worklist[v] = v;
+    max_degree = std::max(max_degree, degree(v));
+  }
+
+  if (options.ordering == largest_degree_first) {
+    // Stable counting sort by decreasing degree.
+    std::vector<vertex_t> offsets(max_degree + 2, 0);
+    for (vertex_t v = 0; v < n; ++v)
+      ++offsets[max_degree - degree(v) + 1];
+    for (edge_t d = 0; d <= max_degree; ++d)
+      offsets[d + 1] += offsets[d];
+    for (vertex_t v = 0; v < n; ++v)
+      worklist[offsets[max_degree - degree(v)]++] = v;
+
+    rank.resize(n);
+#pragma omp parallel for schedule(static)
+    for (vertex_t i = 0; i < n; ++i)
+      rank[worklist[i]] = i;
+  }
+
+  // `u` keeps its color over `v` if it comes first in the ordering.
+  auto first = [&](vertex_t u, vertex_t v) {
+    return rank.empty() ? (u < v) : (rank[u] < rank[v]);
+  };
+
+  std::vector<std::vector<vertex_t>> buffers(omp_get_max_threads());
+  vertex_t number_of_colors = 0;
+
+  while (!worklist.empty()) {
+    std::size_t size = worklist.size();
+    std::size_t edges = 0;
+
+    // Tentative coloring, smallest color not taken by a neighbor. Colors of
+    // neighbors in the worklist may change concurrently (relaxed atomics).
+#pragma omp parallel reduction(+ : edges)
+    {
+      // forbidden[c] == v: color `c` is taken by a neighbor of `v`.
+      std::vector<vertex_t> forbidden(max_degree + 1, invalid);
+#pragma omp for schedule(dynamic, 64)
+      for (std::size_t i = 0; i < size; ++i) {
+        vertex_t v = worklist[i];
+        edges += degree(v);
+        for (edge_t e = Ap[v]; e < Ap[v + 1]; ++e) {
+          vertex_t u = Aj[e];
+          vertex_t c = __atomic_load_n(&colors[u], __ATOMIC_RELAXED);
+          if (u != v && c != invalid && c <= degree(v))
+            forbidden[c] = v;
+        }
+        vertex_t c = 0;
+        while (forbidden[c] == v)
+          ++c;
+        __atomic_store_n(&colors[v], c, __ATOMIC_RELAXED);
+      }
+    }
+
+    // Conflict detection: the later vertex of a conflicting edge recolors.
+#pragma omp parallel
+    {
+      auto& local = buffers[omp_get_thread_num()];
+      local.clear();
+#pragma omp for schedule(dynamic, 64)
+      for (std::size_t i = 0; i < size; ++i) {
+        vertex_t v = worklist[i];
+        for (edge_t e = Ap[v]; e < Ap[v + 1]; ++e) {
+          vertex_t u = Aj[e];
+          if (u != v && colors[u] == colors[v] && first(u, v)) {
+            local.push_back(v);
+            break;
+          }
+        }
+      }
+    }
+
+    if (stats) {
+      stats->worklists.push_back(size);
+      stats->edges.push_back(edges);
+      stats->rounds++;
+    }
+
+    gunrock::cpu::detail::gather(buffers, worklist);
+    std::sort(worklist.begin(), worklist.end(), first);
+
+    if (stats)
+      stats->conflicts.push_back(worklist.size());
+  }
+
+#pragma omp parallel for schedule(static) reduction(max : number_of_colors)
+  for (vertex_t v = 0; v < n; ++v)
+    number_of_colors = std::max(number_of_colors, colors[v] + 1);
+
+  if (stats)
+    stats->colors = number_of_colors;
+
+  auto t_stop = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+}
+
+}  // namespace cpu
+}  // namespace color
+}  // namespace gunrock
@@ -0,0 +1,47 @@
+/**
+ * @file gather.hxx
+ * @brief Concatenation of per-thread buffers, used by the host (OpenMP)
+ * algorithms to build a frontier without atomics on a shared queue.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <omp.h>
+
+namespace gunrock {
+namespace cpu {
+namespace detail {
+
+/**
+ * @brief Concatenate `buffers` (in order) into `output`, optionally clearing
+ * them. Every buffer is copied by one thread at its prefix-summed offset.
+ */
+template <typename type_t>
+void gather(std::vector<std::vector<type_t>>& buffers,
+            std::vector<type_t>& output,
+            bool clear = false) {
+  std::vector<std::size_t> offsets(buffers.size() + 1, 0);
+  for (std::size_t t = 0; t < buffers.size(); ++t)
+    offsets[t + 1] = offsets[t] + buffers[t].size();
+
+  output.resize(offsets.back());
+
+#pragma omp parallel for schedule(static)
+  for (std::size_t t = 0; t < buffers.size(); ++t) {
+    std::copy(buffers[t].begin(), buffers[t].end(),
+              output.begin() + offsets[t]);
+    if (clear)
+      buffers[t].clear();
+  }
+}
+
+}  // namespace detail
+}  // namespace cpu
+}  // namespace gunrock
@@ -0,0 +1,526 @@
+/**
+ * @file external.hxx
+ * @brief Semi-external BFS, SSSP and PageRank on the host (OpenMP): vertex
+ * state and row offsets in memory, adjacency streamed from a binary CSR file
+ * in blocks (see `format::binary::external_csr_t`).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/util/math.hxx>
+#include <gunrock/formats/external_csr.hxx>
+#include <gunrock/applications/pr.hxx>
+#include <gunrock/applications/cpu/detail/gather.hxx>
+
+namespace gunrock {
+namespace external {
+namespace cpu {
+
+/**
+ * @brief Per-iteration statistics: iteration `i` expanded `active[i]`
+ * vertices and read `blocks[i]` blocks, `bytes_read[i]` bytes.
+ * `total_bytes_read` adds the passes outside of the iterations (PageRank
+ * out-weights, SSSP predecessors); `wait_time` is the time the computation
+ * stalled on a read.
+ */
+struct stats_t {
+  int iterations{0};
+  std::vector<std::size_t> active;
+  std::vector<std::size_t> blocks;
+  std::vector<std::size_t> bytes_read;
+  std::size_t total_bytes_read{0};
+  float wait_time{0};  // ms
+};
+
+namespace detail {
+
+/**
+ * @brief Frontier of a semi-external traversal: a flag per vertex for the
+ * current and the next iteration, and a flag per block with a vertex in the
+ * next one. Only vertices with out-edges are ever flagged, so the blocks
+ * read are exactly those the traversal needs.
+ */
+template <typename external_t, typename vertex_t>
+struct frontier_t {
+  external_t const& E;
+  std::vector<char> current, next;
+  std::vector<char> current_blocks, next_blocks;
+
+  frontier_t(external_t const& _E)
+      : E(_E),
+        current(_E.number_of_rows, 0),
+        next(_E.number_of_rows, 0),
+        current_blocks(_E.get_number_of_blocks(), 0),
+        next_blocks(_E.get_number_of_blocks(), 0) {}
+
+  bool has_edges(vertex_t const& v) const {
+    return E.row_offsets[v + 1] != E.row_offsets[v];
+  }
+
+  /**
+   * @brief Flag `v` for the next iteration (thread-safe).
+   * @return true if `v` was not flagged yet.
+   */
+  bool push_next(vertex_t const& v) {
+    if (!has_edges(v) || __atomic_load_n(&next[v], __ATOMIC_RELAXED) ||
+        __atomic_exchange_n(&next[v], 1, __ATOMIC_RELAXED))
+      return false;
+    __atomic_store_n(&next_blocks[E.get_block(v)], 1, __ATOMIC_RELAXED);
+    return true;
+  }
+
+  /**
+   * @brief The next iteration becomes the current one. Vertex flags of the
+   * current iteration are cleared by the blocks that expand them.
+   * @return std::vector<std::size_t> blocks of the (new) current iteration.
+   */
+  std::vector<std::size_t> advance() {
+    current.swap(next);
+    current_blocks.swap(next_blocks);
+    std::fill(next_blocks.begin(), next_blocks.end(), 0);
+    std::vector<std::size_t> blocks;
+    for (std::size_t b = 0; b < current_blocks.size(); ++b)
+      if (current_blocks[b])
+        blocks.push_back(b);
+    return blocks;
+  }
+};
+
+/**
+ * @brief Record an iteration from the I/O counters before it.
+ */
+template <typename external_t>
+void record(stats_t* stats,
+            external_t const& E,
+            format::binary::external_csr_stats_t const& before,
+            std::size_t active) {
+  if (!stats)
+    return;
+  stats->iterations++;
+  stats->active.push_back(active);
+  stats->blocks.push_back(E.stats.blocks_read - before.blocks_read);
+  stats->bytes_read.push_back(E.stats.bytes_read - before.bytes_read);
+}
+
+template <typename external_t>
+void finish(stats_t* stats,
+            external_t const& E,
+            format::binary::external_csr_stats_t const& start) {
+  if (!stats)
+    return;
+  stats->total_bytes_read = E.stats.bytes_read - start.bytes_read;
+  stats->wait_time = E.stats.wait_time - start.wait_time;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Semi-external, level-synchronous BFS: every level reads the blocks
+ * holding frontier vertices (column indices only), in file order, and
+ * expands them top-down as they arrive (see `bfs::cpu::run()`).
+ *
+ * @param E semi-external graph.
+ * @param single_source source vertex.
+ * @param distances output, depth of every vertex (-1 if unreachable).
+ * @param predecessors output, parent of every vertex in the BFS tree (-1 for
+ * the source and unreachable vertices).
+ * @param stats optional output, per-level vertices, blocks and bytes read.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+float bfs(format::binary::external_csr_t<vertex_t, edge_t, weight_t>& E,
+          vertex_t const& single_source,
+          vertex_t* distances,
+          vertex_t* predecessors,
+          stats_t* stats = nullptr) {
+  using external_t = format::binary::external_csr_t<vertex_t, edge_t, weight_t>;
+  using block_t = typename external_t::block_type;
+  constexpr vertex_t invalid = -1;
+
+  auto t_start = std::chrono::high_resolution_clock::now();
+  if (stats)
+    *stats = stats_t();
+  auto const start = E.stats;
+
+  vertex_t n = E.number_of_rows;
+  edge_t const* Ap = E.row_offsets.data();
+
+#pragma omp parallel for schedule(static)
+  for (vertex_t v = 0; v < n; ++v) {
+    distances[v] = invalid;
+    predecessors[v] = invalid;
+  }
+
+  detail::frontier_t<external_t, vertex_t> frontier(E);
+  distances[single_source] = 0;
+  frontier.push_next(single_source);
+
+  for (vertex_t level = 0;; ++level) {
+    auto blocks = frontier.advance();
+    if (blocks.empty())
+      break;
+
+    auto const before = E.stats;
+    std::size_t expanded = 0;
+    E.for_each_block(
+        blocks.data(), blocks.size(),
+        [&](block_t const& block) {
+          char* current = frontier.current.data();
+          vertex_t const* Aj = block.column_indices.data() - block.first_edge;
+#pragma omp parallel for schedule(dynamic, 256) reduction(+ : expanded)
+          for (vertex_t u = block.first_row; u < block.last_row; ++u) {
+            if (!current[u])
+              continue;
+            current[u] = 0;
+            ++expanded;
+            for (edge_t e = Ap[u]; e < Ap[u + 1]; ++e) {
+              vertex_t v = Aj[e];
+              if (__atomic_load_n(&distances[v], __ATOMIC_RELAXED) != invalid)
+                continue;
+              if (math::atomic::cas(&distances[v], invalid, level + 1) ==
+                  invalid) {
+                predecessors[v] = u;
+                frontier.push_next(v);
+              }
+            }
+          }
+        },
+        format::binary::contents_t::adjacency);
+    detail::record(stats, E, before, expanded);
+  }
+
+  detail::finish(stats, E, start);
+  auto t_stop = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+}
+
+/**
+ * @brief Semi-external SSSP (label-correcting, Bellman-Ford over a frontier):
+ * every iteration reads the blocks holding vertices whose distance dropped,
+ * in file order, and relaxes their out-edges. While a block is in memory,
+ * the vertices it improves within itself are relaxed again until it settles,
+ * and those it improves in a block still to be read this iteration are
+ * relaxed when that block arrives; only the others wait for the next
+ * iteration (and another read).
+ *
+ * Predecessors (optional, one more pass over the blocks of the reached
+ * vertices, and more for vertices only reached through zero-weight edges)
+ * are chosen as in `sssp::cpu::run()`.
+ *
+ * @param E semi-external graph, non-negative weights.
+ * @param single_source source vertex.
+ * @param distances output, shortest distances (max() if unreachable).
+ * @param predecessors optional output, shortest path tree (-1 for the source
+ * and unreachable vertices).
+ * @param stats optional output, per-iteration vertices, blocks and bytes read.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+float sssp(format::binary::external_csr_t<vertex_t, edge_t, weight_t>& E,
+           vertex_t const& single_source,
+           weight_t* distances,
+           vertex_t* predecessors = nullptr,
+           stats_t* stats = nullptr) {
+  using external_t = format::binary::external_csr_t<vertex_t, edge_t, weight_t>;
+  using block_t = typename external_t::block_type;
+  constexpr weight_t infinity = std::numeric_limits<weight_t>::max();
+
+  auto t_start = std::chrono::high_resolution_clock::now();
+  if (stats)
+    *stats = stats_t();
+  auto const start = E.stats;
+
+  vertex_t n = E.number_of_rows;
+  edge_t const* Ap = E.row_offsets.data();
+
+#pragma omp parallel for schedule(static)
+  for (vertex_t v = 0; v < n; ++v)
+    distances[v] = infinity;
+
+  detail::frontier_t<external_t, vertex_t> frontier(E);
+  std::vector<char> scheduled(E.get_number_of_blocks(), 0);
+  std::vector<vertex_t> queue;
+  std::vector<std::vector<vertex_t>> buffers(omp_get_max_threads());
+  distances[single_source] = 0;
+  frontier.push_next(single_source);
+
+  for (;;) {
+    auto blocks = frontier.advance();
+    if (blocks.empty())
+      break;
+    for (auto b : blocks)
+      scheduled[b] = 1;
+
+    auto const before = E.stats;
+    std::size_t expanded = 0;
+    E.for_each_block(blocks.data(), blocks.size(), [&](block_t const& block) {
+      char* current = frontier.current.data();
+      vertex_t const* Aj = block.column_indices.data() - block.first_edge;
+      weight_t const* Ax = block.nonzero_values.data() - block.first_edge;
+      scheduled[block.id] = 0;
+
+#pragma omp parallel
+      {
+        auto& local = buffers[omp_get_thread_num()];
+        local.clear();
+#pragma omp for schedule(static)
+        for (vertex_t u = block.first_row; u < block.last_row; ++u)
+          if (current[u])
+            local.push_back(u);
+      }
+      gunrock::cpu::detail::gather(buffers, queue);
+
+      // Relax the queue; improvements within the block are queued again.
+      while (!queue.empty()) {
+        expanded += queue.size();
+#pragma omp parallel
+        {
+          auto& local = buffers[omp_get_thread_num()];
+          local.clear();
+#pragma omp for schedule(dynamic, 64)
+          for (std::size_t i = 0; i < queue.size(); ++i) {
+            vertex_t u = queue[i];
+            __atomic_store_n(&current[u], 0, __ATOMIC_RELAXED);
+            // Pairs with the fence of an improving thread: either this load
+            // sees its distance, or it sees `current[u]` cleared and requeues
+            // `u` (the store and the load must not be reordered).
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            weight_t du;
+            __atomic_load(&distances[u], &du, __ATOMIC_RELAXED);
+            for (edge_t e = Ap[u]; e < Ap[u + 1]; ++e) {
+              vertex_t v = Aj[e];
+              weight_t candidate = du + Ax[e];
+              weight_t dv;
+              __atomic_load(&distances[v], &dv, __ATOMIC_RELAXED);
+              if (!(candidate < dv &&
+                    candidate < math::atomic::min(&distances[v], candidate)))
+                continue;
+              if (!frontier.has_edges(v))
+                continue;
+              bool here = (v >= block.first_row && v < block.last_row);
+              if (here || scheduled[E.get_block(v)]) {
+                __atomic_thread_fence(__ATOMIC_SEQ_CST);
+                if (!__atomic_exchange_n(&current[v], 1, __ATOMIC_RELAXED) &&
+                    here)
+                  local.push_back(v);
+              } else {
+                frontier.push_next(v);
+              }
+            }
+          }
+        }
+        gunrock::cpu::detail::gather(buffers, queue);
+      }
+    });
+    detail::record(stats, E, before, expanded);
+  }
+
+  // Predecessors: smallest in-neighbor on a shortest path that is strictly
+  // closer to the source, then the vertices only reached through ties, in
+  // rounds (see `sssp::cpu::run()`).
+  if (predecessors) {
+#pragma omp parallel for schedule(static)
+    for (vertex_t v = 0; v < n; ++v)
+      predecessors[v] = -1;
+
+    auto attach = [&](vertex_t v, vertex_t u) {
+      vertex_t current = __atomic_load_n(&predecessors[v], __ATOMIC_RELAXED);
+      while ((current == -1 || u < current) &&
+             !__atomic_compare_exchange_n(&predecessors[v], &current, u, true,
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        ;
+    };
+
+    std::vector<char> reached(E.get_number_of_blocks(), 0);
+    for (vertex_t u = 0; u < n; ++u)
+      if (distances[u] != infinity && frontier.has_edges(u))
+        reached[E.get_block(u)] = 1;
+
+    E.for_each_block(reached, [&](block_t const& block) {
+      vertex_t const* Aj = block.column_indices.data() - block.first_edge;
+      weight_t const* Ax = block.nonzero_values.data() - block.first_edge;
+#pragma omp parallel for schedule(dynamic, 256)
+      for (vertex_t u = block.first_row; u < block.last_row; ++u) {
+        if (distances[u] == infinity)
+          continue;
+        for (edge_t e = Ap[u]; e < Ap[u + 1]; ++e) {
+          vertex_t v = Aj[e];
+          if (v != single_source && distances[u] < distances[v] &&
+              distances[u] + Ax[e] == distances[v])
+            attach(v, u);
+        }
+      }
+    });
+
+    // Round `r` reads the blocks of the vertices attached in round `r - 1`.
+    std::vector<int> rounds(n);
+    bool pending = false;
+    for (vertex_t v = 0; v < n; ++v) {
+      bool attached = (v == single_source || predecessors[v] != -1);
+      rounds[v] = attached ? 0 : -1;
+      pending = pending || (!attached && distances[v] != infinity);
+    }
+
+    for (int round = 1; pending; ++round) {
+      std::fill(reached.begin(), reached.end(), 0);
+      for (vertex_t u = 0; u < n; ++u)
+        if (rounds[u] == round - 1 && distances[u] != infinity &&
+            frontier.has_edges(u))
+          reached[E.get_block(u)] = 1;
+
+      pending = false;
+      E.for_each_block(reached, [&](block_t const& block) {
+        vertex_t const* Aj = block.column_indices.data() - block.first_edge;
+        weight_t const* Ax = block.nonzero_values.data() - block.first_edge;
+#pragma omp parallel for schedule(dynamic, 256) reduction(|| : pending)
+        for (vertex_t u = block.first_row; u < block.last_row; ++u) {
+          if (__atomic_load_n(&rounds[u], __ATOMIC_RELAXED) != round - 1)
+            continue;
+          for (edge_t e = Ap[u]; e < Ap[u + 1]; ++e) {
+            vertex_t v = Aj[e];
+            if (distances[v] != distances[u] ||
+                distances[u] + Ax[e] != distances[v])
+              continue;
+            int seen = -1;
+            if (__atomic_compare_exchange_n(&rounds[v], &seen, round, false,
+                                            __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED))
+              pending = true;  // attached now, may attach others.
+            if (seen == -1 || seen == round)
+              attach(v, u);
+          }
+        }
+      });
+    }
+  }
+
+  detail::finish(stats, E, start);
+  auto t_stop = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+}
+
+/**
+ * @brief Semi-external PageRank, with the semantics of `pr::run()` (see
+ * `pr::cpu::run()`, power iteration): every iteration streams the blocks
+ * with out-edges once and pushes the scaled ranks of their rows to the
+ * out-neighbors (atomic adds), ranks are resident. Out-weights are computed
+ * once, from one pass over the values (or from the offsets for pattern-only
+ * files, no read).
+ *
+ * @param E semi-external graph.
+ * @param param damping factor `alpha` and tolerance `tol`.
+ * @param result output, `result.p` gets the ranks.
+ * @param stats optional output, per-iteration vertices, blocks and bytes read.
+ * @param max_iterations at most this many iterations.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+float pr(format::binary::external_csr_t<vertex_t, edge_t, weight_t>& E,
+         gunrock::pr::param_t<weight_t> const& param,
+         gunrock::pr::result_t<weight_t> result,
+         stats_t* stats = nullptr,
+         int max_iterations = 1000) {
+  using external_t = format::binary::external_csr_t<vertex_t, edge_t, weight_t>;
+  using block_t = typename external_t::block_type;
+
+  auto t_start = std::chrono::high_resolution_clock::now();
+  if (stats)
+    *stats = stats_t();
+  auto const start = E.stats;
+
+  vertex_t n = E.number_of_rows;
+  edge_t const* Ap = E.row_offsets.data();
+  weight_t alpha = param.alpha;
+  weight_t tol = param.tol;
+  weight_t* p = result.p;
+  if (n == 0)
+    return 0;
+
+  // Blocks with edges: every iteration reads all of them.
+  std::vector<std::size_t> blocks;
+  for (std::size_t b = 0; b < E.get_number_of_blocks(); ++b)
+    if (E.get_block_bytes(b) > 0)
+      blocks.push_back(b);
+
+  // `alpha` over the out-weight, 0 for the dangling vertices.
+  std::vector<weight_t> scale(n);
+#pragma omp parallel for schedule(static)
+  for (vertex_t u = 0; u < n; ++u) {
+    scale[u] = (Ap[u + 1] != Ap[u]) ? alpha / (weight_t)(Ap[u + 1] - Ap[u])
+                                    : weight_t(0);
+    p[u] = weight_t(1) / n;
+  }
+  if (E.has_values()) {
+    E.for_each_block(
+        blocks.data(), blocks.size(),
+        [&](block_t const& block) {
+          weight_t const* Ax = block.nonzero_values.data() - block.first_edge;
+#pragma omp parallel for schedule(dynamic, 256)
+          for (vertex_t u = block.first_row; u < block.last_row; ++u) {
+            weight_t out = 0;
+            for (edge_t e = Ap[u]; e < Ap[u + 1]; ++e)
+              out += Ax[e];
+            scale[u] = (out != 0) ? alpha / out : 0;
+          }
+        },
+        format::binary::contents_t::weights);
+  }
+
+  std::vector<weight_t> x(n);    // scaled ranks to spread.
+  std::vector<weight_t> sum(n);  // gathered by every destination.
+
+  for (int iteration = 0; iteration < max_iterations; ++iteration) {
+    double dangling = 0;
+#pragma omp parallel for schedule(static) reduction(+ : dangling)
+    for (vertex_t u = 0; u < n; ++u) {
+      x[u] = scale[u] * p[u];
+      sum[u] = 0;
+      if (scale[u] == 0)
+        dangling += alpha * p[u];
+    }
+
+    auto const before = E.stats;
+    E.for_each_block(blocks.data(), blocks.size(), [&](block_t const& block) {
+      vertex_t const* Aj = block.column_indices.data() - block.first_edge;
+      weight_t const* Ax = block.nonzero_values.data() - block.first_edge;
+#pragma omp parallel for schedule(dynamic, 256)
+      for (vertex_t u = block.first_row; u < block.last_row; ++u)
+        for (edge_t e = Ap[u]; e < Ap[u + 1]; ++e)
+          math::atomic::add(&sum[Aj[e]], x[u] * Ax[e]);
+    });
+
+    weight_t base = (weight_t)((1 - alpha + dangling) / n);
+    weight_t largest = 0;
+#pragma omp parallel for schedule(static) reduction(max : largest)
+    for (vertex_t v = 0; v < n; ++v) {
+      weight_t next = base + sum[v];
+      largest = std::max(largest, std::abs(next - p[v]));
+      p[v] = next;
+    }
+
+    detail::record(stats, E, before, (std::size_t)n);
+    if (largest < tol)
+      break;
+  }
+
+  detail::finish(stats, E, start);
+  auto t_stop = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+}
+
+}  // namespace cpu
+}  // namespace external
+}  // namespace gunrock
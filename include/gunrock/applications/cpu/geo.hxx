@@ -0,0 +1,392 @@
+/**
+ * @file geo.hxx
+ * @brief Geolocation on the host (OpenMP): structure-of-arrays coordinates
+ * with precomputed trigonometry, vectorized distance and midpoint kernels.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/applications/cpu/detail/gather.hxx>
+
+namespace gunrock {
+namespace geo {
+namespace cpu {
+
+/**
+ * @brief Stop after `total_iterations` rounds (or once a round locates no
+ * vertex); a spatial median stops once it moves less than `eps` degrees, or
+ * after `spatial_iterations` steps.
+ */
+struct options_t {
+  unsigned int total_iterations{10};
+  unsigned int spatial_iterations{1000};
+  float eps{1e-3f};
+  options_t() = default;
+};
+
+/**
+ * @brief Statistics of a run: round `i` located `located[i]` vertices.
+ */
+struct stats_t {
+  int iterations{0};
+  std::vector<std::size_t> located;
+  std::size_t copies{0};           // one located neighbor.
+  std::size_t midpoints{0};        // two located neighbors.
+  std::size_t medians{0};          // more, spatial median.
+  std::size_t median_steps{0};     // Weiszfeld steps of all the medians.
+};
+
+namespace detail {
+
+constexpr double pi = 3.141592653589793;
+constexpr double radians_per_degree = pi / 180;
+constexpr double degrees_per_radian = 180 / pi;
+constexpr double earth_radius = 6371;  // km
+
+/**
+ * @brief Located points: coordinates (degrees) and the sines and cosines of
+ * their latitude and longitude, so that the distance between two points
+ * needs no trigonometric function but the final `asin`.
+ */
+struct points_t {
+  std::vector<double> latitude, longitude;
+  std::vector<double> sin_latitude, cos_latitude;
+  std::vector<double> sin_longitude, cos_longitude;
+
+  void resize(std::size_t n) {
+    for (auto array : {&latitude, &longitude, &sin_latitude, &cos_latitude,
+                       &sin_longitude, &cos_longitude})
+      array->resize(n);
+  }
+
+  void set(std::size_t i, double _latitude, double _longitude) {
+    latitude[i] = _latitude;
+    longitude[i] = _longitude;
+    sin_latitude[i] = std::sin(_latitude * radians_per_degree);
+    cos_latitude[i] = std::cos(_latitude * radians_per_degree);
+    sin_longitude[i] = std::sin(_longitude * radians_per_degree);
+    cos_longitude[i] = std::cos(_longitude * radians_per_degree);
+  }
+
+  void copy(std::size_t i, points_t const& from, std::size_t j) {
+    latitude[i] = from.latitude[j];
+    longitude[i] = from.longitude[j];
+    sin_latitude[i] = from.sin_latitude[j];
+    cos_latitude[i] = from.cos_latitude[j];
+    sin_longitude[i] = from.sin_longitude[j];
+    cos_longitude[i] = from.cos_longitude[j];
+  }
+};
+
+/**
+ * @brief Haversine distance (km) from the (sines and cosines of the) two
+ * points: `hav(d) = hav(dlat) + cos(lat1) cos(lat2) hav(dlon)`, with
+ * `hav(x) = (1 - cos(x)) / 2` and the cosines of the differences expanded.
+ */
+#pragma omp declare simd
+inline double haversine(double sin_lat1,
+                        double cos_lat1,
+                        double sin_lon1,
+                        double cos_lon1,
+                        double sin_lat2,
+                        double cos_lat2,
+                        double sin_lon2,
+                        double cos_lon2) {
+  double cos_dlat = cos_lat1 * cos_lat2 + sin_lat1 * sin_lat2;
+  double cos_dlon = cos_lon1 * cos_lon2 + sin_lon1 * sin_lon2;
+  double h = 0.5 * (1 - cos_dlat) + 0.5 * cos_lat1 * cos_lat2 * (1 - cos_dlon);
+  h = std::fmin(1.0, std::fmax(0.0, h));
+  return 2 * earth_radius * std::asin(std::sqrt(h));
+}
+
+/**
+ * @brief Spatial median of the `k` points of `P` (Weiszfeld's algorithm with
+ * the Vardi-Zhang correction for points on the estimate, as in
+ * `geo::spatial_median`), from their mean.
+ */
+inline void spatial_median(points_t const& P,
+                           std::size_t k,
+                           unsigned int max_iterations,
+                           double eps,
+                           double& latitude,
+                           double& longitude,
+                           std::size_t& steps) {
+  double const* lat = P.latitude.data();
+  double const* lon = P.longitude.data();
+  double const* sin_lat = P.sin_latitude.data();
+  double const* cos_lat = P.cos_latitude.data();
+  double const* sin_lon = P.sin_longitude.data();
+  double const* cos_lon = P.cos_longitude.data();
+
+  double y_lat = 0, y_lon = 0;
+#pragma omp simd reduction(+ : y_lat, y_lon)
+  for (std::size_t i = 0; i < k; ++i) {
+    y_lat += lat[i];
+    y_lon += lon[i];
+  }
+  y_lat /= k;
+  y_lon /= k;
+
+  for (unsigned int iteration = 1;; ++iteration) {
+    ++steps;
+    double sy_lat = std::sin(y_lat * radians_per_degree);
+    double cy_lat = std::cos(y_lat * radians_per_degree);
+    double sy_lon = std::sin(y_lon * radians_per_degree);
+    double cy_lon = std::cos(y_lon * radians_per_degree);
+
+    // Inverse distances to the estimate, and the weighted sum of the points.
+    double inverses = 0, t_lat = 0, t_lon = 0;
+    std::size_t nonzeros = 0;
+#pragma omp simd reduction(+ : inverses, t_lat, t_lon, nonzeros)
+    for (std::size_t i = 0; i < k; ++i) {
+      double d = haversine(sin_lat[i], cos_lat[i], sin_lon[i], cos_lon[i],
+                           sy_lat, cy_lat, sy_lon, cy_lon);
+      double inverse = (d == 0) ? 0 : 1 / d;
+      inverses += inverse;
+      t_lat += inverse * lat[i];
+      t_lon += inverse * lon[i];
+      nonzeros += (d != 0);
+    }
+
+    std::size_t zeros = k - nonzeros;
+    if (zeros == k)
+      break;  // every point is on the estimate.
+
+    t_lat /= inverses;
+    t_lon /= inverses;
+
+    double y1_lat = t_lat, y1_lon = t_lon;
+    if (zeros > 0) {
+      double r_lat = (t_lat - y_lat) * inverses;
+      double r_lon = (t_lon - y_lon) * inverses;
+      double r = std::sqrt(r_lat * r_lat + r_lon * r_lon);
+      double r_inverse = (r == 0) ? 1 : zeros / r;
+      y1_lat = std::fmax(0.0, 1 - r_inverse) * t_lat +
+               std::fmin(1.0, r_inverse) * y_lat;
+      y1_lon = std::fmax(0.0, 1 - r_inverse) * t_lon +
+               std::fmin(1.0, r_inverse) * y_lon;
+    }
+
+    double moved = std::sqrt((y_lat - y1_lat) * (y_lat - y1_lat) +
+                             (y_lon - y1_lon) * (y_lon - y1_lon));
+    y_lat = y1_lat;
+    y_lon = y1_lon;
+    if (moved < eps || iteration > max_iterations)
+      break;
+  }
+
+  latitude = y_lat;
+  longitude = y_lon;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Geolocation: every vertex without coordinates is placed at the
+ * "center" of its located neighbors, the neighbor itself if there is one,
+ * their midpoint (on the sphere) if there are two, their spatial median if
+ * there are more; repeated until no vertex can be located (or for
+ * `options.total_iterations` rounds).
+ *
+ * Rounds only visit a shrinking worklist of vertices still unlocated, and
+ * read the coordinates of the previous round (deterministic, independent of
+ * the number of threads). Located points are kept as arrays of coordinates
+ * and of the sines and cosines of their latitudes and longitudes: distances
+ * cost a few multiplications and one `asin`, and the inner loops
+ * (distances, midpoints) are `omp simd` loops over contiguous arrays.
+ *
+ * @param G host graph (`graph::view_t::csr`).
+ * @param latitudes input/output, latitude of every vertex (degrees, invalid
+ * if unknown).
+ * @param longitudes input/output, longitude of every vertex.
+ * @param stats optional output.
+ * @param options see `options_t`.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t& G,
+          float* latitudes,
+          float* longitudes,
+          stats_t* stats = nullptr,
+          options_t options = options_t()) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+
+  auto const& csr = static_cast<typename graph_t::graph_csr_view_t const&>(G);
+  edge_t const* Ap = csr.get_row_offsets();
+  vertex_t const* Aj = csr.get_column_indices();
+  vertex_t n = G.get_number_of_vertices();
+
+  if (stats)
+    *stats = stats_t();
+
+  auto t_start = std::chrono::high_resolution_clock::now();
+
+  // Located points, and the worklist of the others.
+  detail::points_t points;
+  points.resize(n);
+  std::vector<char> located(n);
+  std::vector<vertex_t> worklist;
+  std::vector<std::vector<vertex_t>> buffers(omp_get_max_threads());
+
+#pragma omp parallel
+  {
+    auto& local = buffers[omp_get_thread_num()];
+    local.clear();
+#pragma omp for schedule(static)
+    for (vertex_t v = 0; v < n; ++v) {
+      located[v] = util::limits::is_valid(latitudes[v]) &&
+                   util::limits::is_valid(longitudes[v]);
+      if (located[v])
+        points.set(v, latitudes[v], longitudes[v]);
+      else
+        local.push_back(v);
+    }
+  }
+  gunrock::cpu::detail::gather(buffers, worklist);
+
+  std::vector<double> new_latitudes, new_longitudes;
+  std::vector<char> found;
+  std::vector<vertex_t> pairs;  // worklist index, two neighbors.
+  std::size_t copies = 0, midpoints = 0, medians = 0, steps = 0;
+
+  for (unsigned int iteration = 0;
+       iteration < options.total_iterations && !worklist.empty();
+       ++iteration) {
+    std::size_t size = worklist.size();
+    new_latitudes.resize(size);
+    new_longitudes.resize(size);
+    found.assign(size, 0);
+
+    // One located neighbor: copy, more than two: spatial median; two are
+    // batched for the midpoint kernel.
+    std::vector<std::vector<vertex_t>> pair_buffers(omp_get_max_threads());
+#pragma omp parallel reduction(+ : copies, medians, steps)
+    {
+      auto& local = pair_buffers[omp_get_thread_num()];
+      detail::points_t neighbors;
+#pragma omp for schedule(dynamic, 64)
+      for (std::size_t i = 0; i < size; ++i) {
+        vertex_t v = worklist[i];
+        std::size_t k = 0;
+        for (edge_t e = Ap[v]; e < Ap[v + 1]; ++e)
+          k += located[Aj[e]];
+
+        if (k == 0)
+          continue;
+        found[i] = 1;
+
+        if (k == 1 || k == 2) {
+          vertex_t first = -1, second = -1;
+          for (edge_t e = Ap[v]; e < Ap[v + 1]; ++e)
+            if (located[Aj[e]])
+              (first == -1 ? first : second) = Aj[e];
+          if (k == 1) {
+            new_latitudes[i] = points.latitude[first];
+            new_longitudes[i] = points.longitude[first];
+            ++copies;
+          } else {
+            local.insert(local.end(), {(vertex_t)i, first, second});
+          }
+          continue;
+        }
+
+        // Gather the located neighbors (contiguous for the simd loops).
+        if (neighbors.latitude.size() < k)
+          neighbors.resize(k);
+        std::size_t j = 0;
+        for (edge_t e = Ap[v]; e < Ap[v + 1]; ++e)
+          if (located[Aj[e]])
+            neighbors.copy(j++, points, Aj[e]);
+
+        detail::spatial_median(neighbors, k, options.spatial_iterations,
+                               options.eps, new_latitudes[i],
+                               new_longitudes[i], steps);
+        ++medians;
+      }
+    }
+    gunrock::cpu::detail::gather(pair_buffers, pairs);
+
+    // Midpoints of two located neighbors.
+    std::size_t number_of_pairs = pairs.size() / 3;
+    vertex_t const* triples = pairs.data();
+    double const* lon = points.longitude.data();
+    double const* sin_lat = points.sin_latitude.data();
+    double const* cos_lat = points.cos_latitude.data();
+    double const* sin_lon = points.sin_longitude.data();
+    double const* cos_lon = points.cos_longitude.data();
+    double* out_lat = new_latitudes.data();
+    double* out_lon = new_longitudes.data();
+#pragma omp parallel for simd schedule(static)
+    for (std::size_t p = 0; p < number_of_pairs; ++p) {
+      vertex_t i = triples[3 * p], a = triples[3 * p + 1],
+               b = triples[3 * p + 2];
+      // cos(lon_b - lon_a), sin(lon_b - lon_a)
+      double cos_dlon = cos_lon[b] * cos_lon[a] + sin_lon[b] * sin_lon[a];
+      double sin_dlon = sin_lon[b] * cos_lon[a] - cos_lon[b] * sin_lon[a];
+      double bx = cos_lat[b] * cos_dlon;
+      double by = cos_lat[b] * sin_dlon;
+      double x = cos_lat[a] + bx;
+      out_lat[i] = std::atan2(sin_lat[a] + sin_lat[b],
+                              std::sqrt(x * x + by * by)) *
+                   detail::degrees_per_radian;
+      out_lon[i] = lon[a] + std::atan2(by, x) * detail::degrees_per_radian;
+    }
+    midpoints += number_of_pairs;
+
+    // Commit the round, keep the vertices still unlocated.
+    std::size_t located_now = 0;
+#pragma omp parallel reduction(+ : located_now)
+    {
+      auto& local = buffers[omp_get_thread_num()];
+      local.clear();
+#pragma omp for schedule(static)
+      for (std::size_t i = 0; i < size; ++i) {
+        vertex_t v = worklist[i];
+        if (!found[i]) {
+          local.push_back(v);
+          continue;
+        }
+        latitudes[v] = (float)new_latitudes[i];
+        longitudes[v] = (float)new_longitudes[i];
+        points.set(v, new_latitudes[i], new_longitudes[i]);
+        located[v] = 1;
+        ++located_now;
+      }
+    }
+    gunrock::cpu::detail::gather(buffers, worklist);
+
+    if (stats) {
+      stats->iterations++;
+      stats->located.push_back(located_now);
+    }
+    if (located_now == 0)
+      break;  // converged, nothing left to locate.
+  }
+
+  if (stats) {
+    stats->copies = copies;
+    stats->midpoints = midpoints;
+    stats->medians = medians;
+    stats->median_steps = steps;
+  }
+
+  auto t_stop = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+}
+
+}  // namespace cpu
+}  // namespace geo
+}  // namespace gunrock
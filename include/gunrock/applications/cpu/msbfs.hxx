@@ -0,0 +1,393 @@
+/**
+ * @file msbfs.hxx
+ * @brief Multi-Source Breadth-First Search on the host (OpenMP): batches of
+ * up to 512 sources traverse the graph together, one bit per source.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <type_traits>
+#include <vector>
+
+#include <omp.h>
+
+namespace gunrock {
+namespace msbfs {
+namespace cpu {
+
+/**
+ * @brief Outputs of a multi-source BFS, every one optional (nullptr). Source
+ * `s` is the `s`-th of the `sources` given to `run()`.
+ */
+template <typename vertex_t>
+struct result_t {
+  /*!
+   * Depth of every vertex from every source (-1 if unreachable), source-major:
+   * `distances[s * number_of_vertices + v]`.
+   */
+  vertex_t* distances{nullptr};
+
+  std::uint64_t* sum_of_distances{nullptr};  // per source, reached vertices.
+  vertex_t* reached{nullptr};  // per source, vertices reached (with itself).
+
+  result_t() = default;
+  result_t(vertex_t* _distances,
+           std::uint64_t* _sum_of_distances = nullptr,
+           vertex_t* _reached = nullptr)
+      : distances(_distances),
+        sum_of_distances(_sum_of_distances),
+        reached(_reached) {}
+};
+
+struct options_t {
+  /*!
+   * Sources per batch: 64, 128, 256 or 512 (one bit per source, per vertex,
+   * in each of the three bitsets of a batch).
+   */
+  int batch_size{512};
+
+  /*!
+   * Graphs with a CSC view expand a level bottom-up (pull, no atomics) when
+   * the edges out of the frontier exceed `1/alpha` of the edges, top-down
+   * (push over the CSR) otherwise; see `bfs::cpu::options_t`.
+   */
+  double alpha{15};
+
+  options_t() = default;
+};
+
+struct stats_t {
+  std::size_t batches{0};
+  std::size_t levels{0};         // levels expanded, all batches.
+  std::size_t pull_levels{0};    // ... of which bottom-up.
+  std::size_t edges{0};          // edges scanned, shared by a batch.
+  double seconds{0};
+  double sources_per_second{0};  // throughput, sources over `seconds`.
+
+  void print() const {
+    std::cout << "Batches = " << batches << std::endl;
+    std::cout << "Levels = " << levels << " (pull = " << pull_levels << ")"
+              << std::endl;
+    std::cout << "Edges scanned = " << edges << std::endl;
+    std::cout << "Sources per second = " << sources_per_second << std::endl;
+  }
+};
+
+namespace detail {
+
+using word_t = std::uint64_t;
+constexpr int bits = 64;
+
+/**
+ * @brief Per-source counts of the vertices that join a level, bit-sliced:
+ * `plane[p]` holds bit `p` of the count of every source, so counting a vertex
+ * is a carry chain over its words (two steps on average) rather than a step
+ * per new bit. Counts are moved to `tally` before they can overflow.
+ */
+template <int words>
+struct bit_counter_t {
+  static constexpr int planes = 16;
+
+  word_t plane[planes][words];
+  std::size_t added;
+
+  bit_counter_t() { clear(); }
+
+  void clear() {
+    std::fill(&plane[0][0], &plane[0][0] + planes * words, word_t(0));
+    added = 0;
+  }
+
+  void add(word_t const* x, std::uint64_t* tally, int number_of_sources) {
+    for (int w = 0; w < words; ++w) {
+      word_t carry = x[w];
+      for (int p = 0; carry && p < planes; ++p) {
+        word_t next_carry = plane[p][w] & carry;
+        plane[p][w] ^= carry;
+        carry = next_carry;
+      }
+    }
+    if (++added == (std::size_t(1) << planes) - 1)
+      flush(tally, number_of_sources);
+  }
+
+  void flush(std::uint64_t* tally, int number_of_sources) {
+    for (int s = 0; s < number_of_sources; ++s)
+      for (int p = 0; p < planes; ++p)
+        tally[s] += ((plane[p][s / bits] >> (s % bits)) & 1) << p;
+    clear();
+  }
+};
+
+/**
+ * @brief One batch of `words * 64` (or fewer) sources: the bitsets `seen`,
+ * `visit` and `next` hold a bit per source for every vertex, `words` words
+ * per vertex, and every level is a handful of word-wide OR / AND-NOT loops
+ * (which the compiler vectorizes) per scanned edge.
+ */
+template <int words, typename graph_t>
+void run_batch(graph_t& G,
+               typename graph_t::vertex_type const* sources,
+               int number_of_sources,
+               std::size_t first_source,
+               result_t<typename graph_t::vertex_type>& result,
+               stats_t& stats,
+               options_t const& options,
+               std::vector<word_t>& seen,
+               std::vector<word_t>& visit,
+               std::vector<word_t>& next) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+
+  constexpr bool has_csc =
+      std::is_base_of_v<typename graph_t::graph_csc_view_t, graph_t>;
+
+  vertex_t n = G.get_number_of_vertices();
+  std::int64_t m = G.get_number_of_edges();
+  auto const& csr = static_cast<typename graph_t::graph_csr_view_t const&>(G);
+  edge_t const* Ap = csr.get_row_offsets();
+  vertex_t const* Aj = csr.get_column_indices();
+
+  std::size_t size = (std::size_t)n * words;
+  seen.assign(size, 0);
+  visit.assign(size, 0);
+  next.resize(size);
+
+  // Bits of the batch's sources (the last words of a batch may be partial).
+  word_t all[words];
+  for (int w = 0; w < words; ++w) {
+    int in_word = std::min(bits, std::max(0, number_of_sources - w * bits));
+    all[w] = (in_word == bits) ? ~word_t(0) : ((word_t(1) << in_word) - 1);
+  }
+
+  std::vector<std::uint64_t> sums(number_of_sources, 0);
+  std::vector<std::uint64_t> counts(number_of_sources, 0);
+
+  std::int64_t frontier_edges = 0;
+  for (int s = 0; s < number_of_sources; ++s) {
+    vertex_t v = sources[s];
+    word_t* x = &visit[(std::size_t)v * words];
+    if (std::all_of(x, x + words, [](word_t w) { return w == 0; }))
+      frontier_edges += Ap[v + 1] - Ap[v];  // once per distinct source.
+    seen[(std::size_t)v * words + s / bits] |= word_t(1) << (s % bits);
+    x[s / bits] |= word_t(1) << (s % bits);
+    counts[s] = 1;
+    if (result.distances)
+      result.distances[(first_source + s) * n + v] = 0;
+  }
+
+  int threads = omp_get_max_threads();
+  std::vector<std::vector<std::uint64_t>> local_counts(
+      threads, std::vector<std::uint64_t>(number_of_sources));
+
+  for (vertex_t level = 1; frontier_edges > 0; ++level) {
+    bool pull = false;
+    if constexpr (has_csc)
+      pull = frontier_edges > m / options.alpha;
+
+    std::int64_t next_edges = 0;
+    std::size_t scanned = 0;
+
+    if (pull) {
+      if constexpr (has_csc) {
+        auto const& csc =
+            static_cast<typename graph_t::graph_csc_view_t const&>(G);
+        edge_t const* Ac = csc.get_column_offsets();
+        vertex_t const* Ai = csc.get_row_indices();
+
+        // Bottom-up: every vertex gathers the bits of its in-neighbors that
+        // it has not seen, and stops once it has seen every source.
+#pragma omp parallel for schedule(dynamic, 256) reduction(+ : scanned)
+        for (vertex_t v = 0; v < n; ++v) {
+          word_t const* s = &seen[(std::size_t)v * words];
+          word_t* x = &next[(std::size_t)v * words];
+          word_t missing = 0;
+          for (int w = 0; w < words; ++w) {
+            x[w] = 0;
+            missing |= all[w] & ~s[w];
+          }
+          if (!missing)
+            continue;
+          for (edge_t k = Ac[v]; k < Ac[v + 1]; ++k) {
+            word_t const* y = &visit[(std::size_t)Ai[k] * words];
+            word_t left = 0;
+            for (int w = 0; w < words; ++w) {
+              x[w] |= y[w];
+              left |= all[w] & ~(s[w] | x[w]);
+            }
+            ++scanned;
+            if (!left)
+              break;
+          }
+        }
+      }
+    } else {
+      // Top-down: every frontier vertex ORs its bits into its out-neighbors,
+      // skipping the words that would not add anything.
+      std::fill(next.begin(), next.end(), word_t(0));
+#pragma omp parallel for schedule(dynamic, 256) reduction(+ : scanned)
+      for (vertex_t u = 0; u < n; ++u) {
+        word_t const* y = &visit[(std::size_t)u * words];
+        word_t any = 0;
+        for (int w = 0; w < words; ++w)
+          any |= y[w];
+        if (!any)
+          continue;
+        scanned += Ap[u + 1] - Ap[u];
+        for (edge_t e = Ap[u]; e < Ap[u + 1]; ++e) {
+          std::size_t v = (std::size_t)Aj[e] * words;
+          for (int w = 0; w < words; ++w) {
+            word_t add = y[w] & ~seen[v + w];
+            if (add & ~__atomic_load_n(&next[v + w], __ATOMIC_RELAXED))
+              __atomic_fetch_or(&next[v + w], add, __ATOMIC_RELAXED);
+          }
+        }
+      }
+    }
+
+    // New bits of every vertex become its visit set, and are recorded.
+#pragma omp parallel reduction(+ : next_edges)
+    {
+      auto& tally = local_counts[omp_get_thread_num()];
+      bit_counter_t<words> counter;
+#pragma omp for schedule(static) nowait
+      for (vertex_t v = 0; v < n; ++v) {
+        word_t* s = &seen[(std::size_t)v * words];
+        word_t* x = &next[(std::size_t)v * words];
+        word_t any = 0;
+        for (int w = 0; w < words; ++w) {
+          x[w] &= ~s[w];
+          s[w] |= x[w];
+          any |= x[w];
+        }
+        if (!any)
+          continue;
+        next_edges += Ap[v + 1] - Ap[v];
+        counter.add(x, tally.data(), number_of_sources);
+        if (result.distances)
+          for (int w = 0; w < words; ++w)
+            for (word_t b = x[w]; b; b &= b - 1) {
+              std::size_t source = w * bits + __builtin_ctzll(b);
+              result.distances[(first_source + source) * n + v] = level;
+            }
+      }
+      counter.flush(tally.data(), number_of_sources);
+    }
+
+    for (auto& tally : local_counts)
+      for (int s = 0; s < number_of_sources; ++s) {
+        sums[s] += tally[s] * (std::uint64_t)level;
+        counts[s] += tally[s];
+        tally[s] = 0;
+      }
+
+    visit.swap(next);
+    frontier_edges = next_edges;  // a frontier of sinks reaches nothing.
+
+    stats.levels++;
+    stats.pull_levels += pull;
+    stats.edges += scanned;
+  }
+
+  for (int s = 0; s < number_of_sources; ++s) {
+    if (result.sum_of_distances)
+      result.sum_of_distances[first_source + s] = sums[s];
+    if (result.reached)
+      result.reached[first_source + s] = (vertex_t)counts[s];
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Multi-Source BFS (Then et al., "The More the Merrier: Efficient
+ * Multi-Source Graph Traversal", VLDB'14). The sources are processed in
+ * batches of `options.batch_size`; a batch keeps, for every vertex, a bit per
+ * source in three bitsets (seen, visit, next), so that every edge is scanned
+ * once per level for the whole batch instead of once per source. Levels are
+ * expanded top-down (atomic ORs over the CSR) or, for graphs with a CSC view
+ * and large frontiers, bottom-up (no atomics, early exit once a vertex has
+ * seen every source).
+ *
+ * @param G host graph (`graph::view_t::csr`, optionally `| csc`).
+ * @param sources source vertices (duplicates allowed).
+ * @param number_of_sources number of sources.
+ * @param result outputs, see `result_t`.
+ * @param stats optional output, including the throughput.
+ * @param options see `options_t`.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t& G,
+          typename graph_t::vertex_type const* sources,
+          std::size_t number_of_sources,
+          result_t<typename graph_t::vertex_type> result,
+          stats_t* stats = nullptr,
+          options_t options = options_t()) {
+  using vertex_t = typename graph_t::vertex_type;
+
+  vertex_t n = G.get_number_of_vertices();
+  int batch_size = options.batch_size;
+  if (batch_size != 64 && batch_size != 128 && batch_size != 256 &&
+      batch_size != 512) {
+    std::cerr << "Unsupported multi-source BFS batch size: " << batch_size
+              << " (64, 128, 256 or 512)" << std::endl;
+    exit(1);
+  }
+
+  auto t_start = std::chrono::high_resolution_clock::now();
+
+  if (result.distances) {
+    std::size_t size = number_of_sources * (std::size_t)n;
+#pragma omp parallel for schedule(static)
+    for (std::size_t i = 0; i < size; ++i)
+      result.distances[i] = -1;
+  }
+
+  stats_t local;
+  std::vector<detail::word_t> seen, visit, next;
+  for (std::size_t first = 0; first < number_of_sources;
+       first += batch_size) {
+    int count = (int)std::min<std::size_t>(batch_size,
+                                           number_of_sources - first);
+    // The narrowest bitsets that hold the batch.
+    auto batch = [&](auto words) {
+      detail::run_batch<decltype(words)::value>(
+          G, sources + first, count, first, result, local, options, seen,
+          visit, next);
+    };
+    if (count <= 64)
+      batch(std::integral_constant<int, 1>());
+    else if (count <= 128)
+      batch(std::integral_constant<int, 2>());
+    else if (count <= 256)
+      batch(std::integral_constant<int, 4>());
+    else
+      batch(std::integral_constant<int, 8>());
+    local.batches++;
+  }
+
+  auto t_stop = std::chrono::high_resolution_clock::now();
+  float elapsed =
+      std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+
+  if (stats) {
+    *stats = local;
+    stats->seconds = elapsed * 1e-3;
+    stats->sources_per_second =
+        (elapsed > 0) ? number_of_sources / stats->seconds : 0;
+  }
+  return elapsed;
+}
+
+}  // namespace cpu
+}  // namespace msbfs
+}  // namespace gunrock
@@ -0,0 +1,480 @@
+/**
+ * @file pr.hxx
+ * @brief Cache-blocked, pull-based PageRank on the host (OpenMP), with power
+ * iteration and residual-driven (delta) updates.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/util/math.hxx>
+#include <gunrock/applications/pr.hxx>
+#include <gunrock/applications/cpu/detail/gather.hxx>
+
+namespace gunrock {
+namespace pr {
+namespace cpu {
+
+/**
+ * @brief Update scheme.
+ * - `power`: power iteration, every iteration recomputes every rank from all
+ *   of its in-neighbors; stops when no rank changes by `tol` or more (the
+ *   criterion of `pr::run()`).
+ * - `delta`: after a first power iteration, only the vertices whose pending
+ *   change (residual) exceeds `tol` propagate it to their out-neighbors;
+ *   smaller residuals are kept, not dropped, and propagate once they
+ *   accumulate. Stops when no residual exceeds `tol`.
+ */
+enum mode_t { power, delta };
+
+/**
+ * @brief Direction used to propagate an iteration: pull (every destination
+ * gathers from its in-neighbors over the CSC, cache blocked) or push (the
+ * active vertices scatter to their out-neighbors over the CSR, used by the
+ * `delta` mode when few vertices are active).
+ */
+enum direction_t { push, pull };
+
+struct options_t {
+  mode_t mode{power};
+
+  /*!
+   * Bytes of source values a pull reads per block: in-edges are partitioned
+   * by source into blocks of `block_bytes / sizeof(weight_t)` vertices, and
+   * the blocks are pulled one after the other, so that the random reads of a
+   * block hit the cache. Pick about the last level cache per socket; graphs
+   * with fewer vertices are pulled in one block, straight from the CSC.
+   */
+  std::size_t block_bytes{std::size_t(1) << 20};
+
+  /*!
+   * `delta` mode: push an iteration when the edges out of the active vertices
+   * are less than this fraction of the edges.
+   */
+  double push_threshold{0.05};
+
+  int max_iterations{1000};
+
+  options_t() = default;
+};
+
+/**
+ * @brief Per-iteration statistics: iteration `i` changed the ranks by
+ * `residuals[i]` (L1 norm), processed `active[i]` vertices and `edges[i]`
+ * edges in direction `directions[i]`.
+ */
+template <typename weight_t>
+struct stats_t {
+  int iterations{0};
+  std::size_t blocks{0};  // source blocks of the pulls.
+
+  /*!
+   * `delta` mode: L1 norm of the residuals left (each at most `tol`). The L1
+   * error of the ranks is at most `alpha / (1 - alpha)` times this.
+   */
+  double pending{0};
+
+  std::vector<double> residuals;
+  std::vector<std::size_t> active;
+  std::vector<std::size_t> edges;
+  std::vector<direction_t> directions;
+};
+
+namespace detail {
+
+/**
+ * @brief In-edges partitioned by source block: block `b` lists, for every
+ * destination with in-neighbors in `[b * block, (b + 1) * block)`, those
+ * in-neighbors and the weights of their edges (in CSC order).
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+struct blocked_csc_t {
+  vertex_t block{0};
+  std::size_t number_of_blocks{0};
+  std::vector<std::size_t> block_offsets;  // into `destinations`.
+  std::vector<vertex_t> destinations;
+  std::vector<edge_t> edge_offsets;  // into `sources` and `weights`.
+  std::vector<vertex_t> sources;
+  std::vector<weight_t> weights;
+
+  /**
+   * @brief Partition the CSC (`Ac`, `Ai`, `Ax`) of `n` vertices in blocks of
+   * `_block` sources. The destinations are split in parts of about the same
+   * number of edges; every part is counted, then written, by one thread at
+   * offsets prefix-summed over (block, part), so the layout does not depend on
+   * the number of threads.
+   */
+  void build(vertex_t n,
+             edge_t const* Ac,
+             vertex_t const* Ai,
+             weight_t const* Ax,
+             vertex_t _block) {
+    block = _block;
+    number_of_blocks = ((std::size_t)n + block - 1) / block;
+    std::size_t blocks = number_of_blocks;
+    std::size_t parts = 4 * omp_get_max_threads();
+    edge_t m = Ac[n];
+
+    std::vector<vertex_t> part_offsets(parts + 1);
+    for (std::size_t p = 0; p <= parts; ++p)
+      part_offsets[p] = (vertex_t)(std::upper_bound(
+                                       Ac, Ac + n,
+                                       (edge_t)((std::int64_t)m * p / parts)) -
+                                   Ac - 1);
+    part_offsets[0] = 0;
+    part_offsets[parts] = n;
+
+    // Destinations and edges of every (part, block).
+    std::vector<std::size_t> destination_counts(parts * blocks, 0);
+    std::vector<std::size_t> edge_counts(parts * blocks, 0);
+#pragma omp parallel
+    {
+      std::vector<vertex_t> last(blocks, -1);
+#pragma omp for schedule(dynamic, 1)
+      for (std::size_t p = 0; p < parts; ++p)
+        for (vertex_t v = part_offsets[p]; v < part_offsets[p + 1]; ++v)
+          for (edge_t k = Ac[v]; k < Ac[v + 1]; ++k) {
+            std::size_t b = Ai[k] / block;
+            edge_counts[p * blocks + b]++;
+            if (last[b] != v) {
+              last[b] = v;
+              destination_counts[p * blocks + b]++;
+            }
+          }
+    }
+
+    // Block-major offsets, parts in order within a block.
+    block_offsets.assign(blocks + 1, 0);
+    std::vector<std::size_t> destination_starts(parts * blocks);
+    std::vector<std::size_t> edge_starts(parts * blocks);
+    std::size_t destination = 0, edge = 0;
+    for (std::size_t b = 0; b < blocks; ++b) {
+      block_offsets[b] = destination;
+      for (std::size_t p = 0; p < parts; ++p) {
+        destination_starts[p * blocks + b] = destination;
+        edge_starts[p * blocks + b] = edge;
+        destination += destination_counts[p * blocks + b];
+        edge += edge_counts[p * blocks + b];
+      }
+    }
+    block_offsets[blocks] = destination;
+
+    destinations.resize(destination);
+    edge_offsets.resize(destination + 1);
+    edge_offsets[destination] = m;
+    sources.resize(m);
+    weights.resize(m);
+
+#pragma omp parallel
+    {
+      std::vector<edge_t> counts(blocks, 0);
+      std::vector<std::size_t> slots(blocks);
+      std::vector<std::size_t> touched;
+#pragma omp for schedule(dynamic, 1)
+      for (std::size_t p = 0; p < parts; ++p) {
+        std::size_t* next_destination = &destination_starts[p * blocks];
+        std::size_t* next_edge = &edge_starts[p * blocks];
+        for (vertex_t v = part_offsets[p]; v < part_offsets[p + 1]; ++v) {
+          touched.clear();
+          for (edge_t k = Ac[v]; k < Ac[v + 1]; ++k) {
+            std::size_t b = Ai[k] / block;
+            if (counts[b]++ == 0)
+              touched.push_back(b);
+          }
+          for (auto b : touched) {
+            destinations[next_destination[b]] = v;
+            edge_offsets[next_destination[b]++] = (edge_t)next_edge[b];
+            slots[b] = next_edge[b];
+            next_edge[b] += counts[b];
+            counts[b] = 0;
+          }
+          for (edge_t k = Ac[v]; k < Ac[v + 1]; ++k) {
+            std::size_t slot = slots[Ai[k] / block]++;
+            sources[slot] = Ai[k];
+            weights[slot] = Ax[k];
+          }
+        }
+      }
+    }
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief PageRank on the host, with the semantics of `pr::run()`: every
+ * vertex `u` spreads `alpha * p[u]` to its out-neighbors in proportion to the
+ * weights of its out-edges; vertices without out-weight (dangling) spread it
+ * to all the vertices, as does the teleport term `(1 - alpha)`.
+ *
+ * @par Overview
+ * An iteration first scales every rank by `alpha` over its out-weight (a
+ * sequential pass), then pulls: every destination sums the scaled ranks of
+ * its in-neighbors over the CSC, each destination written by one thread, no
+ * atomics. When the scaled ranks do not fit in `options.block_bytes`, the
+ * in-edges are partitioned by source block once per run (propagation
+ * blocking, see `detail::blocked_csc_t`) and the blocks are pulled one after
+ * the other, so the random reads of a block stay in the cache.
+ *
+ * The `delta` mode (see `mode_t`) propagates residuals instead of ranks; a
+ * pull skips the blocks without active sources, and iterations with few
+ * active vertices push from them over the CSR instead (atomic adds, see
+ * `options_t::push_threshold`), so late iterations only touch the edges of
+ * the vertices that still change.
+ *
+ * @param G host graph (`graph::view_t::csr | graph::view_t::csc`).
+ * @param param damping factor `alpha` and tolerance `tol`.
+ * @param result output, `result.p` gets the ranks.
+ * @param stats optional output, iteration count and per-iteration L1
+ * residuals.
+ * @param options see `options_t`.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t& G,
+          param_t<typename graph_t::weight_type> const& param,
+          result_t<typename graph_t::weight_type> result,
+          stats_t<typename graph_t::weight_type>* stats = nullptr,
+          options_t options = options_t()) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  static_assert(
+      std::is_base_of_v<typename graph_t::graph_csc_view_t, graph_t>,
+      "pr::cpu::run() pulls over the CSC, build the graph with "
+      "graph::view_t::csc.");
+
+  auto t_start = std::chrono::high_resolution_clock::now();
+
+  vertex_t n = G.get_number_of_vertices();
+  edge_t m = G.get_number_of_edges();
+  weight_t alpha = param.alpha;
+  weight_t tol = param.tol;
+  weight_t* p = result.p;
+
+  auto const& csr = static_cast<typename graph_t::graph_csr_view_t const&>(G);
+  auto const& csc = static_cast<typename graph_t::graph_csc_view_t const&>(G);
+  edge_t const* Ap = csr.get_row_offsets();
+  vertex_t const* Aj = csr.get_column_indices();
+  weight_t const* Ax = csr.get_nonzero_values();
+  edge_t const* Ac = csc.get_column_offsets();
+  vertex_t const* Ai = csc.get_row_indices();
+  weight_t const* Ay = csc.get_nonzero_values();
+
+  if (stats) {
+    *stats = stats_t<weight_t>();
+    stats->blocks = 1;
+  }
+  if (n == 0)
+    return 0;
+
+  // `alpha` over the out-weight, 0 for the dangling vertices.
+  std::vector<weight_t> scale(n);
+#pragma omp parallel for schedule(static)
+  for (vertex_t u = 0; u < n; ++u) {
+    weight_t out = 0;
+    for (edge_t e = Ap[u]; e < Ap[u + 1]; ++e)
+      out += Ax[e];
+    scale[u] = (out != 0) ? alpha / out : 0;
+    p[u] = weight_t(1) / n;
+  }
+
+  // Blocks of sources, if the scaled ranks outgrow one.
+  vertex_t block = (vertex_t)std::max<std::size_t>(
+      64, options.block_bytes / sizeof(weight_t));
+  bool blocked = block < n;
+  detail::blocked_csc_t<vertex_t, edge_t, weight_t> blocks;
+  if (blocked) {
+    blocks.build(n, Ac, Ai, Ay, block);
+    if (stats)
+      stats->blocks = blocks.number_of_blocks;
+  }
+
+  std::vector<weight_t> x(n);    // scaled ranks (or residuals) to spread.
+  std::vector<weight_t> sum(n);  // gathered by every destination.
+  std::vector<weight_t> residual(options.mode == delta ? n : 0);
+  std::vector<char> active_blocks(blocked ? blocks.number_of_blocks : 0, 1);
+  std::vector<vertex_t> frontier;
+  std::vector<std::vector<vertex_t>> buffers(omp_get_max_threads());
+
+  // sum = A x, over the in-edges of the blocks with an active source.
+  auto gather = [&]() {
+    if (!blocked) {
+#pragma omp parallel for schedule(dynamic, 256)
+      for (vertex_t v = 0; v < n; ++v) {
+        weight_t s = 0;
+        for (edge_t k = Ac[v]; k < Ac[v + 1]; ++k)
+          s += x[Ai[k]] * Ay[k];
+        sum[v] = s;
+      }
+      return;
+    }
+
+    std::fill(sum.begin(), sum.end(), weight_t(0));
+    vertex_t const* destinations = blocks.destinations.data();
+    edge_t const* offsets = blocks.edge_offsets.data();
+    vertex_t const* sources = blocks.sources.data();
+    weight_t const* weights = blocks.weights.data();
+#pragma omp parallel
+    for (std::size_t b = 0; b < blocks.number_of_blocks; ++b) {
+      if (!active_blocks[b])
+        continue;
+      // A destination appears once per block; the blocks are sequential.
+#pragma omp for schedule(dynamic, 256)
+      for (std::size_t i = blocks.block_offsets[b];
+           i < blocks.block_offsets[b + 1]; ++i) {
+        weight_t s = 0;
+        for (edge_t k = offsets[i]; k < offsets[i + 1]; ++k)
+          s += x[sources[k]] * weights[k];
+        sum[destinations[i]] += s;
+      }
+    }
+  };
+
+  // sum = A x, from the vertices of `frontier` over their out-edges.
+  auto scatter = [&]() {
+    std::fill(sum.begin(), sum.end(), weight_t(0));
+#pragma omp parallel for schedule(dynamic, 64)
+    for (std::size_t i = 0; i < frontier.size(); ++i) {
+      vertex_t u = frontier[i];
+      for (edge_t e = Ap[u]; e < Ap[u + 1]; ++e)
+        math::atomic::add(&sum[Aj[e]], x[u] * Ax[e]);
+    }
+  };
+
+  auto record = [&](double l1, std::size_t active, std::size_t edges,
+                    direction_t direction) {
+    if (!stats)
+      return;
+    stats->residuals.push_back(l1);
+    stats->active.push_back(active);
+    stats->edges.push_back(edges);
+    stats->directions.push_back(direction);
+  };
+
+  int iteration = 0;
+  for (; iteration < options.max_iterations; ++iteration) {
+    if (options.mode == power || iteration == 0) {
+      // Power iteration (also the first iteration of the delta mode).
+      double dangling = 0;
+#pragma omp parallel for schedule(static) reduction(+ : dangling)
+      for (vertex_t u = 0; u < n; ++u) {
+        x[u] = scale[u] * p[u];
+        if (scale[u] == 0)
+          dangling += alpha * p[u];
+      }
+
+      gather();
+
+      weight_t base = (weight_t)((1 - alpha + dangling) / n);
+      double l1 = 0;
+      weight_t largest = 0;
+#pragma omp parallel for schedule(static) reduction(+ : l1) \
+    reduction(max : largest)
+      for (vertex_t v = 0; v < n; ++v) {
+        weight_t next = base + sum[v];
+        weight_t change = next - p[v];
+        l1 += std::abs(change);
+        largest = std::max(largest, std::abs(change));
+        if (options.mode == delta)
+          residual[v] = change;
+        p[v] = next;
+      }
+
+      record(l1, n, m, pull);
+      if (options.mode == power && largest < tol) {
+        ++iteration;
+        break;
+      }
+      continue;
+    }
+
+    // Delta: propagate the residuals above `tol`, keep the others.
+    std::fill(active_blocks.begin(), active_blocks.end(), 0);
+    double dangling = 0;
+    std::size_t active_edges = 0;
+#pragma omp parallel reduction(+ : dangling, active_edges)
+    {
+      auto& local = buffers[omp_get_thread_num()];
+      local.clear();
+#pragma omp for schedule(static)
+      for (vertex_t u = 0; u < n; ++u) {
+        x[u] = 0;
+        if (std::abs(residual[u]) <= tol)
+          continue;
+        x[u] = scale[u] * residual[u];
+        if (scale[u] == 0)
+          dangling += alpha * residual[u];
+        residual[u] = 0;
+        local.push_back(u);
+        active_edges += Ap[u + 1] - Ap[u];
+        if (blocked)
+          __atomic_store_n(&active_blocks[u / block], 1, __ATOMIC_RELAXED);
+      }
+    }
+    gunrock::cpu::detail::gather(buffers, frontier);
+    if (frontier.empty())
+      break;
+
+    direction_t direction =
+        (active_edges < options.push_threshold * m) ? push : pull;
+    std::size_t edges = active_edges;
+    if (direction == push) {
+      scatter();
+    } else {
+      gather();
+      if (blocked) {
+        edges = 0;
+        for (std::size_t b = 0; b < blocks.number_of_blocks; ++b)
+          if (active_blocks[b])
+            edges += blocks.edge_offsets[blocks.block_offsets[b + 1]] -
+                     blocks.edge_offsets[blocks.block_offsets[b]];
+      } else {
+        edges = m;
+      }
+    }
+
+    weight_t base = (weight_t)(dangling / n);
+    double l1 = 0;
+#pragma omp parallel for schedule(static) reduction(+ : l1)
+    for (vertex_t v = 0; v < n; ++v) {
+      weight_t change = base + sum[v];
+      p[v] += change;
+      residual[v] += change;
+      l1 += std::abs(change);
+    }
+
+    record(l1, frontier.size(), edges, direction);
+  }
+
+  if (stats) {
+    stats->iterations = iteration;
+    if (options.mode == delta) {
+      double pending = 0;
+#pragma omp parallel for schedule(static) reduction(+ : pending)
+      for (vertex_t v = 0; v < n; ++v)
+        pending += std::abs(residual[v]);
+      stats->pending = pending;
+    }
+  }
+
+  auto t_stop = std::chrono::high_resolution_clock::now();
+  return std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+}
+
+}  // namespace cpu
+}  // namespace pr
+}  // namespace gunrock
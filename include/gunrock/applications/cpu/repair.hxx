@@ -0,0 +1,232 @@
+/**
+ * @file repair.hxx
+ * @brief Incremental BFS and SSSP on the host: repair distances and
+ * predecessors after a batch of edge updates, from the affected vertices
+ * only.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/formats/dynamic_csr.hxx>
+
+namespace gunrock {
+namespace repair {
+namespace cpu {
+
+/**
+ * @brief Cost of a repair: the vertices whose shortest path was cut by the
+ * batch (`invalidated`), the vertices settled again (`settled`, including
+ * those improved by insertions) and the edges scanned.
+ */
+struct stats_t {
+  std::size_t updates{0};
+  std::size_t invalidated{0};
+  std::size_t settled{0};
+  std::size_t edges{0};
+};
+
+namespace detail {
+
+/**
+ * @brief Repair for non-negative weights `weight_of(graph, edge)`;
+ * `infinity` marks unreachable vertices. See `sssp()`.
+ */
+template <typename graph_t,
+          typename reverse_graph_t,
+          typename update_t,
+          typename distance_t,
+          typename weight_op_t>
+float repair(graph_t& G,
+             reverse_graph_t& R,
+             typename graph_t::vertex_type const& single_source,
+             update_t const* updates,
+             std::size_t count,
+             distance_t* distances,
+             typename graph_t::vertex_type* predecessors,
+             distance_t infinity,
+             weight_op_t weight_of,
+             stats_t* stats) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using entry_t = std::pair<distance_t, vertex_t>;
+
+  auto t_start = std::chrono::high_resolution_clock::now();
+
+  std::size_t edges = 0, settled = 0;
+  auto shorter = [&](distance_t candidate, vertex_t v) {
+    return distances[v] == infinity || candidate < distances[v];
+  };
+
+  // 1. Roots of the cut subtrees: tree edges erased or made heavier.
+  std::vector<vertex_t> invalidated;
+  for (std::size_t k = 0; k < count; ++k) {
+    vertex_t u = updates[k].source, v = updates[k].destination;
+    if (v == single_source || predecessors[v] != u ||
+        distances[v] == infinity)
+      continue;
+    edge_t e = G.get_edge(u, v);
+    if (!gunrock::util::limits::is_valid(e) ||
+        distances[v] < distances[u] + weight_of(G, e)) {
+      distances[v] = infinity;
+      predecessors[v] = -1;
+      invalidated.push_back(v);
+    }
+  }
+
+  // 2. Cut subtrees: the children of an invalidated vertex (tree edges are
+  // graph edges) are invalidated too.
+  for (std::size_t i = 0; i < invalidated.size(); ++i) {
+    vertex_t u = invalidated[i];
+    G.for_each_neighbor(u, [&](vertex_t const& v, edge_t const&) {
+      ++edges;
+      if (predecessors[v] == u && distances[v] != infinity) {
+        distances[v] = infinity;
+        predecessors[v] = -1;
+        invalidated.push_back(v);
+      }
+    });
+  }
+
+  // 3. Seeds: invalidated vertices from their valid in-neighbors, and the
+  // endpoints of inserted (or lighter) edges.
+  std::priority_queue<entry_t, std::vector<entry_t>, std::greater<entry_t>>
+      queue;
+  for (vertex_t v : invalidated)
+    R.for_each_neighbor(v, [&](vertex_t const& u, edge_t const& e) {
+      ++edges;
+      if (distances[u] != infinity &&
+          shorter(distances[u] + weight_of(R, e), v)) {
+        distances[v] = distances[u] + weight_of(R, e);
+        predecessors[v] = u;
+      }
+    });
+  for (vertex_t v : invalidated)
+    if (distances[v] != infinity)
+      queue.emplace(distances[v], v);
+
+  for (std::size_t k = 0; k < count; ++k) {
+    vertex_t u = updates[k].source, v = updates[k].destination;
+    if (updates[k].op != format::update_t::insert || v == single_source ||
+        distances[u] == infinity)
+      continue;
+    edge_t e = G.get_edge(u, v);
+    if (gunrock::util::limits::is_valid(e) &&
+        shorter(distances[u] + weight_of(G, e), v)) {
+      distances[v] = distances[u] + weight_of(G, e);
+      predecessors[v] = u;
+      queue.emplace(distances[v], v);
+    }
+  }
+
+  // 4. Dijkstra from the seeds, over the affected region only.
+  while (!queue.empty()) {
+    auto [d, u] = queue.top();
+    queue.pop();
+    if (d != distances[u])
+      continue;  // stale.
+    ++settled;
+    G.for_each_neighbor(u, [&](vertex_t const& v, edge_t const& e) {
+      ++edges;
+      distance_t candidate = d + weight_of(G, e);
+      if (v != single_source && shorter(candidate, v)) {
+        distances[v] = candidate;
+        predecessors[v] = u;
+        queue.emplace(candidate, v);
+      }
+    });
+  }
+
+  auto t_stop = std::chrono::high_resolution_clock::now();
+
+  if (stats) {
+    stats->updates = count;
+    stats->invalidated = invalidated.size();
+    stats->settled = settled;
+    stats->edges = edges;
+  }
+
+  return std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+}
+
+}  // namespace detail
+
+/**
+ * @brief Repair single-source shortest paths after a batch of edge updates
+ * (Ramalingam & Reps, 1996). `distances` and `predecessors` are a shortest
+ * path tree of the graph before the batch (e.g. from `sssp::cpu::run()` or an
+ * earlier repair); `G` and `R` are the graph after the batch.
+ * 1. Vertices whose tree edge was erased or made heavier, and their
+ *    subtrees, are invalidated (the only distances that can grow).
+ * 2. Invalidated vertices are seeded from their valid in-neighbors, and the
+ *    heads of inserted edges from their tails.
+ * 3. Dijkstra from the seeds settles the invalidated vertices and the
+ *    vertices improved by insertions.
+ * The work is proportional to the affected region (and its adjacency), not
+ * to the graph.
+ *
+ * @param G host graph after the batch, with `get_edge()` (e.g.
+ * `graph::view_t::dynamic_csr`).
+ * @param R reverse graph of `G` (the transposed batch applied to the
+ * transposed graph), or `G` itself if it is symmetric.
+ * @param single_source source vertex.
+ * @param updates the batch applied (see `format::edge_update_t`).
+ * @param count number of updates.
+ * @param distances input/output, shortest distances (max() if unreachable).
+ * @param predecessors input/output, shortest path tree (-1 for the source
+ * and unreachable vertices).
+ * @param stats optional output.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t, typename reverse_graph_t, typename update_t>
+float sssp(graph_t& G,
+           reverse_graph_t& R,
+           typename graph_t::vertex_type const& single_source,
+           update_t const* updates,
+           std::size_t count,
+           typename graph_t::weight_type* distances,
+           typename graph_t::vertex_type* predecessors,
+           stats_t* stats = nullptr) {
+  using weight_t = typename graph_t::weight_type;
+  return detail::repair(
+      G, R, single_source, updates, count, distances, predecessors,
+      std::numeric_limits<weight_t>::max(),
+      [](auto const& H, auto const& e) { return H.get_edge_weight(e); },
+      stats);
+}
+
+/**
+ * @brief Repair a BFS (depths and tree) after a batch of edge updates, see
+ * `sssp()` (with unit weights). Distances are -1 if unreachable, as in
+ * `bfs::cpu::run()`.
+ */
+template <typename graph_t, typename reverse_graph_t, typename update_t>
+float bfs(graph_t& G,
+          reverse_graph_t& R,
+          typename graph_t::vertex_type const& single_source,
+          update_t const* updates,
+          std::size_t count,
+          typename graph_t::vertex_type* distances,
+          typename graph_t::vertex_type* predecessors,
+          stats_t* stats = nullptr) {
+  using vertex_t = typename graph_t::vertex_type;
+  return detail::repair(
+      G, R, single_source, updates, count, distances, predecessors,
+      vertex_t(-1), [](auto const&, auto const&) { return vertex_t(1); },
+      stats);
+}
+
+}  // namespace cpu
+}  // namespace repair
+}  // namespace gunrock
@@ -0,0 +1,408 @@
+/**
+ * @file sssp.hxx
+ * @brief Delta-stepping Single-Source Shortest Path on the host (OpenMP).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/util/math.hxx>
+#include <gunrock/applications/cpu/detail/gather.hxx>
+
+namespace gunrock {
+namespace sssp {
+namespace cpu {
+
+/**
+ * @brief Statistics of a delta-stepping run.
+ */
+template <typename weight_t>
+struct stats_t {
+  weight_t delta{0};           // bucket width used.
+  std::size_t buckets{0};      // non-empty buckets processed.
+  std::size_t light_phases{0};  // light-edge relaxation rounds.
+  std::size_t relaxations{0};  // successful relaxations (distance updates).
+};
+
+/**
+ * @brief Pick the bucket width from the weight distribution. Meyer and
+ * Sanders show that for uniformly distributed weights a width of about
+ * `1/d` of the weight range (for average degree `d`) keeps the number of
+ * re-relaxations constant per vertex while exposing enough parallelism per
+ * bucket. We use the matching quantile of a (deterministic) sample of the
+ * weights, so that every vertex has a small, constant number of light edges
+ * regardless of the weight distribution.
+ */
+template <typename graph_t>
+typename graph_t::weight_type select_delta(graph_t& G) {
+  using edge_t = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+
+  constexpr std::int64_t sample_size = 1 << 16;
+  constexpr double light_edges_per_vertex = 4;
+
+  std::int64_t n = G.get_number_of_vertices();
+  std::int64_t m = G.get_number_of_edges();
+  if (m == 0)
+    return weight_t(1);
+
+  weight_t const* Ax =
+      static_cast<typename graph_t::graph_csr_view_t const&>(G)
+          .get_nonzero_values();
+  std::int64_t stride = std::max<std::int64_t>(1, m / sample_size);
+
+  std::vector<weight_t> sample;
+  sample.reserve(m / stride + 1);
+  for (edge_t e = 0; e < m; e += stride)
+    if (Ax[e] > weight_t(0))
+      sample.push_back(Ax[e]);
+
+  if (sample.empty())
+    return weight_t(1);  // all zero weights.
+
+  double average_degree = (double)m / std::max<std::int64_t>(1, n);
+  double quantile = std::min(1.0, light_edges_per_vertex / average_degree);
+  std::size_t k = std::min(sample.size() - 1,
+                           (std::size_t)(quantile * (sample.size() - 1)));
+
+  std::nth_element(sample.begin(), sample.begin() + k, sample.end());
+  return sample[k];
+}
+
+/**
+ * @brief Parallel delta-stepping SSSP (Meyer & Sanders, 2003). Vertices are
+ * kept in buckets of width `delta` by tentative distance. Buckets are
+ * processed in increasing order: light edges (weight <= delta) of the current
+ * bucket are relaxed repeatedly until the bucket stays empty, then heavy edges
+ * of all the vertices settled in that bucket are relaxed once.
+ *
+ * Every thread owns its bucket array (no shared queue, no locks); distances
+ * are updated with an atomic min. A window of buckets is kept in arrays, the
+ * rest in a "far" pile that is redistributed when the window is exhausted.
+ * Adjacencies are split into light and heavy edges once per run.
+ * Predecessors are computed after convergence from the final distances (the
+ * smallest tight in-neighbor closer to the source, then, for vertices only
+ * reached through zero-weight edges, the smallest tight in-neighbor with the
+ * fewest such hops), so they are consistent with the distances, form a tree
+ * and do not depend on the number of threads.
+ *
+ * @note This is the host entry point of bucketed SSSP; it is called directly
+ * rather than through an advance (`operators::load_balance_t` only selects
+ * the advance kernels).
+ *
+ * @param G host graph (`graph::view_t::csr`), non-negative weights.
+ * @param single_source source vertex.
+ * @param distances output, shortest distances (max() if unreachable).
+ * @param predecessors output, shortest path tree (-1 for the source and
+ * unreachable vertices).
+ * @param delta bucket width, 0 selects it from the weights (`select_delta`).
+ * @param stats optional output.
+ * @return float elapsed time in milliseconds.
+ */
+template <typename graph_t>
+float run(graph_t& G,
+          typename graph_t::vertex_type const& single_source,
+          typename graph_t::weight_type* distances,
+          typename graph_t::vertex_type* predecessors,
+          typename graph_t::weight_type delta = 0,
+          stats_t<typename graph_t::weight_type>* stats = nullptr) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using weight_t = typename graph_t::weight_type;
+  using bucket_t = std::size_t;
+
+  constexpr weight_t infinity = std::numeric_limits<weight_t>::max();
+  constexpr bucket_t no_bucket = std::numeric_limits<bucket_t>::max();
+
+  vertex_t n = G.get_number_of_vertices();
+  edge_t m = G.get_number_of_edges();
+  auto const& csr = static_cast<typename graph_t::graph_csr_view_t const&>(G);
+  edge_t const* Ap = csr.get_row_offsets();
+  vertex_t const* Aj = csr.get_column_indices();
+  weight_t const* Ax = csr.get_nonzero_values();
+
+  auto t_start = std::chrono::high_resolution_clock::now();
+
+  if (delta <= weight_t(0))
+    delta = select_delta(G);
+
+  // Split every adjacency into light edges first, then heavy edges.
+  std::vector<vertex_t> targets(m);
+  std::vector<weight_t> weights(m);
+  std::vector<edge_t> light_end(n);
+
+#pragma omp parallel for schedule(dynamic, 1024)
+  for (vertex_t v = 0; v < n; ++v) {
+    edge_t light = Ap[v];
+    for (edge_t e = Ap[v]; e < Ap[v + 1]; ++e)
+      if (Ax[e] <= delta) {
+        targets[light] = Aj[e];
+        weights[light++] = Ax[e];
+      }
+    light_end[v] = light;
+    for (edge_t e = Ap[v]; e < Ap[v + 1]; ++e)
+      if (!(Ax[e] <= delta)) {
+        targets[light] = Aj[e];
+        weights[light++] = Ax[e];
+      }
+
+    distances[v] = infinity;
+    predecessors[v] = -1;
+  }
+
+  distances[single_source] = 0;
+
+  // Buckets [base, base + window) live in per-thread arrays, entries beyond
+  // go to a per-thread "far" pile that is redistributed once the window is
+  // exhausted. This bounds memory regardless of the distance/delta ratio.
+  constexpr bucket_t window = 1 << 12;
+
+  struct local_buckets_t {
+    std::vector<std::vector<vertex_t>> near;
+    std::vector<vertex_t> far;
+    std::vector<vertex_t> settled;
+  };
+
+  int threads = omp_get_max_threads();
+  std::vector<local_buckets_t> locals(threads);
+  std::vector<std::vector<vertex_t>> to_gather(threads);
+  std::vector<vertex_t> frontier(1, single_source);
+  std::vector<vertex_t> removed;
+
+  for (auto& local : locals)
+    local.near.resize(window);
+
+  bucket_t base = 0;
+  bucket_t current = 0;
+  std::size_t buckets = 0, light_phases = 0, relaxations = 0;
+
+  // Bucket of a distance. Staleness and settledness are decided on these
+  // indices too: comparing `d` against `delta * bucket` instead rounds
+  // differently, and could skip a vertex as stale in the bucket it was put in.
+  auto index_of = [&](weight_t d) { return (bucket_t)(d / delta); };
+  auto bucket_of = [&](weight_t d) { return std::max(current, index_of(d)); };
+
+  // Relax edges [begin, end) of `u`, new entries go to this thread's buckets.
+  auto relax = [&](vertex_t u, edge_t begin, edge_t end,
+                   local_buckets_t& local, std::size_t& updates) {
+    weight_t du = distances[u];
+    for (edge_t e = begin; e < end; ++e) {
+      vertex_t v = targets[e];
+      weight_t candidate = du + weights[e];
+      weight_t dv;
+      __atomic_load(&distances[v], &dv, __ATOMIC_RELAXED);
+      if (candidate < dv &&
+          candidate < math::atomic::min(&distances[v], candidate)) {
+        if (index_of(candidate) < base + window)
+          local.near[std::min(bucket_of(candidate) - base, window - 1)]
+              .push_back(v);
+        else
+          local.far.push_back(v);
+        ++updates;
+      }
+    }
+  };
+
+  // Move this thread's share of bucket `current` into `to_gather`.
+  auto hand_over = [&](int t) {
+    to_gather[t].clear();
+    to_gather[t].swap(locals[t].near[current - base]);
+  };
+
+  while (true) {
+    ++buckets;
+
+    // Light phases: until the current bucket stays empty.
+    while (!frontier.empty()) {
+      ++light_phases;
+
+#pragma omp parallel reduction(+ : relaxations)
+      {
+        int t = omp_get_thread_num();
+        auto& local = locals[t];
+#pragma omp for schedule(dynamic, 64)
+        for (std::size_t i = 0; i < frontier.size(); ++i) {
+          vertex_t u = frontier[i];
+          if (index_of(distances[u]) < current)
+            continue;  // stale, settled in an earlier bucket.
+          local.settled.push_back(u);
+          relax(u, Ap[u], light_end[u], local, relaxations);
+        }
+        hand_over(t);
+      }
+
+      gunrock::cpu::detail::gather(to_gather, frontier);
+    }
+
+    // Heavy phase: once per settled vertex (relaxing a duplicate again is
+    // harmless, the distance check filters it).
+    for (int t = 0; t < threads; ++t)
+      to_gather[t].swap(locals[t].settled);
+    gunrock::cpu::detail::gather(to_gather, removed, true /* clear */);
+
+    bucket_t next = no_bucket;
+    std::size_t far = 0;
+#pragma omp parallel reduction(+ : relaxations, far) reduction(min : next)
+    {
+      int t = omp_get_thread_num();
+      auto& local = locals[t];
+#pragma omp for schedule(dynamic, 64)
+      for (std::size_t i = 0; i < removed.size(); ++i) {
+        vertex_t u = removed[i];
+        relax(u, light_end[u], Ap[u + 1], local, relaxations);
+      }
+
+      for (bucket_t b = current + 1 - base; b < window; ++b)
+        if (!local.near[b].empty()) {
+          next = std::min(next, base + b);
+          break;
+        }
+      far += local.far.size();
+    }
+
+    if (next == no_bucket) {
+      if (far == 0)
+        break;  // done.
+
+      // Window exhausted: slide it to the smallest bucket in the far piles.
+      for (int t = 0; t < threads; ++t)
+        to_gather[t].swap(locals[t].far);
+      gunrock::cpu::detail::gather(to_gather, removed, true /* clear */);
+
+      bucket_t settled = current;
+      weight_t smallest = infinity;
+#pragma omp parallel for reduction(min : smallest)
+      for (std::size_t i = 0; i < removed.size(); ++i)
+        if (index_of(distances[removed[i]]) > settled)
+          smallest = std::min(smallest, distances[removed[i]]);
+
+      if (smallest == infinity)
+        break;  // only stale entries left.
+
+      current = base = bucket_of(smallest);
+
+#pragma omp parallel
+      {
+        auto& local = locals[omp_get_thread_num()];
+#pragma omp for schedule(static)
+        for (std::size_t i = 0; i < removed.size(); ++i) {
+          vertex_t v = removed[i];
+          weight_t d = distances[v];
+          if (index_of(d) <= settled)
+            continue;  // stale.
+          if (index_of(d) < base + window)
+            local.near[std::min(bucket_of(d) - base, window - 1)].push_back(v);
+          else
+            local.far.push_back(v);
+        }
+      }
+    } else {
+      current = next;
+    }
+
+#pragma omp parallel
+    hand_over(omp_get_thread_num());
+    gunrock::cpu::detail::gather(to_gather, frontier);
+  }
+
+  // Predecessors: smallest in-neighbor on a shortest path that is strictly
+  // closer to the source. Tight in-neighbors at the same distance (zero
+  // weights, or weights lost to rounding) could point at each other.
+  auto attach = [&](vertex_t v, vertex_t u) {
+    vertex_t current = __atomic_load_n(&predecessors[v], __ATOMIC_RELAXED);
+    while ((current == -1 || u < current) &&
+           !__atomic_compare_exchange_n(&predecessors[v], &current, u, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+      ;
+  };
+
+  std::size_t detached = 0;
+#pragma omp parallel for schedule(dynamic, 1024)
+  for (vertex_t u = 0; u < n; ++u) {
+    if (distances[u] == infinity)
+      continue;
+    for (edge_t e = Ap[u]; e < Ap[u + 1]; ++e) {
+      vertex_t v = targets[e];
+      if (v != single_source && distances[u] < distances[v] &&
+          distances[u] + weights[e] == distances[v])
+        attach(v, u);
+    }
+  }
+
+#pragma omp parallel for reduction(+ : detached)
+  for (vertex_t v = 0; v < n; ++v)
+    detached += (v != single_source && distances[v] != infinity &&
+                 predecessors[v] == -1);
+
+  // The rest is only reached through ties: attach it in rounds, to the
+  // smallest tight in-neighbor attached in the previous round. Every
+  // predecessor is attached before its successors, so there are no cycles.
+  if (detached > 0) {
+    std::vector<int> rounds(n);
+#pragma omp parallel
+    {
+      int t = omp_get_thread_num();
+      to_gather[t].clear();
+#pragma omp for schedule(static)
+      for (vertex_t v = 0; v < n; ++v) {
+        bool attached = (v == single_source || predecessors[v] != -1);
+        rounds[v] = attached ? 0 : -1;
+        if (attached && distances[v] != infinity)
+          to_gather[t].push_back(v);
+      }
+    }
+    gunrock::cpu::detail::gather(to_gather, frontier);
+
+    for (int round = 1; !frontier.empty(); ++round) {
+#pragma omp parallel
+      {
+        int t = omp_get_thread_num();
+        to_gather[t].clear();
+#pragma omp for schedule(dynamic, 64)
+        for (std::size_t i = 0; i < frontier.size(); ++i) {
+          vertex_t u = frontier[i];
+          for (edge_t e = Ap[u]; e < Ap[u + 1]; ++e) {
+            vertex_t v = targets[e];
+            if (distances[v] != distances[u] ||
+                distances[u] + weights[e] != distances[v])
+              continue;
+            int seen = -1;
+            if (__atomic_compare_exchange_n(&rounds[v], &seen, round, false,
+                                            __ATOMIC_RELAXED,
+                                            __ATOMIC_RELAXED))
+              to_gather[t].push_back(v);
+            if (seen == -1 || seen == round)
+              attach(v, u);
+          }
+        }
+      }
+      gunrock::cpu::detail::gather(to_gather, frontier);
+    }
+  }
+
+  auto t_stop = std::chrono::high_resolution_clock::now();
+
+  if (stats) {
+    stats->delta = delta;
+    stats->buckets = buckets;
+    stats->light_phases = light_phases;
+    stats->relaxations = relaxations;
+  }
+
+  return std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+}
+
+}  // namespace cpu
+}  // namespace sssp
+}  // namespace gunrock
@@ -404,8 +404,8 @@ template <typename graph_t>
 float run(graph_t& G,
           coordinates_t* coordinates,              // Input/Output
           unsigned int& total_iterations,          // Parameter
-          unsigned int& spatial_iterations = 1000  // Parameter
-) {
+          unsigned int& spatial_iterations = 1000,  // Parameter
+          enactor_properties_t properties = enactor_properties_t()) {
   // <user-defined>
   using param_type = param_t;
   using result_type = result_t;
@@ -434,7 +434,7 @@ float run(graph_t& G,
   problem.init();
   problem.reset();
 
-  enactor_type enactor(&problem, multi_context);
+  enactor_type enactor(&problem, multi_context, properties);
   return enactor.enact();
   // </boiler-plate>
 }
@@ -48,9 +48,9 @@ struct problem_t : gunrock::problem_t<graph_t> {
   using edge_t = typename graph_t::edge_type;
   using weight_t = typename graph_t::weight_type;
 
-  thrust::device_vector<weight_t>
+  vector_t<weight_t, graph_t::memory_space()>
       plast;  // pagerank values from previous iteration
-  thrust::device_vector<weight_t>
+  vector_t<weight_t, graph_t::memory_space()>
       iweights;  // alpha * 1 / (sum of outgoing weights) -- used to determine
                  // out of mass spread from src to dst
 
@@ -62,8 +62,8 @@ struct problem_t : gunrock::problem_t<graph_t> {
   }
 
   void reset() override {
-    // Execution policy for a given context (using single-gpu).
-    auto policy = this->context->get_context(0)->execution_policy();
+    // Execution policy for the graph's memory space (using single-gpu).
+    auto policy = this->get_execution_policy();
 
     auto g = this->get_graph();
 
@@ -74,7 +74,7 @@ struct problem_t : gunrock::problem_t<graph_t> {
 
     thrust::fill_n(policy, plast.begin(), n_vertices, 0);
 
-    auto get_weight = [=] __device__(const int& i) -> weight_t {
+    auto get_weight = [=] __host__ __device__(const int& i) -> weight_t {
       weight_t val = 0;
 
       edge_t start = g.get_starting_edge(i);
@@ -101,8 +101,9 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
   using vertex_t = typename problem_t::vertex_t;
   using edge_t = typename problem_t::edge_t;
   using weight_t = typename problem_t::weight_t;
+  using frontier_type = typename gunrock::enactor_t<problem_t>::frontier_type;
 
-  void prepare_frontier(frontier_t<vertex_t>* f,
+  void prepare_frontier(frontier_type* f,
                         cuda::multi_context_t& context) override {
     auto P = this->get_problem();
     auto G = P->get_graph();
@@ -120,17 +121,17 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
     auto n_vertices = G.get_number_of_vertices();
     auto p = P->result.p;
-    auto plast = P->plast.data().get();
-    auto iweights = P->iweights.data().get();
+    auto plast = memory::raw_pointer_cast(P->plast.data());
+    auto iweights = memory::raw_pointer_cast(P->iweights.data());
     auto alpha = P->param.alpha;
 
-    auto policy = this->context->get_context(0)->execution_policy();
+    auto policy = P->get_execution_policy();
 
     thrust::copy_n(policy, p, n_vertices, plast);
 
     // >> handle "dangling nodes" (nodes w/ zero outdegree)
     // could skip this if no nodes have sero outdegree
-    auto compute_dangling = [=] __device__(const int& i) -> weight_t {
+    auto compute_dangling = [=] __host__ __device__(const int& i) -> weight_t {
       return iweights[i] == 0 ? alpha * p[i] : 0;
     };
 
@@ -172,13 +173,13 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
     auto n_vertices = G.get_number_of_vertices();
     auto p = P->result.p;
-    auto plast = P->plast.data().get();
+    auto plast = memory::raw_pointer_cast(P->plast.data());
 
-    auto abs_diff = [=] __device__(const int& i) -> weight_t {
+    auto abs_diff = [=] __host__ __device__(const int& i) -> weight_t {
       return abs(p[i] - plast[i]);
     };
 
-    auto policy = this->context->get_context(0)->execution_policy();
+    auto policy = P->get_execution_policy();
     float err = thrust::transform_reduce(
         policy, thrust::counting_iterator<vertex_t>(0),
         thrust::counting_iterator<vertex_t>(n_vertices), abs_diff,
@@ -193,8 +194,8 @@ template <typename graph_t>
 float run(graph_t& G,
           typename graph_t::weight_type alpha,
           typename graph_t::weight_type tol,
-          typename graph_t::weight_type* p  // Output
-) {
+          typename graph_t::weight_type* p,  // Output
+          enactor_properties_t properties = enactor_properties_t()) {
   // <user-defined>
   using vertex_t = typename graph_t::vertex_type;
   using weight_t = typename graph_t::weight_type;
@@ -208,7 +209,8 @@ float run(graph_t& G,
 
   // <boiler-plate>
   auto multi_context =
-      std::shared_ptr<cuda::multi_context_t>(new cuda::multi_context_t(0));
+      std::shared_ptr<cuda::multi_context_t>(new cuda::multi_context_t(
+          (G.memory_space() == memory_space_t::host) ? cuda::host_device : 0));
 
   using problem_type = problem_t<graph_t, param_type, result_type>;
   using enactor_type = enactor_t<problem_type>;
@@ -217,7 +219,7 @@ float run(graph_t& G,
   problem.init();
   problem.reset();
 
-  enactor_type enactor(&problem, multi_context);
+  enactor_type enactor(&problem, multi_context, properties);
   return enactor.enact();
   // </boiler-plate>
 }
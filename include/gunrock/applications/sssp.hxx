@@ -46,15 +46,15 @@ struct problem_t : gunrock::problem_t<graph_t> {
   using edge_t = typename graph_t::edge_type;
   using weight_t = typename graph_t::weight_type;
 
-  thrust::device_vector<vertex_t> visited;
+  vector_t<vertex_t, graph_t::memory_space()> visited;
 
   void init() override {
     auto g = this->get_graph();
     auto n_vertices = g.get_number_of_vertices();
     visited.resize(n_vertices);
 
-    // Execution policy for a given context (using single-gpu).
-    auto policy = this->context->get_context(0)->execution_policy();
+    // Execution policy for the graph's memory space (using single-gpu).
+    auto policy = this->get_execution_policy();
     thrust::fill(policy, visited.begin(), visited.end(), -1);
   }
 
@@ -62,19 +62,34 @@ struct problem_t : gunrock::problem_t<graph_t> {
     auto g = this->get_graph();
     auto n_vertices = g.get_number_of_vertices();
 
-    auto context = this->get_single_context();
-    auto policy = context->execution_policy();
+    auto policy = this->get_execution_policy();
 
-    auto d_distances = thrust::device_pointer_cast(this->result.distances);
-    thrust::fill(policy, d_distances + 0, d_distances + n_vertices,
+    auto distances = this->result.distances;
+    thrust::fill(policy, distances + 0, distances + n_vertices,
                  std::numeric_limits<weight_t>::max());
 
-    thrust::fill(policy, d_distances + this->param.single_source,
-                 d_distances + this->param.single_source + 1, 0);
+    thrust::fill(policy, distances + this->param.single_source,
+                 distances + this->param.single_source + 1, 0);
 
     thrust::fill(policy, visited.begin(), visited.end(),
                  -1);  // This does need to be reset in between runs though
   }
+
+  void reset_vertices(vertex_t const* vertices, std::size_t size) override {
+    auto policy = this->get_execution_policy();
+    auto distances = this->result.distances;
+    auto visited_data = memory::raw_pointer_cast(visited.data());
+    thrust::for_each(
+        policy, vertices, vertices + size,
+        [distances, visited_data] __host__ __device__(vertex_t const& v) {
+          if (gunrock::util::limits::is_valid(v)) {
+            distances[v] = std::numeric_limits<weight_t>::max();
+            visited_data[v] = -1;
+          }
+        });
+    thrust::fill(policy, distances + this->param.single_source,
+                 distances + this->param.single_source + 1, 0);
+  }
 };
 
 template <typename problem_t>
@@ -86,8 +101,9 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
   using vertex_t = typename problem_t::vertex_t;
   using edge_t = typename problem_t::edge_t;
   using weight_t = typename problem_t::weight_t;
+  using frontier_type = typename gunrock::enactor_t<problem_t>::frontier_type;
 
-  void prepare_frontier(frontier_t<vertex_t>* f,
+  void prepare_frontier(frontier_type* f,
                         cuda::multi_context_t& context) override {
     auto P = this->get_problem();
     f->push_back(P->param.single_source);
@@ -101,7 +117,7 @@ struct enactor_t : gunrock::enactor_t<problem_t> {
 
     auto single_source = P->param.single_source;
     auto distances = P->result.distances;
-    auto visited = P->visited.data().get();
+    auto visited = memory::raw_pointer_cast(P->visited.data());
 
     auto iteration = this->iteration;
 
@@ -147,8 +163,8 @@ template <typename graph_t>
 float run(graph_t& G,
           typename graph_t::vertex_type& single_source,  // Parameter
           typename graph_t::weight_type* distances,      // Output
-          typename graph_t::vertex_type* predecessors    // Output
-) {
+          typename graph_t::vertex_type* predecessors,   // Output
+          enactor_properties_t properties = enactor_properties_t()) {
   // <user-defined>
   using vertex_t = typename graph_t::vertex_type;
   using weight_t = typename graph_t::weight_type;
@@ -162,7 +178,8 @@ float run(graph_t& G,
 
   // <boiler-plate>
   auto multi_context =
-      std::shared_ptr<cuda::multi_context_t>(new cuda::multi_context_t(0));
+      std::shared_ptr<cuda::multi_context_t>(new cuda::multi_context_t(
+          (G.memory_space() == memory_space_t::host) ? cuda::host_device : 0));
 
   using problem_type = problem_t<graph_t, param_type, result_type>;
   using enactor_type = enactor_t<problem_type>;
@@ -171,10 +188,45 @@ float run(graph_t& G,
   problem.init();
   problem.reset();
 
-  enactor_type enactor(&problem, multi_context);
+  enactor_type enactor(&problem, multi_context, properties);
   return enactor.enact();
   // </boiler-plate>
 }
 
+/**
+ * @brief Session answering many SSSP queries on one graph, see
+ * `gunrock::session_t` and `make_session()`.
+ */
+template <typename graph_t,
+          typename vertex_t = typename graph_t::vertex_type,
+          typename weight_t = typename graph_t::weight_type,
+          typename problem_type = problem_t<graph_t,
+                                            param_t<vertex_t>,
+                                            result_t<vertex_t, weight_t>>>
+using session_t = gunrock::session_t<problem_type, enactor_t<problem_type>>;
+
+/**
+ * @brief Bind a query session to `G`, for many single-source queries in a
+ * row: `session.query(source)` writes `distances` like `run()`, but reuses
+ * the problem, the enactor and their buffers, and only resets the vertices
+ * visited by the previous query.
+ *
+ * @param G graph, must outlive the session.
+ * @param distances output, written by every query.
+ * @param predecessors output, written by every query.
+ * @return session_t<graph_t>
+ */
+template <typename graph_t>
+session_t<graph_t> make_session(
+    graph_t& G,
+    typename graph_t::weight_type* distances,
+    typename graph_t::vertex_type* predecessors) {
+  using vertex_t = typename graph_t::vertex_type;
+  using weight_t = typename graph_t::weight_type;
+  return session_t<graph_t>(
+      G, param_t<vertex_t>(0),  // set per query.
+      result_t<vertex_t, weight_t>(distances, predecessors));
+}
+
 }  // namespace sssp
 }  // namespace gunrock
\ No newline at end of file
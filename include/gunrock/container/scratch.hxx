@@ -0,0 +1,57 @@
+/**
+ * @file scratch.hxx
+ * @brief Reusable per-thread scratch space for the host algorithms and
+ * operators.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace gunrock {
+
+/**
+ * @brief Number of times the host scratch spaces grew (see `get_scratch()`),
+ * over all threads. `session_t` reads it to confirm that warm queries do not
+ * allocate.
+ */
+inline std::atomic<std::size_t>& get_scratch_allocations() {
+  static std::atomic<std::size_t> allocations{0};
+  return allocations;
+}
+
+/**
+ * @brief Host scratch space of the calling thread, at least `size` items.
+ *
+ * @par Overview
+ * The storage is kept across calls and only ever grows, so host code that
+ * runs once per iteration (or per query) stops allocating once it has seen
+ * its largest input. Items are not initialized, and keep whatever the last
+ * user left in them.
+ *
+ * @tparam type_t item type (default constructible).
+ * @tparam tag_t distinguishes scratch spaces of the same type that are in use
+ * at the same time; a type local to the calling function gives every call
+ * site its own space.
+ * @param size number of items needed.
+ * @return type_t* scratch space, valid until the next call with the same
+ * `type_t` and `tag_t` on this thread.
+ */
+template <typename type_t, typename tag_t = void>
+type_t* get_scratch(std::size_t size) {
+  thread_local std::vector<type_t> scratch;
+  if (scratch.size() < size) {
+    scratch.resize(size);
+    get_scratch_allocations()++;
+  }
+  return scratch.data();
+}
+
+}  // namespace gunrock
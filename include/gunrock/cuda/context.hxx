@@ -25,6 +25,13 @@ namespace cuda {
 template <int dummy_arg>
 __global__ void dummy_k() {}
 
+/**
+ * @brief Device id of a host-only context, used to run the operators on host
+ * graphs (`memory_space_t::host`) without a GPU. Such a context has no stream,
+ * event or moderngpu context.
+ */
+constexpr cuda::device_id_t host_device = -1;
+
 struct context_t {
   context_t() = default;
 
@@ -82,11 +89,21 @@ class standard_context_t : public context_t {
 
  public:
   standard_context_t(cuda::device_id_t device = 0)
-      : context_t(), _ordinal(device), _mgpu_context(nullptr) {
-    init();
+      : context_t(),
+        _ordinal(device),
+        _stream(0),
+        _event(0),
+        _mgpu_context(nullptr) {
+    if (!is_host())
+      init();
+  }
+
+  ~standard_context_t() {
+    if (!is_host())
+      cudaEventDestroy(_event);
   }
 
-  ~standard_context_t() { cudaEventDestroy(_event); }
+  bool is_host() const { return _ordinal == host_device; }
 
   virtual const cuda::device_properties_t& props() const override {
     return _props;
@@ -105,6 +122,8 @@ class standard_context_t : public context_t {
   virtual mgpu::standard_context_t* mgpu() override { return _mgpu_context; }
 
   virtual void synchronize() override {
+    if (is_host())
+      return;
     error::error_t status =
         _stream ? cudaStreamSynchronize(_stream) : cudaDeviceSynchronize();
     error::throw_if_exception(status);
@@ -135,7 +154,7 @@ class multi_context_t {
     }
   }
 
-  // Single device.
+  // Single device (or host only, `_device == host_device`).
   multi_context_t(cuda::device_id_t _device) : devices(1, _device) {
     for (auto& device : devices) {
       standard_context_t* device_context = new standard_context_t(device);
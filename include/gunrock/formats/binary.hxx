@@ -0,0 +1,518 @@
+/**
+ * @file binary.hxx
+ * @brief Versioned, self-describing binary container for CSR matrices
+ * (`.csr` files). Sections are aligned so that the file can be memory-mapped
+ * and used in place (zero-copy) on the host.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/io/mapped_file.hxx>
+
+namespace gunrock {
+namespace format {
+namespace binary {
+
+/**
+ * @brief Binary CSR file layout (version 1). All integers are stored in the
+ * byte order of the writer, recorded in the header.
+ *
+ * +--------------------------------------------+
+ * | header_t (128 bytes)                       |
+ * +--------------------------------------------+ <-- aligned
+ * | row_offsets    (rows + 1) * sizeof(offset) |
+ * +--------------------------------------------+ <-- aligned
+ * | column_indices nnz * sizeof(index)         |
+ * +--------------------------------------------+ <-- aligned
+ * | nonzero_values nnz * sizeof(value)         | (optional)
+ * +--------------------------------------------+
+ *
+ * Every section carries its own checksum, and the header carries a checksum
+ * of itself. Files written before this container existed (raw header of
+ * rows, columns, nonzeros followed by the three arrays) are still readable by
+ * `csr_t::read_binary`.
+ */
+constexpr char magic[8] = {'G', 'R', 'K', 'C', 'S', 'R', '\0', '\0'};
+constexpr std::uint32_t version = 1;
+constexpr std::uint32_t default_alignment = 4096;
+
+enum section_id_t { row_offsets = 0, column_indices = 1, nonzero_values = 2 };
+constexpr std::size_t number_of_sections = 3;
+
+enum flags_t : std::uint32_t { has_values = 1 << 0 };
+
+enum type_tag_t : std::uint8_t {
+  unknown = 0,
+  int32 = 1,
+  uint32 = 2,
+  int64 = 3,
+  uint64 = 4,
+  float32 = 5,
+  float64 = 6
+};
+
+template <typename type_t>
+constexpr type_tag_t type_tag() {
+  if constexpr (std::is_floating_point_v<type_t>)
+    return (sizeof(type_t) == 4) ? float32
+           : (sizeof(type_t) == 8) ? float64
+                                   : unknown;
+  else if constexpr (std::is_integral_v<type_t> && std::is_signed_v<type_t>)
+    return (sizeof(type_t) == 4) ? int32 : (sizeof(type_t) == 8) ? int64
+                                                                 : unknown;
+  else if constexpr (std::is_integral_v<type_t>)
+    return (sizeof(type_t) == 4) ? uint32 : (sizeof(type_t) == 8) ? uint64
+                                                                  : unknown;
+  else
+    return unknown;
+}
+
+inline const char* type_name(std::uint8_t tag) {
+  switch (tag) {
+    case int32:
+      return "int32";
+    case uint32:
+      return "uint32";
+    case int64:
+      return "int64";
+    case uint64:
+      return "uint64";
+    case float32:
+      return "float32";
+    case float64:
+      return "float64";
+    default:
+      return "unknown";
+  }
+}
+
+struct section_t {
+  std::uint64_t offset;    // from the beginning of the file, in bytes.
+  std::uint64_t bytes;     // size of the section, in bytes.
+  std::uint64_t checksum;  // see `checksum()`.
+};
+
+struct header_t {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t flags;
+  std::uint8_t index_type;
+  std::uint8_t offset_type;
+  std::uint8_t value_type;
+  std::uint8_t little_endian;
+  std::uint32_t alignment;
+  std::uint64_t number_of_rows;
+  std::uint64_t number_of_columns;
+  std::uint64_t number_of_nonzeros;
+  section_t sections[number_of_sections];
+  std::uint64_t header_checksum;  // checksum of all the bytes above.
+};
+
+static_assert(sizeof(header_t) == 128, "Binary CSR header must be 128 bytes.");
+
+inline bool is_little_endian() {
+  const std::uint16_t probe = 1;
+  return *reinterpret_cast<const std::uint8_t*>(&probe) == 1;
+}
+
+/**
+ * @brief 64-bit checksum of a byte range. The range is cut into fixed-size
+ * blocks that are hashed independently (in parallel) and combined with a sum,
+ * so the result does not depend on the number of threads.
+ *
+ * @param data pointer to the first byte.
+ * @param bytes number of bytes.
+ * @return std::uint64_t checksum.
+ */
+inline std::uint64_t checksum(const void* data, std::size_t bytes) {
+  constexpr std::size_t block_size = 1 << 20;  // 1 MiB
+  constexpr std::uint64_t prime = 0x9E3779B97F4A7C15ull;
+
+  auto mix = [](std::uint64_t x) {
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDull;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ull;
+    x ^= x >> 33;
+    return x;
+  };
+
+  const unsigned char* base = static_cast<const unsigned char*>(data);
+  std::int64_t number_of_blocks = (bytes + block_size - 1) / block_size;
+  std::uint64_t sum = mix(bytes);
+
+#pragma omp parallel for reduction(+ : sum) schedule(static)
+  for (std::int64_t b = 0; b < number_of_blocks; ++b) {
+    const unsigned char* p = base + b * block_size;
+    std::size_t length = std::min(block_size, bytes - b * block_size);
+    std::uint64_t h = mix((std::uint64_t)b + prime);
+
+    std::size_t words = length / sizeof(std::uint64_t);
+    for (std::size_t w = 0; w < words; ++w) {
+      std::uint64_t word;
+      std::memcpy(&word, p + w * sizeof(std::uint64_t), sizeof(word));
+      h = (h ^ mix(word)) * prime;
+    }
+
+    std::uint64_t tail = 0;
+    std::memcpy(&tail, p + words * sizeof(std::uint64_t),
+                length - words * sizeof(std::uint64_t));
+    h = (h ^ mix(tail)) * prime;
+
+    sum += mix(h);
+  }
+
+  return sum;
+}
+
+inline std::uint64_t checksum(header_t const& header) {
+  return checksum(&header, offsetof(header_t, header_checksum));
+}
+
+inline std::uint64_t align_up(std::uint64_t value, std::uint64_t alignment) {
+  return ((value + alignment - 1) / alignment) * alignment;
+}
+
+/**
+ * @brief Host view of a binary CSR file, mapped in memory. The pointers point
+ * straight into the (read-only) mapping and stay valid as long as this object
+ * (or a copy of it) is alive; they can be handed to
+ * `graph::build::from_csr<memory_space_t::host, ...>` without any copy.
+ *
+ * Values are optional: for pattern-only files `nonzero_values` is null and
+ * `get_value()` reads 1 for every nonzero. A graph view over such a file
+ * needs values supplied by the caller (e.g. a vector of ones).
+ *
+ * @note The mapping is read-only, writing through these pointers faults.
+ */
+template <typename index_t, typename offset_t, typename value_t>
+struct mapped_csr_t {
+  index_t number_of_rows;
+  index_t number_of_columns;
+  offset_t number_of_nonzeros;
+
+  offset_t* row_offsets;    // Ap
+  index_t* column_indices;  // Aj
+  value_t* nonzero_values;  // Ax, null if the file has no values section.
+
+  std::shared_ptr<io::mapped_file_t> file;
+
+  mapped_csr_t()
+      : number_of_rows(0),
+        number_of_columns(0),
+        number_of_nonzeros(0),
+        row_offsets(nullptr),
+        column_indices(nullptr),
+        nonzero_values(nullptr) {}
+
+  bool has_values() const { return nonzero_values != nullptr; }
+
+  /**
+   * @brief Value of the nonzero `e`, 1 for pattern-only files.
+   */
+  value_t get_value(offset_t const& e) const {
+    return nonzero_values ? nonzero_values[e] : value_t(1);
+  }
+};
+
+namespace detail {
+
+inline void write_or_exit(const void* data,
+                          std::size_t bytes,
+                          std::FILE* file,
+                          std::string const& filename) {
+  if (bytes && std::fwrite(data, 1, bytes, file) != bytes) {
+    std::cerr << "Could not write to file: " << filename << std::endl;
+    exit(1);
+  }
+}
+
+inline void pad_or_exit(std::uint64_t position,
+                        std::uint64_t alignment,
+                        std::FILE* file,
+                        std::string const& filename) {
+  static const char zeros[default_alignment] = {0};
+  std::uint64_t padding = align_up(position, alignment) - position;
+  while (padding) {
+    std::uint64_t chunk = std::min<std::uint64_t>(padding, sizeof(zeros));
+    write_or_exit(zeros, chunk, file, filename);
+    padding -= chunk;
+  }
+}
+
+/**
+ * @brief Validate the header of a binary CSR file of `file_size` bytes
+ * against the requested types.
+ */
+template <typename index_t, typename offset_t, typename value_t>
+void validate_header(header_t const& header,
+                     std::uint64_t file_size,
+                     std::string const& filename) {
+  if (std::memcmp(header.magic, magic, sizeof(magic)) != 0) {
+    std::cerr << "Not a binary CSR file (bad magic): " << filename << std::endl;
+    exit(1);
+  }
+
+  if (header.version != version) {
+    std::cerr << "Unsupported binary CSR version " << header.version
+              << " (expected " << version << "): " << filename << std::endl;
+    exit(1);
+  }
+
+  if (header.header_checksum != checksum(header)) {
+    std::cerr << "Corrupted binary CSR header: " << filename << std::endl;
+    exit(1);
+  }
+
+  if ((bool)header.little_endian != is_little_endian()) {
+    std::cerr << "Binary CSR file was written with a different byte order: "
+              << filename << std::endl;
+    exit(1);
+  }
+
+  if (header.index_type != type_tag<index_t>() ||
+      header.offset_type != type_tag<offset_t>() ||
+      ((header.flags & has_values) &&
+       header.value_type != type_tag<value_t>())) {
+    std::cerr << "Binary CSR types (index = " << type_name(header.index_type)
+              << ", offset = " << type_name(header.offset_type)
+              << ", value = " << type_name(header.value_type)
+              << ") do not match the requested types (index = "
+              << type_name(type_tag<index_t>())
+              << ", offset = " << type_name(type_tag<offset_t>())
+              << ", value = " << type_name(type_tag<value_t>())
+              << "): " << filename << std::endl;
+    exit(1);
+  }
+
+  constexpr auto largest_index =
+      (std::uint64_t)std::numeric_limits<index_t>::max();
+  constexpr auto largest_offset =
+      (std::uint64_t)std::numeric_limits<offset_t>::max();
+  if (header.number_of_rows > largest_index ||
+      header.number_of_columns > largest_index ||
+      header.number_of_nonzeros > largest_offset) {
+    std::cerr << "Binary CSR dimensions do not fit the requested types: "
+              << filename << std::endl;
+    exit(1);
+  }
+
+  // The sections are used in place (see `open_mapped()`): their offsets
+  // must be aligned for their types.
+  constexpr std::uint64_t minimum_alignment =
+      std::max({alignof(offset_t), alignof(index_t), alignof(value_t)});
+  if (header.alignment < minimum_alignment ||
+      (header.alignment & (header.alignment - 1)) != 0) {
+    std::cerr << "Invalid binary CSR alignment " << header.alignment
+              << " (must be a power of two, at least " << minimum_alignment
+              << "): " << filename << std::endl;
+    exit(1);
+  }
+
+  // Every entry takes at least a byte of the file, which also keeps the
+  // section sizes below from overflowing.
+  if (header.number_of_rows >= file_size ||
+      header.number_of_nonzeros > file_size) {
+    std::cerr << "Corrupted or truncated binary CSR file (dimensions): "
+              << filename << std::endl;
+    exit(1);
+  }
+
+  std::uint64_t expected[number_of_sections] = {
+      (header.number_of_rows + 1) * sizeof(offset_t),
+      header.number_of_nonzeros * sizeof(index_t),
+      (header.flags & has_values) ? header.number_of_nonzeros * sizeof(value_t)
+                                  : 0};
+
+  for (std::size_t s = 0; s < number_of_sections; ++s) {
+    auto const& section = header.sections[s];
+    if (section.bytes != expected[s] || section.offset > file_size ||
+        section.bytes > file_size - section.offset ||
+        (section.bytes && section.offset % header.alignment != 0)) {
+      std::cerr << "Corrupted or truncated binary CSR file (section " << s
+                << "): " << filename << std::endl;
+      exit(1);
+    }
+  }
+}
+
+/**
+ * @brief Validate the header of a mapped binary CSR file against the
+ * requested types.
+ */
+template <typename index_t, typename offset_t, typename value_t>
+header_t read_header(io::mapped_file_t const& file,
+                     std::string const& filename) {
+  header_t header;
+  if (file.size() < sizeof(header_t)) {
+    std::cerr << "Not a binary CSR file (too small): " << filename << std::endl;
+    exit(1);
+  }
+  std::memcpy(&header, file.data(), sizeof(header_t));
+  validate_header<index_t, offset_t, value_t>(header, file.size(), filename);
+  return header;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Write a CSR matrix (host pointers) as a binary CSR file.
+ *
+ * @param filename output file (conventionally `.csr`).
+ * @param number_of_rows number of rows.
+ * @param number_of_columns number of columns.
+ * @param number_of_nonzeros number of nonzeros.
+ * @param Ap row offsets (number_of_rows + 1).
+ * @param Aj column indices (number_of_nonzeros).
+ * @param Ax nonzero values (number_of_nonzeros), `nullptr` to omit the values
+ * section (pattern-only graphs).
+ */
+template <typename index_t, typename offset_t, typename value_t>
+void write(std::string const& filename,
+           index_t const& number_of_rows,
+           index_t const& number_of_columns,
+           offset_t const& number_of_nonzeros,
+           offset_t const* Ap,
+           index_t const* Aj,
+           value_t const* Ax) {
+  header_t header;
+  std::memset(&header, 0, sizeof(header_t));
+  std::memcpy(header.magic, magic, sizeof(magic));
+  header.version = version;
+  header.flags = Ax ? has_values : 0;
+  header.index_type = type_tag<index_t>();
+  header.offset_type = type_tag<offset_t>();
+  header.value_type = type_tag<value_t>();
+  header.little_endian = is_little_endian();
+  header.alignment = default_alignment;
+  header.number_of_rows = number_of_rows;
+  header.number_of_columns = number_of_columns;
+  header.number_of_nonzeros = number_of_nonzeros;
+
+  const void* data[number_of_sections] = {Ap, Aj, Ax};
+  std::uint64_t bytes[number_of_sections] = {
+      ((std::uint64_t)number_of_rows + 1) * sizeof(offset_t),
+      (std::uint64_t)number_of_nonzeros * sizeof(index_t),
+      Ax ? (std::uint64_t)number_of_nonzeros * sizeof(value_t) : 0};
+
+  std::uint64_t position = sizeof(header_t);
+  for (std::size_t s = 0; s < number_of_sections; ++s) {
+    position = align_up(position, header.alignment);
+    header.sections[s].offset = bytes[s] ? position : 0;
+    header.sections[s].bytes = bytes[s];
+    header.sections[s].checksum = checksum(data[s], bytes[s]);
+    position += bytes[s];
+  }
+  header.header_checksum = checksum(header);
+
+  std::FILE* file = std::fopen(filename.c_str(), "wb");
+  if (!file) {
+    std::cerr << "File could not be opened: " << filename << std::endl;
+    exit(1);
+  }
+
+  detail::write_or_exit(&header, sizeof(header_t), file, filename);
+  position = sizeof(header_t);
+  for (std::size_t s = 0; s < number_of_sections; ++s) {
+    if (!bytes[s])
+      continue;
+    detail::pad_or_exit(position, header.alignment, file, filename);
+    position = header.sections[s].offset;
+    detail::write_or_exit(data[s], bytes[s], file, filename);
+    position += bytes[s];
+  }
+
+  if (std::fclose(file) != 0) {
+    std::cerr << "Could not close file: " << filename << std::endl;
+    exit(1);
+  }
+}
+
+/**
+ * @brief Is `filename` a (versioned) binary CSR file? Legacy files, which
+ * have no magic number, return false.
+ */
+inline bool is_versioned(std::string const& filename) {
+  char buffer[sizeof(magic)] = {0};
+  std::FILE* file = std::fopen(filename.c_str(), "rb");
+  if (!file)
+    return false;
+  bool matches = (std::fread(buffer, 1, sizeof(buffer), file) ==
+                  sizeof(buffer)) &&
+                 (std::memcmp(buffer, magic, sizeof(magic)) == 0);
+  std::fclose(file);
+  return matches;
+}
+
+/**
+ * @brief Memory-map a binary CSR file and return a zero-copy host view of it.
+ * Opening only reads and validates the 128-byte header, so it takes the same
+ * (short) time regardless of the size of the graph; pages are faulted in as
+ * the graph is traversed.
+ *
+ * @param filename binary CSR file.
+ * @param verify if true, also verify the checksum of every section (this
+ * touches the entire file).
+ */
+template <typename index_t, typename offset_t, typename value_t>
+mapped_csr_t<index_t, offset_t, value_t> open_mapped(
+    std::string const& filename,
+    bool verify = false) {
+  mapped_csr_t<index_t, offset_t, value_t> csr;
+  csr.file = std::make_shared<io::mapped_file_t>(filename);
+
+  auto header =
+      detail::read_header<index_t, offset_t, value_t>(*csr.file, filename);
+
+  const char* base = csr.file->data();
+  if (verify) {
+    for (std::size_t s = 0; s < number_of_sections; ++s) {
+      auto const& section = header.sections[s];
+      if (checksum(base + section.offset, section.bytes) != section.checksum) {
+        std::cerr << "Binary CSR checksum mismatch (section " << s
+                  << "): " << filename << std::endl;
+        exit(1);
+      }
+    }
+  }
+
+  csr.number_of_rows = (index_t)header.number_of_rows;
+  csr.number_of_columns = (index_t)header.number_of_columns;
+  csr.number_of_nonzeros = (offset_t)header.number_of_nonzeros;
+
+  // Sections are aligned and read-only; graph views only ever read them.
+  csr.row_offsets = reinterpret_cast<offset_t*>(
+      const_cast<char*>(base + header.sections[row_offsets].offset));
+  csr.column_indices = reinterpret_cast<index_t*>(
+      const_cast<char*>(base + header.sections[column_indices].offset));
+
+  // Pattern-only files have no values (see `mapped_csr_t::get_value()`).
+  if (header.flags & has_values)
+    csr.nonzero_values = reinterpret_cast<value_t*>(
+        const_cast<char*>(base + header.sections[nonzero_values].offset));
+
+  return csr;
+}
+
+}  // namespace binary
+}  // namespace format
+}  // namespace gunrock
@@ -0,0 +1,391 @@
+/**
+ * @file compressed_csr.hxx
+ * @brief Compressed CSR format: delta-encoded (varint or bit-packed)
+ * adjacency lists with sampled offsets.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/memory.hxx>
+#include <gunrock/container/vector.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/formats/binary.hxx>
+#include <gunrock/formats/detail/compression.hxx>
+#include <gunrock/algorithms/scan/host.hxx>
+
+namespace gunrock {
+namespace format {
+
+using namespace memory;
+
+/**
+ * @brief Compressed Sparse Row format with compressed adjacency lists. Host
+ * only; see `graph::graph_compressed_csr_t` for the graph view.
+ *
+ * @par Overview
+ * Row `i` is encoded in `adjacency` as its degree, its size in bytes, and its
+ * sorted columns as gaps (see `compression_t`). Offsets are sampled every
+ * `2^sampling_shift` rows, both in edges (`edge_samples`, the row offsets of
+ * the sampled rows) and in bytes (`byte_samples`); locating a row skips at
+ * most `2^sampling_shift - 1` rows from its sample. Values are kept
+ * uncompressed in edge order (edge ids are the same as in the sorted CSR).
+ *
+ * @tparam index_t
+ * @tparam offset_t
+ * @tparam value_t
+ */
+template <memory_space_t space,
+          typename index_t,
+          typename offset_t,
+          typename value_t>
+struct compressed_csr_t {
+  static_assert(space == memory_space_t::host,
+                "Compressed CSR is only supported on the host.");
+
+  using byte_t = detail::compression::byte_t;
+
+  index_t number_of_rows;
+  index_t number_of_columns;
+  offset_t number_of_nonzeros;
+
+  compression_t compression;
+  int sampling_shift;  // log2 of the number of rows per sample.
+
+  vector_t<byte_t, space> adjacency;            // encoded rows.
+  vector_t<offset_t, space> edge_samples;       // Ap[s << sampling_shift]
+  vector_t<std::uint64_t, space> byte_samples;  // byte offset of the row.
+  vector_t<value_t, space> nonzero_values;      // Ax
+
+  compressed_csr_t()
+      : number_of_rows(0),
+        number_of_columns(0),
+        number_of_nonzeros(0),
+        compression(compression_t::varint),
+        sampling_shift(4) {}
+
+  ~compressed_csr_t() {}
+
+  /**
+   * @brief Size of the format in bytes (adjacency, samples and values).
+   */
+  std::size_t get_size_in_bytes(bool with_values = true) const {
+    return adjacency.size() * sizeof(byte_t) +
+           edge_samples.size() * sizeof(offset_t) +
+           byte_samples.size() * sizeof(std::uint64_t) +
+           (with_values ? nonzero_values.size() * sizeof(value_t) : 0);
+  }
+
+  /**
+   * @brief Compress a CSR. Rows are encoded in parallel: the encoded size of
+   * every row is computed, scanned into byte offsets, then every row is
+   * written at its offset. Unsorted rows are sorted (with their values).
+   *
+   * @param csr input CSR (host).
+   * @param _compression see `compression_t`.
+   * @param _sampling_shift offsets are sampled every `2^_sampling_shift`
+   * rows; higher saves memory, lower locates rows faster.
+   * @return compressed_csr_t&
+   */
+  compressed_csr_t& from_csr(
+      csr_t<memory_space_t::host, index_t, offset_t, value_t> const& csr,
+      compression_t _compression = compression_t::varint,
+      int _sampling_shift = 4) {
+    number_of_rows = csr.number_of_rows;
+    number_of_columns = csr.number_of_columns;
+    number_of_nonzeros = csr.number_of_nonzeros;
+    compression = _compression;
+    sampling_shift = _sampling_shift;
+
+    auto Ap = csr.row_offsets.data();
+    auto Aj = csr.column_indices.data();
+    auto Ax = csr.nonzero_values.data();
+    std::int64_t n = number_of_rows;
+
+    nonzero_values.resize(number_of_nonzeros);
+    auto values = nonzero_values.data();
+
+    // Sort a copy of the unsorted rows (with their values).
+    auto sorted_row = [&](std::int64_t i,
+                          std::vector<std::pair<index_t, value_t>>& row,
+                          std::vector<index_t>& columns) -> index_t const* {
+      if (std::is_sorted(Aj + Ap[i], Aj + Ap[i + 1]))
+        return Aj + Ap[i];
+      row.clear();
+      for (offset_t e = Ap[i]; e < Ap[i + 1]; ++e)
+        row.emplace_back(Aj[e], Ax[e]);
+      std::stable_sort(row.begin(), row.end(),
+                       [](auto const& a, auto const& b) {
+                         return a.first < b.first;
+                       });
+      columns.resize(row.size());
+      for (std::size_t k = 0; k < row.size(); ++k)
+        columns[k] = row[k].first;
+      return columns.data();
+    };
+
+    std::vector<std::uint64_t> sizes(n + 1, 0);
+#pragma omp parallel
+    {
+      std::vector<std::pair<index_t, value_t>> row;
+      std::vector<index_t> columns;
+#pragma omp for schedule(dynamic, 1024)
+      for (std::int64_t i = 0; i < n; ++i)
+        sizes[i] = detail::compression::row_size(
+            i, sorted_row(i, row, columns), Ap[i + 1] - Ap[i], compression);
+    }
+
+    std::uint64_t total = algo::scan::host::exclusive_scan(
+        sizes.data(), n, sizes.data(), std::uint64_t(0));
+    sizes[n] = total;
+
+    adjacency.assign(total + detail::compression::padding, byte_t(0));
+    auto out = adjacency.data();
+
+#pragma omp parallel
+    {
+      std::vector<std::pair<index_t, value_t>> row;
+      std::vector<index_t> columns;
+#pragma omp for schedule(dynamic, 1024)
+      for (std::int64_t i = 0; i < n; ++i) {
+        auto sorted = sorted_row(i, row, columns);
+        detail::compression::encode_row(i, sorted, Ap[i + 1] - Ap[i],
+                                        compression, out + sizes[i]);
+        if (sorted == Aj + Ap[i])
+          std::copy(Ax + Ap[i], Ax + Ap[i + 1], values + Ap[i]);
+        else
+          for (std::size_t k = 0; k < row.size(); ++k)
+            values[Ap[i] + k] = row[k].second;
+      }
+    }
+
+    std::int64_t number_of_samples = ((n - 1) >> sampling_shift) + 2;
+    edge_samples.resize(number_of_samples);
+    byte_samples.resize(number_of_samples);
+    for (std::int64_t s = 0; s < number_of_samples; ++s) {
+      std::int64_t i = std::min<std::int64_t>(s << sampling_shift, n);
+      edge_samples[s] = Ap[i];
+      byte_samples[s] = sizes[i];
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief Compress a COO sorted by row, then by column (e.g. the output of
+   * an external sort), one row at a time: the rows are appended to the
+   * encoded adjacency as they are read, so no CSR is built in between.
+   *
+   * @param coo input COO (host), sorted by (row, column).
+   * @param _compression see `compression_t`.
+   * @param _sampling_shift see `from_csr()`.
+   * @return compressed_csr_t&
+   */
+  template <typename nz_size_t>
+  compressed_csr_t& from_sorted_coo(
+      coo_t<memory_space_t::host, index_t, nz_size_t, value_t> const& coo,
+      compression_t _compression = compression_t::varint,
+      int _sampling_shift = 4) {
+    auto I = coo.row_indices.data();
+    auto J = coo.column_indices.data();
+    auto V = coo.nonzero_values.data();
+    std::size_t nnz = coo.number_of_nonzeros;
+
+    std::size_t k = 0;
+    encode_rows(coo.number_of_rows, coo.number_of_columns, (offset_t)nnz,
+                _compression, _sampling_shift,
+                [&](index_t i, index_t const*& columns,
+                    value_t const*& values) -> std::size_t {
+                  std::size_t begin = k;
+                  while (k < nnz && I[k] == i)
+                    ++k;
+                  if ((k < nnz && I[k] < i) ||
+                      !std::is_sorted(J + begin, J + k)) {
+                    std::cerr << "COO is not sorted by (row, column), at "
+                                 "nonzero "
+                              << k << std::endl;
+                    exit(1);
+                  }
+                  columns = J + begin;
+                  values = V + begin;
+                  return k - begin;
+                });
+
+    if (k != nnz) {
+      std::cerr << "COO row index out of range, at nonzero " << k
+                << std::endl;
+      exit(1);
+    }
+    return *this;
+  }
+
+  /**
+   * @brief Compress a binary CSR file (see `binary::write()`) one row at a
+   * time. The file is mapped and read front to back, so only the encoded
+   * adjacency and the values are ever held in memory; unsorted rows are
+   * sorted (with their values) as they are encoded.
+   *
+   * @param filename binary CSR file.
+   * @param _compression see `compression_t`.
+   * @param _sampling_shift see `from_csr()`.
+   * @return compressed_csr_t&
+   */
+  compressed_csr_t& from_binary(
+      std::string const& filename,
+      compression_t _compression = compression_t::varint,
+      int _sampling_shift = 4) {
+    auto csr = binary::open_mapped<index_t, offset_t, value_t>(filename);
+    csr.file->advise(io::access_pattern_t::sequential);
+    auto Ap = csr.row_offsets;
+    auto Aj = csr.column_indices;
+    auto Ax = csr.nonzero_values;
+
+    std::vector<std::pair<index_t, value_t>> row;
+    std::vector<index_t> sorted_columns;
+    std::vector<value_t> sorted_values;
+    encode_rows(csr.number_of_rows, csr.number_of_columns,
+                csr.number_of_nonzeros, _compression, _sampling_shift,
+                [&](index_t i, index_t const*& columns,
+                    value_t const*& values) -> std::size_t {
+                  std::size_t degree = Ap[i + 1] - Ap[i];
+                  columns = Aj + Ap[i];
+                  values = Ax ? Ax + Ap[i] : nullptr;  // null: all ones.
+                  if (std::is_sorted(columns, columns + degree))
+                    return degree;
+
+                  row.clear();
+                  for (std::size_t k = 0; k < degree; ++k)
+                    row.emplace_back(columns[k], csr.get_value(Ap[i] + k));
+                  std::stable_sort(row.begin(), row.end(),
+                                   [](auto const& a, auto const& b) {
+                                     return a.first < b.first;
+                                   });
+                  sorted_columns.resize(degree);
+                  sorted_values.resize(degree);
+                  for (std::size_t k = 0; k < degree; ++k) {
+                    sorted_columns[k] = row[k].first;
+                    sorted_values[k] = row[k].second;
+                  }
+                  columns = sorted_columns.data();
+                  values = sorted_values.data();
+                  return degree;
+                });
+    return *this;
+  }
+
+  /**
+   * @brief Decompress to a (sorted) CSR, in parallel over the samples.
+   *
+   * @param csr output CSR (host).
+   */
+  void to_csr(csr_t<memory_space_t::host, index_t, offset_t, value_t>& csr)
+      const {
+    csr = csr_t<memory_space_t::host, index_t, offset_t, value_t>(
+        number_of_rows, number_of_columns, number_of_nonzeros);
+    auto Ap = csr.row_offsets.data();
+    auto Aj = csr.column_indices.data();
+    auto in = adjacency.data();
+    std::int64_t n = number_of_rows;
+    std::int64_t number_of_samples = edge_samples.size() - 1;
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (std::int64_t s = 0; s < number_of_samples; ++s) {
+      auto p = in + byte_samples[s];
+      offset_t e = edge_samples[s];
+      std::int64_t end = std::min<std::int64_t>((s + 1) << sampling_shift, n);
+      for (std::int64_t i = s << sampling_shift; i < end; ++i) {
+        Ap[i] = e;
+        p = detail::compression::decode_row<index_t>(
+            p, i, compression, [&](index_t const& j, std::size_t) {
+              Aj[e++] = j;
+              return true;
+            });
+      }
+    }
+    Ap[n] = number_of_nonzeros;
+
+    std::copy(nonzero_values.begin(), nonzero_values.end(),
+              csr.nonzero_values.begin());
+  }
+
+ private:
+  /**
+   * @brief Encode the rows in order, appending them to `adjacency` and
+   * sampling the offsets as it goes (the serial counterpart of `from_csr()`).
+   *
+   * @param next_row `std::size_t(index_t i, index_t const*& columns,
+   * value_t const*& values)`, called for `i = 0, 1, ...`; points `columns`
+   * (sorted) and `values` (null for all ones) at row `i` and returns its
+   * degree.
+   */
+  template <typename row_operator_t>
+  void encode_rows(index_t rows,
+                   index_t columns,
+                   offset_t nonzeros,
+                   compression_t _compression,
+                   int _sampling_shift,
+                   row_operator_t next_row) {
+    number_of_rows = rows;
+    number_of_columns = columns;
+    number_of_nonzeros = nonzeros;
+    compression = _compression;
+    sampling_shift = _sampling_shift;
+
+    std::int64_t n = number_of_rows;
+    std::int64_t number_of_samples = ((n - 1) >> sampling_shift) + 2;
+    edge_samples.resize(number_of_samples);
+    byte_samples.resize(number_of_samples);
+    nonzero_values.resize(number_of_nonzeros);
+    adjacency.clear();
+
+    std::uint64_t size = 0;  // encoded bytes so far.
+    offset_t e = 0;
+    for (std::int64_t i = 0; i < n; ++i) {
+      index_t const* row_columns;
+      value_t const* row_values;
+      std::size_t degree = next_row((index_t)i, row_columns, row_values);
+      if (e + degree > (std::size_t)number_of_nonzeros) {
+        std::cerr << "More nonzeros than the " << number_of_nonzeros
+                  << " declared, at row " << i << std::endl;
+        exit(1);
+      }
+
+      if ((i & ((std::int64_t(1) << sampling_shift) - 1)) == 0) {
+        edge_samples[i >> sampling_shift] = e;
+        byte_samples[i >> sampling_shift] = size;
+      }
+
+      std::size_t bytes = detail::compression::row_size(i, row_columns, degree,
+                                                        compression);
+      adjacency.resize(size + bytes, byte_t(0));  // zeroed for bit-packing.
+      detail::compression::encode_row(i, row_columns, degree, compression,
+                                      adjacency.data() + size);
+      if (row_values)
+        std::copy(row_values, row_values + degree, nonzero_values.data() + e);
+      else
+        std::fill_n(nonzero_values.data() + e, degree, value_t(1));
+      size += bytes;
+      e += degree;
+    }
+
+    edge_samples[number_of_samples - 1] = e;
+    byte_samples[number_of_samples - 1] = size;
+    adjacency.resize(size + detail::compression::padding, byte_t(0));
+  }
+};  // struct compressed_csr_t
+
+}  // namespace format
+}  // namespace gunrock
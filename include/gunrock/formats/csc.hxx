@@ -2,6 +2,8 @@
 
 #include <gunrock/container/vector.hxx>
 #include <gunrock/memory.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/formats/detail/from_coo.hxx>
 
 namespace gunrock {
 namespace format {
@@ -22,7 +24,7 @@ template <memory_space_t space,
 struct csc_t {
   index_t number_of_rows;
   index_t number_of_columns;
-  index_t number_of_nonzeros;
+  offset_t number_of_nonzeros;
 
   vector_t<offset_t, space> column_offsets;  // Aj
   vector_t<index_t, space> row_indices;      // Ap
@@ -36,7 +38,7 @@ struct csc_t {
         row_indices(),
         nonzero_values() {}
 
-  csc_t(index_t r, index_t c, index_t nnz)
+  csc_t(index_t r, index_t c, offset_t nnz)
       : number_of_rows(r),
         number_of_columns(c),
         number_of_nonzeros(nnz),
@@ -46,7 +48,56 @@ struct csc_t {
 
   ~csc_t() {}
 
+  /**
+   * @brief Convert a Coordinate Sparse Format into Compressed Sparse Column
+   * Format. See `csr_t::from_coo`, and `format::from_coo` to build both the
+   * CSR and CSC formats in the same pass.
+   *
+   * @tparam reduce_op_t reducer for duplicate entries (see `format::reduce`).
+   * @param coo coordinate list.
+   * @param properties sort columns by row and/or merge duplicate entries.
+   * @param op reducer for the values of duplicate entries.
+   * @return csc_t<space, index_t, offset_t, value_t>&
+   */
+  template <typename reduce_op_t = reduce::first_t>
+  csc_t<space, index_t, offset_t, value_t>& from_coo(
+      const coo_t<memory_space_t::host, index_t, offset_t, value_t>& coo,
+      build_properties_t properties = build_properties_t(),
+      reduce_op_t op = reduce_op_t()) {
+    number_of_rows = coo.number_of_rows;
+    number_of_columns = coo.number_of_columns;
+
+    // A CSC is the CSR of the transpose.
+    if constexpr (space == memory_space_t::device) {
+      vector_t<offset_t, memory_space_t::host> _Aj;
+      vector_t<index_t, memory_space_t::host> _Ai;
+      vector_t<value_t, memory_space_t::host> _Ax;
+
+      number_of_nonzeros = detail::from_coo(
+          coo.number_of_columns, coo.number_of_rows, coo.number_of_nonzeros,
+          coo.column_indices.data(), coo.row_indices.data(),
+          coo.nonzero_values.data(), _Aj, _Ai, _Ax,
+          (vector_t<offset_t, memory_space_t::host>*)nullptr,
+          (vector_t<index_t, memory_space_t::host>*)nullptr,
+          (vector_t<value_t, memory_space_t::host>*)nullptr, properties, op);
+
+      column_offsets = _Aj;
+      row_indices = _Ai;
+      nonzero_values = _Ax;
+    } else {
+      number_of_nonzeros = detail::from_coo(
+          coo.number_of_columns, coo.number_of_rows, coo.number_of_nonzeros,
+          coo.column_indices.data(), coo.row_indices.data(),
+          coo.nonzero_values.data(), column_offsets, row_indices,
+          nonzero_values, (vector_t<offset_t, memory_space_t::host>*)nullptr,
+          (vector_t<index_t, memory_space_t::host>*)nullptr,
+          (vector_t<value_t, memory_space_t::host>*)nullptr, properties, op);
+    }
+
+    return *this;
+  }
+
 };  // struct csc_t
 
 }  // namespace format
-}  // namespace gunrock
\ No newline at end of file
+}  // namespace gunrock
@@ -3,6 +3,8 @@
 #include <gunrock/memory.hxx>
 #include <gunrock/container/vector.hxx>
 #include <gunrock/formats/formats.hxx>
+#include <gunrock/formats/binary.hxx>
+#include <gunrock/formats/detail/from_coo.hxx>
 
 #include <thrust/transform.h>
 
@@ -51,166 +53,179 @@ struct csr_t {
 
   /**
    * @brief Convert a Coordinate Sparse Format into Compressed Sparse Row
-   * Format.
+   * Format. Built in parallel on the host (see `detail::from_coo`), then moved
+   * to the device if needed.
    *
-   * @tparam index_t
-   * @tparam offset_t
-   * @tparam value_t
-   * @param coo
+   * @tparam reduce_op_t reducer for duplicate entries (see `format::reduce`).
+   * @param coo coordinate list.
+   * @param properties sort rows by column and/or merge duplicate entries; by
+   * default the input order is kept within rows, as are duplicates.
+   * @param op reducer for the values of duplicate entries.
    * @return csr_t<space, index_t, offset_t, value_t>&
    */
-  csr_t<space, index_t, offset_t, value_t> from_coo(
-      const coo_t<memory_space_t::host, index_t, offset_t, value_t>& coo) {
+  template <typename reduce_op_t = reduce::first_t>
+  csr_t<space, index_t, offset_t, value_t>& from_coo(
+      const coo_t<memory_space_t::host, index_t, offset_t, value_t>& coo,
+      build_properties_t properties = build_properties_t(),
+      reduce_op_t op = reduce_op_t()) {
     number_of_rows = coo.number_of_rows;
     number_of_columns = coo.number_of_columns;
-    number_of_nonzeros = coo.number_of_nonzeros;
 
-    // Allocate space for vectors
-    vector_t<offset_t, memory_space_t::host> _Ap;
-    vector_t<index_t, memory_space_t::host> _Aj;
-    vector_t<value_t, memory_space_t::host> _Ax;
+    if constexpr (space == memory_space_t::device) {
+      // If returning csr_t on device, build on host and move to device.
+      vector_t<offset_t, memory_space_t::host> _Ap;
+      vector_t<index_t, memory_space_t::host> _Aj;
+      vector_t<value_t, memory_space_t::host> _Ax;
 
-    offset_t* Ap;
-    index_t* Aj;
-    value_t* Ax;
+      number_of_nonzeros = detail::from_coo(
+          coo.number_of_rows, coo.number_of_columns, coo.number_of_nonzeros,
+          coo.row_indices.data(), coo.column_indices.data(),
+          coo.nonzero_values.data(), _Ap, _Aj, _Ax,
+          (vector_t<offset_t, memory_space_t::host>*)nullptr,
+          (vector_t<index_t, memory_space_t::host>*)nullptr,
+          (vector_t<value_t, memory_space_t::host>*)nullptr, properties, op);
 
-    if (space == memory_space_t::device) {
-      assert(space == memory_space_t::device);
-      // If returning csr_t on device, allocate temporary host vectors, build on
-      // host and move to device.
-      _Ap.resize(number_of_rows + 1);
-      _Aj.resize(number_of_nonzeros);
-      _Ax.resize(number_of_nonzeros);
-
-      Ap = _Ap.data();
-      Aj = _Aj.data();
-      Ax = _Ax.data();
-
-    } else {
-      assert(space == memory_space_t::host);
-      // If returning csr_t on host, use it's internal memory to build from COO.
-      row_offsets.resize(number_of_rows + 1);
-      column_indices.resize(number_of_nonzeros);
-      nonzero_values.resize(number_of_nonzeros);
-
-      Ap = raw_pointer_cast(row_offsets.data());
-      Aj = raw_pointer_cast(column_indices.data());
-      Ax = raw_pointer_cast(nonzero_values.data());
-    }
-
-    // compute number of non-zero entries per row of A.
-    for (offset_t n = 0; n < number_of_nonzeros; ++n) {
-      ++Ap[coo.row_indices[n]];
-    }
-
-    // cumulative sum the nnz per row to get row_offsets[].
-    for (index_t i = 0, sum = 0; i < number_of_rows; ++i) {
-      index_t temp = Ap[i];
-      Ap[i] = sum;
-      sum += temp;
-    }
-    Ap[number_of_rows] = number_of_nonzeros;
-
-    // write coordinate column indices and nonzero values into CSR's
-    // column indices and nonzero values.
-    for (offset_t n = 0; n < number_of_nonzeros; ++n) {
-      index_t row = coo.row_indices[n];
-      index_t dest = Ap[row];
-
-      Aj[dest] = coo.column_indices[n];
-      Ax[dest] = coo.nonzero_values[n];
-
-      ++Ap[row];
-    }
-
-    for (index_t i = 0, last = 0; i <= number_of_rows; ++i) {
-      index_t temp = Ap[i];
-      Ap[i] = last;
-      last = temp;
-    }
-
-    // If returning a device csr_t, move coverted data to device.
-    if (space == memory_space_t::device) {
       row_offsets = _Ap;
       column_indices = _Aj;
       nonzero_values = _Ax;
+    } else {
+      // If returning csr_t on host, use it's internal memory to build from COO.
+      number_of_nonzeros = detail::from_coo(
+          coo.number_of_rows, coo.number_of_columns, coo.number_of_nonzeros,
+          coo.row_indices.data(), coo.column_indices.data(),
+          coo.nonzero_values.data(), row_offsets, column_indices,
+          nonzero_values, (vector_t<offset_t, memory_space_t::host>*)nullptr,
+          (vector_t<index_t, memory_space_t::host>*)nullptr,
+          (vector_t<value_t, memory_space_t::host>*)nullptr, properties, op);
     }
 
-    // XXX: Clean-up?
-    Ap = nullptr;
-    Ax = nullptr;
-    Aj = nullptr;
-
-    return *this;  // CSR representation (with possible duplicates)
+    return *this;
   }
 
+  /**
+   * @brief Read a binary CSR file (see `format::binary`). Versioned files are
+   * validated (types, sizes and checksums) before use, legacy files (raw
+   * header followed by the arrays) are still accepted.
+   *
+   * @param filename binary CSR file.
+   */
   void read_binary(std::string filename) {
-    FILE* file = fopen(filename.c_str(), "rb");
-
-    // Read metadata
-    fread(&number_of_rows,     sizeof(index_t),  1, file);
-    fread(&number_of_columns,  sizeof(index_t),  1, file);
-    fread(&number_of_nonzeros, sizeof(offset_t), 1, file);
+    if (!binary::is_versioned(filename)) {
+      read_legacy_binary(filename);
+      return;
+    }
 
-    row_offsets.resize(number_of_rows + 1);
-    column_indices.resize(number_of_nonzeros);
-    nonzero_values.resize(number_of_nonzeros);
+    auto mapped = binary::open_mapped<index_t, offset_t, value_t>(
+        filename, true /* verify */);
+
+    number_of_rows = mapped.number_of_rows;
+    number_of_columns = mapped.number_of_columns;
+    number_of_nonzeros = mapped.number_of_nonzeros;
+
+    // Copies straight from the mapping (host to host, or host to device).
+    row_offsets.assign(mapped.row_offsets,
+                       mapped.row_offsets + number_of_rows + 1);
+    column_indices.assign(mapped.column_indices,
+                          mapped.column_indices + number_of_nonzeros);
+    if (mapped.has_values())
+      nonzero_values.assign(mapped.nonzero_values,
+                            mapped.nonzero_values + number_of_nonzeros);
+    else
+      nonzero_values.assign(number_of_nonzeros, value_t(1));
+  }
 
-    if(space == memory_space_t::device) {
+  /**
+   * @brief Write the matrix as a versioned binary CSR file.
+   *
+   * @param filename output file.
+   * @param with_values if false, the values section is omitted (pattern-only
+   * graph, values read back as 1).
+   */
+  void write_binary(std::string filename, bool with_values = true) {
+    if (space == memory_space_t::device) {
       assert(space == memory_space_t::device);
 
-      thrust::host_vector<offset_t> h_row_offsets(number_of_rows + 1);
-      thrust::host_vector<index_t> h_column_indices(number_of_nonzeros);
-      thrust::host_vector<value_t> h_nonzero_values(number_of_nonzeros);
-
-      fread(memory::raw_pointer_cast(h_row_offsets.data()),     sizeof(offset_t), number_of_rows + 1, file);
-      fread(memory::raw_pointer_cast(h_column_indices.data()),  sizeof(index_t),  number_of_nonzeros, file);
-      fread(memory::raw_pointer_cast(h_nonzero_values.data()),  sizeof(value_t),  number_of_nonzeros, file);
-
-      // Copy data from host to device
-      row_offsets    = h_row_offsets;
-      column_indices = h_column_indices;
-      nonzero_values = h_nonzero_values;
-
+      thrust::host_vector<offset_t> h_row_offsets(row_offsets);
+      thrust::host_vector<index_t> h_column_indices(column_indices);
+      thrust::host_vector<value_t> h_nonzero_values;
+      if (with_values)
+        h_nonzero_values = nonzero_values;
+
+      binary::write(
+          filename, number_of_rows, number_of_columns, number_of_nonzeros,
+          memory::raw_pointer_cast(h_row_offsets.data()),
+          memory::raw_pointer_cast(h_column_indices.data()),
+          with_values ? memory::raw_pointer_cast(h_nonzero_values.data())
+                      : (value_t*)nullptr);
     } else {
       assert(space == memory_space_t::host);
 
-      fread(memory::raw_pointer_cast(row_offsets.data()),     sizeof(offset_t), number_of_rows + 1, file);
-      fread(memory::raw_pointer_cast(column_indices.data()),  sizeof(index_t),  number_of_nonzeros, file);
-      fread(memory::raw_pointer_cast(nonzero_values.data()),  sizeof(value_t),  number_of_nonzeros, file);      
+      binary::write(filename, number_of_rows, number_of_columns,
+                    number_of_nonzeros,
+                    memory::raw_pointer_cast(row_offsets.data()),
+                    memory::raw_pointer_cast(column_indices.data()),
+                    with_values
+                        ? memory::raw_pointer_cast(nonzero_values.data())
+                        : (value_t*)nullptr);
     }
   }
-  
-  void write_binary(std::string filename) {
-    FILE* file = fopen(filename.c_str(), "wb");
 
-    // Write metadata
-    fwrite(&number_of_rows,      sizeof(index_t),  1, file);
-    fwrite(&number_of_columns,   sizeof(index_t),  1, file);
-    fwrite(&number_of_nonzeros,  sizeof(offset_t), 1, file);
+  /**
+   * @brief Memory-map a binary CSR file and return a zero-copy view of it,
+   * usable with `graph::build::from_csr<memory_space_t::host, ...>`. Only the
+   * header is read when opening; see `binary::open_mapped`.
+   *
+   * @param filename binary CSR file.
+   * @param verify if true, verify the checksums of all the sections.
+   * @return binary::mapped_csr_t<index_t, offset_t, value_t>
+   */
+  static binary::mapped_csr_t<index_t, offset_t, value_t> open_mapped(
+      std::string filename,
+      bool verify = false) {
+    static_assert(space == memory_space_t::host,
+                  "Memory-mapped CSR is only available on the host.");
+    return binary::open_mapped<index_t, offset_t, value_t>(filename, verify);
+  }
+
+ private:
+  void read_legacy_binary(std::string filename) {
+    FILE* file = fopen(filename.c_str(), "rb");
+    if (!file) {
+      std::cerr << "File could not be opened: " << filename << std::endl;
+      exit(1);
+    }
 
-    // Write data
-    if(space == memory_space_t::device) {
-      assert(space == memory_space_t::device);
+    auto read = [&](void* data, std::size_t size, std::size_t count) {
+      if (count && fread(data, size, count, file) != count) {
+        std::cerr << "Unexpected end of binary file: " << filename
+                  << std::endl;
+        exit(1);
+      }
+    };
 
-      thrust::host_vector<offset_t> h_row_offsets(row_offsets);
-      thrust::host_vector<index_t> h_column_indices(column_indices);
-      thrust::host_vector<value_t> h_nonzero_values(nonzero_values);
+    // Read metadata
+    read(&number_of_rows, sizeof(index_t), 1);
+    read(&number_of_columns, sizeof(index_t), 1);
+    read(&number_of_nonzeros, sizeof(offset_t), 1);
 
-      fwrite(memory::raw_pointer_cast(h_row_offsets.data()),    sizeof(offset_t), number_of_rows + 1, file);
-      fwrite(memory::raw_pointer_cast(h_column_indices.data()), sizeof(index_t),  number_of_nonzeros, file);
-      fwrite(memory::raw_pointer_cast(h_nonzero_values.data()), sizeof(value_t),  number_of_nonzeros, file);
-    } else {
-      assert(space == memory_space_t::host);
+    thrust::host_vector<offset_t> h_row_offsets(number_of_rows + 1);
+    thrust::host_vector<index_t> h_column_indices(number_of_nonzeros);
+    thrust::host_vector<value_t> h_nonzero_values(number_of_nonzeros);
 
-      fwrite(memory::raw_pointer_cast(row_offsets.data()),    sizeof(offset_t), number_of_rows + 1, file);
-      fwrite(memory::raw_pointer_cast(column_indices.data()), sizeof(index_t),  number_of_nonzeros, file);
-      fwrite(memory::raw_pointer_cast(nonzero_values.data()), sizeof(value_t),  number_of_nonzeros, file);
-    }
+    read(memory::raw_pointer_cast(h_row_offsets.data()), sizeof(offset_t),
+         number_of_rows + 1);
+    read(memory::raw_pointer_cast(h_column_indices.data()), sizeof(index_t),
+         number_of_nonzeros);
+    read(memory::raw_pointer_cast(h_nonzero_values.data()), sizeof(value_t),
+         number_of_nonzeros);
 
     fclose(file);
+
+    // Copy data to the destination memory space
+    row_offsets = h_row_offsets;
+    column_indices = h_column_indices;
+    nonzero_values = h_nonzero_values;
   }
-  
 };  // struct csr_t
 
 }  // namespace format
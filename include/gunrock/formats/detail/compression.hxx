@@ -0,0 +1,261 @@
+/**
+ * @file compression.hxx
+ * @brief Encoding of sorted adjacency lists (delta + varint, or delta +
+ * fixed-width bit-packing) used by the compressed CSR format and view.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace gunrock {
+namespace format {
+
+/**
+ * @brief Encoding of the adjacency lists of a compressed CSR.
+ *
+ * @par Overview
+ * Every row is encoded as the gap of its first neighbor to the row (signed,
+ * zigzag), followed by the gaps between consecutive (sorted) neighbors.
+ * - `varint`: every gap is a byte-aligned varint (7 bits per byte), best for
+ *   skewed gaps (clustered neighbors and a few far ones).
+ * - `bitpacked`: the gaps after the first are packed with the bit width of
+ *   the largest gap of the row, best for uniform gaps; decoding has no
+ *   branches per byte.
+ */
+enum compression_t { varint, bitpacked };  // enum: compression_t
+
+namespace detail {
+namespace compression {
+
+using byte_t = std::uint8_t;
+
+/*!
+ * Bytes readable past the end of an encoded stream (bit-unpacking loads 9
+ * bytes at a time).
+ */
+constexpr std::size_t padding = 16;
+
+inline std::size_t varint_size(std::uint64_t x) {
+  std::size_t size = 1;
+  while (x >= 0x80) {
+    x >>= 7;
+    ++size;
+  }
+  return size;
+}
+
+inline byte_t* encode_varint(std::uint64_t x, byte_t* out) {
+  while (x >= 0x80) {
+    *out++ = (byte_t)(x | 0x80);
+    x >>= 7;
+  }
+  *out++ = (byte_t)x;
+  return out;
+}
+
+inline byte_t const* decode_varint(byte_t const* in, std::uint64_t& x) {
+  byte_t b = *in++;
+  x = b;
+  if (b < 0x80)  // Most gaps of sorted rows fit in a byte.
+    return in;
+  x &= 0x7f;
+  for (int shift = 7;; shift += 7) {
+    b = *in++;
+    x |= (std::uint64_t)(b & 0x7f) << shift;
+    if (b < 0x80)
+      return in;
+  }
+}
+
+inline std::uint64_t zigzag(std::int64_t x) {
+  return ((std::uint64_t)x << 1) ^ (std::uint64_t)(x >> 63);
+}
+
+inline std::int64_t unzigzag(std::uint64_t x) {
+  return (std::int64_t)(x >> 1) ^ -(std::int64_t)(x & 1);
+}
+
+inline int bit_width(std::uint64_t x) {
+  return x ? 64 - __builtin_clzll(x) : 0;
+}
+
+/**
+ * @brief Read `width` bits at bit `position` of `in`.
+ */
+inline std::uint64_t read_bits(byte_t const* in,
+                               std::uint64_t position,
+                               int width) {
+  std::uint64_t word;
+  std::memcpy(&word, in + (position >> 3), sizeof(word));
+  int shift = position & 7;
+  word >>= shift;
+  if (shift + width > 64)
+    word |= (std::uint64_t)in[(position >> 3) + 8] << (64 - shift);
+  return (width == 64) ? word : (word & ((std::uint64_t(1) << width) - 1));
+}
+
+/**
+ * @brief Write `width` bits of `x` at bit `position` of `out` (zeroed),
+ * byte by byte so that adjacent rows can be written concurrently.
+ */
+inline void write_bits(byte_t* out,
+                       std::uint64_t position,
+                       int width,
+                       std::uint64_t x) {
+  for (int written = 0; written < width;) {
+    int shift = (position + written) & 7;
+    int bits = std::min(8 - shift, width - written);
+    out[(position + written) >> 3] |=
+        (byte_t)(((x >> written) & ((1u << bits) - 1)) << shift);
+    written += bits;
+  }
+}
+
+/**
+ * @brief Row header: `degree`, then (if `degree > 0`) the size of the rest of
+ * the row in bytes, so that rows can be skipped without decoding them.
+ */
+struct row_header_t {
+  std::uint64_t degree;
+  std::uint64_t payload;
+};
+
+inline byte_t const* read_header(byte_t const* in, row_header_t& header) {
+  in = decode_varint(in, header.degree);
+  header.payload = 0;
+  if (header.degree)
+    in = decode_varint(in, header.payload);
+  return in;
+}
+
+inline byte_t const* skip_row(byte_t const* in) {
+  row_header_t header;
+  in = read_header(in, header);
+  return in + header.payload;
+}
+
+template <typename index_t>
+std::uint64_t largest_gap(index_t const* columns, std::size_t degree) {
+  std::uint64_t largest = 0;
+  for (std::size_t k = 1; k < degree; ++k)
+    largest = std::max(largest, (std::uint64_t)(columns[k] - columns[k - 1]));
+  return largest;
+}
+
+/**
+ * @brief Size of the payload of a row (without the header).
+ */
+template <typename index_t>
+std::size_t payload_size(std::int64_t source,
+                         index_t const* columns,
+                         std::size_t degree,
+                         compression_t compression) {
+  if (degree == 0)
+    return 0;
+  std::size_t size = varint_size(zigzag((std::int64_t)columns[0] - source));
+  if (compression == compression_t::varint) {
+    for (std::size_t k = 1; k < degree; ++k)
+      size += varint_size((std::uint64_t)(columns[k] - columns[k - 1]));
+  } else {
+    int width = bit_width(largest_gap(columns, degree));
+    size += 1 + ((degree - 1) * width + 7) / 8;
+  }
+  return size;
+}
+
+/**
+ * @brief Size of an encoded row (header and payload).
+ */
+template <typename index_t>
+std::size_t row_size(std::int64_t source,
+                     index_t const* columns,
+                     std::size_t degree,
+                     compression_t compression) {
+  std::size_t payload = payload_size(source, columns, degree, compression);
+  return varint_size(degree) + (degree ? varint_size(payload) : 0) + payload;
+}
+
+/**
+ * @brief Encode the row `source` with the sorted `columns[0, degree)` to
+ * `out` (which must be zeroed for `bitpacked`).
+ * @return byte_t* end of the encoded row.
+ */
+template <typename index_t>
+byte_t* encode_row(std::int64_t source,
+                   index_t const* columns,
+                   std::size_t degree,
+                   compression_t compression,
+                   byte_t* out) {
+  out = encode_varint(degree, out);
+  if (degree == 0)
+    return out;
+  out = encode_varint(payload_size(source, columns, degree, compression),
+                      out);
+  out = encode_varint(zigzag((std::int64_t)columns[0] - source), out);
+
+  if (compression == compression_t::varint) {
+    for (std::size_t k = 1; k < degree; ++k)
+      out = encode_varint((std::uint64_t)(columns[k] - columns[k - 1]), out);
+    return out;
+  }
+
+  int width = bit_width(largest_gap(columns, degree));
+  *out++ = (byte_t)width;
+  for (std::size_t k = 1; k < degree; ++k)
+    write_bits(out, (k - 1) * width, width,
+               (std::uint64_t)(columns[k] - columns[k - 1]));
+  return out + ((degree - 1) * width + 7) / 8;
+}
+
+/**
+ * @brief Decode the row `source` at `in`, calling `op(neighbor, rank)` for
+ * every neighbor, in order, until `op` returns false.
+ * @return byte_t const* end of the row.
+ */
+template <typename index_t, typename operator_t>
+byte_t const* decode_row(byte_t const* in,
+                         std::int64_t source,
+                         compression_t compression,
+                         operator_t op) {
+  row_header_t header;
+  in = read_header(in, header);
+  if (header.degree == 0)
+    return in;
+  byte_t const* end = in + header.payload;
+
+  std::uint64_t x;
+  in = decode_varint(in, x);
+  std::int64_t neighbor = source + unzigzag(x);
+  if (!op((index_t)neighbor, std::size_t(0)))
+    return end;
+
+  if (compression == compression_t::varint) {
+    for (std::size_t k = 1; k < header.degree; ++k) {
+      in = decode_varint(in, x);
+      neighbor += x;
+      if (!op((index_t)neighbor, k))
+        break;
+    }
+  } else {
+    int width = *in++;
+    for (std::size_t k = 1; k < header.degree; ++k) {
+      neighbor += width ? read_bits(in, (k - 1) * width, width) : 0;
+      if (!op((index_t)neighbor, k))
+        break;
+    }
+  }
+  return end;
+}
+
+}  // namespace compression
+}  // namespace detail
+}  // namespace format
+}  // namespace gunrock
@@ -0,0 +1,379 @@
+/**
+ * @file from_coo.hxx
+ * @brief Parallel (OpenMP) host construction of compressed formats (CSR and,
+ * in the same pass, CSC) from a coordinate list.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/memory.hxx>
+#include <gunrock/container/vector.hxx>
+#include <gunrock/algorithms/scan/host.hxx>
+
+namespace gunrock {
+namespace format {
+
+/**
+ * @brief Options for building compressed formats from a coordinate list.
+ *
+ * By default the builder keeps the input order within every row (column) and
+ * keeps duplicate entries. Sorting orders the entries of every row by column
+ * index (stable, so duplicates keep their input order), which is what
+ * `graph_csr_t::get_edge` expects. Merging duplicates implies sorting; all
+ * entries with the same (row, column) are combined into one using the
+ * reducer.
+ */
+struct build_properties_t {
+  bool sort{false};
+  bool merge_duplicates{false};
+  build_properties_t() = default;
+  build_properties_t(bool _sort, bool _merge_duplicates = false)
+      : sort(_sort || _merge_duplicates), merge_duplicates(_merge_duplicates) {}
+};
+
+/**
+ * @namespace reduce
+ * Reducers used to merge the values of duplicate entries. Duplicates are
+ * reduced in input order: `op(op(first, second), third)...`.
+ */
+namespace reduce {
+struct first_t {
+  template <typename type_t>
+  type_t operator()(type_t const& a, type_t const&) const {
+    return a;
+  }
+};
+
+struct last_t {
+  template <typename type_t>
+  type_t operator()(type_t const&, type_t const& b) const {
+    return b;
+  }
+};
+
+struct plus_t {
+  template <typename type_t>
+  type_t operator()(type_t const& a, type_t const& b) const {
+    return a + b;
+  }
+};
+
+struct minimum_t {
+  template <typename type_t>
+  type_t operator()(type_t const& a, type_t const& b) const {
+    return (b < a) ? b : a;
+  }
+};
+
+struct maximum_t {
+  template <typename type_t>
+  type_t operator()(type_t const& a, type_t const& b) const {
+    return (a < b) ? b : a;
+  }
+};
+}  // namespace reduce
+
+namespace detail {
+
+using namespace memory;
+
+template <typename type_t>
+using host_vector_t = vector_t<type_t, memory_space_t::host>;
+
+/**
+ * @brief Number of input partitions, each one gets a private histogram of
+ * `segments + 1` counters. Bounded so that all the histograms together are
+ * at most about twice the size of the input.
+ */
+inline int number_of_partitions(std::int64_t segments, std::int64_t nnz) {
+  std::int64_t budget = std::max<std::int64_t>(1, (2 * nnz) / (segments + 1));
+  return (int)std::min<std::int64_t>(omp_get_max_threads(), budget);
+}
+
+/**
+ * @brief Destination of one compressed format: `segments` rows (CSR) or
+ * columns (CSC), keyed by `keys[e]`, storing `items[e]` and values. The
+ * private histograms double as per-partition write cursors.
+ */
+template <typename index_t, typename offset_t, typename value_t>
+struct compressed_target_t {
+  index_t segments;
+  index_t const* keys;
+  index_t const* items;
+  host_vector_t<offset_t>* offsets;
+  host_vector_t<index_t>* indices;
+  host_vector_t<value_t>* values;
+  std::unique_ptr<offset_t[]> cursors;  // [partition][segment]
+};
+
+/**
+ * @brief Sort every segment by index (stable).
+ */
+template <typename index_t, typename offset_t, typename value_t>
+void sort_segments(index_t const& segments,
+                   offset_t const* offsets,
+                   index_t* indices,
+                   value_t* values) {
+#pragma omp parallel
+  {
+    std::vector<std::pair<index_t, value_t>> buffer;
+
+#pragma omp for schedule(dynamic, 1024)
+    for (std::int64_t s = 0; s < (std::int64_t)segments; ++s) {
+      offset_t begin = offsets[s];
+      offset_t end = offsets[s + 1];
+      if (std::is_sorted(indices + begin, indices + end))
+        continue;
+
+      buffer.resize(end - begin);
+      for (offset_t e = begin; e < end; ++e)
+        buffer[e - begin] = {indices[e], values[e]};
+
+      std::stable_sort(
+          buffer.begin(), buffer.end(),
+          [](auto const& a, auto const& b) { return a.first < b.first; });
+
+      for (offset_t e = begin; e < end; ++e) {
+        indices[e] = buffer[e - begin].first;
+        values[e] = buffer[e - begin].second;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Merge consecutive duplicate indices of every (sorted) segment with
+ * `op`, and compact the arrays.
+ *
+ * @return offset_t number of entries left.
+ */
+template <typename index_t,
+          typename offset_t,
+          typename value_t,
+          typename reduce_op_t>
+offset_t merge_segments(index_t const& segments,
+                        host_vector_t<offset_t>& offsets,
+                        host_vector_t<index_t>& indices,
+                        host_vector_t<value_t>& values,
+                        reduce_op_t op) {
+  host_vector_t<offset_t> counts(segments + 1);
+  offset_t* Ap = offsets.data();
+  index_t* Aj = indices.data();
+  value_t* Ax = values.data();
+
+  // Merge within every segment, in place (at the front of the segment).
+#pragma omp parallel for schedule(dynamic, 1024)
+  for (std::int64_t s = 0; s < (std::int64_t)segments; ++s) {
+    offset_t begin = Ap[s];
+    offset_t end = Ap[s + 1];
+    if (begin == end) {
+      counts[s] = 0;
+      continue;
+    }
+
+    offset_t last = begin;
+    for (offset_t e = begin + 1; e < end; ++e) {
+      if (Aj[e] == Aj[last]) {
+        Ax[last] = op(Ax[last], Ax[e]);
+      } else {
+        ++last;
+        Aj[last] = Aj[e];
+        Ax[last] = Ax[e];
+      }
+    }
+    counts[s] = last - begin + 1;
+  }
+
+  offset_t nnz = algo::scan::host::exclusive_scan(
+      counts.data(), segments, counts.data(), offset_t(0));
+  counts[segments] = nnz;
+
+  if (nnz == Ap[segments])
+    return nnz;  // no duplicates.
+
+  // Compact into new arrays.
+  host_vector_t<index_t> merged_indices(nnz);
+  host_vector_t<value_t> merged_values(nnz);
+
+#pragma omp parallel for schedule(dynamic, 1024)
+  for (std::int64_t s = 0; s < (std::int64_t)segments; ++s) {
+    std::copy(Aj + Ap[s], Aj + Ap[s] + (counts[s + 1] - counts[s]),
+              merged_indices.data() + counts[s]);
+    std::copy(Ax + Ap[s], Ax + Ap[s] + (counts[s + 1] - counts[s]),
+              merged_values.data() + counts[s]);
+  }
+
+  offsets.swap(counts);
+  indices.swap(merged_indices);
+  values.swap(merged_values);
+  return nnz;
+}
+
+/**
+ * @brief Build one or two compressed formats (CSR, and optionally CSC) from a
+ * coordinate list in a single pass over the input.
+ *
+ * 1. The input is cut into contiguous partitions, every partition counts its
+ *    entries per segment in a private histogram (no atomics).
+ * 2. The histograms are turned into per-partition write cursors and the
+ *    segment sizes are scanned (in parallel) into offsets.
+ * 3. Every partition scatters its entries using its own cursors; as the
+ *    partitions are contiguous and ordered, the input order is preserved
+ *    within segments (the result does not depend on the number of threads).
+ * 4. Optionally, segments are sorted and duplicates are merged.
+ *
+ * Row indices must be in `[0, number_of_rows)` and column indices in
+ * `[0, number_of_columns)` (asserted in debug builds).
+ *
+ * @return offset_t number of nonzeros after merging.
+ */
+template <typename index_t,
+          typename offset_t,
+          typename value_t,
+          typename reduce_op_t>
+offset_t from_coo(index_t const& number_of_rows,
+                  index_t const& number_of_columns,
+                  offset_t const& number_of_nonzeros,
+                  index_t const* I,
+                  index_t const* J,
+                  value_t const* V,
+                  host_vector_t<offset_t>& csr_offsets,
+                  host_vector_t<index_t>& csr_indices,
+                  host_vector_t<value_t>& csr_values,
+                  host_vector_t<offset_t>* csc_offsets,
+                  host_vector_t<index_t>* csc_indices,
+                  host_vector_t<value_t>* csc_values,
+                  build_properties_t const& properties,
+                  reduce_op_t op) {
+  using target_t = compressed_target_t<index_t, offset_t, value_t>;
+
+  target_t targets[2];
+  int number_of_targets = (csc_offsets != nullptr) ? 2 : 1;
+
+  targets[0].segments = number_of_rows;
+  targets[0].keys = I;
+  targets[0].items = J;
+  targets[0].offsets = &csr_offsets;
+  targets[0].indices = &csr_indices;
+  targets[0].values = &csr_values;
+
+  if (number_of_targets == 2) {
+    targets[1].segments = number_of_columns;
+    targets[1].keys = J;
+    targets[1].items = I;
+    targets[1].offsets = csc_offsets;
+    targets[1].indices = csc_indices;
+    targets[1].values = csc_values;
+  }
+
+  std::int64_t nnz = (std::int64_t)number_of_nonzeros;
+  std::int64_t largest = (number_of_targets == 2)
+                             ? (std::int64_t)number_of_rows + number_of_columns
+                             : (std::int64_t)number_of_rows;
+  int partitions = number_of_partitions(largest, nnz);
+  auto partition_begin = [&](int p) { return (nnz * p) / partitions; };
+
+  for (int t = 0; t < number_of_targets; ++t) {
+    auto& target = targets[t];
+    target.cursors.reset(
+        new offset_t[(std::size_t)partitions * (target.segments + 1)]);
+    target.offsets->resize(target.segments + 1);
+    target.indices->resize(number_of_nonzeros);
+    target.values->resize(number_of_nonzeros);
+  }
+
+  // 1. Private histograms (first touched by the partition that uses them).
+#pragma omp parallel for schedule(static)
+  for (int p = 0; p < partitions; ++p) {
+    for (int t = 0; t < number_of_targets; ++t) {
+      auto& target = targets[t];
+      offset_t* counts = target.cursors.get() +
+                         (std::size_t)p * (target.segments + 1);
+      std::fill(counts, counts + target.segments + 1, offset_t(0));
+      for (std::int64_t e = partition_begin(p); e < partition_begin(p + 1);
+           ++e) {
+        assert(target.keys[e] >= 0 && target.keys[e] < target.segments);
+        ++counts[target.keys[e]];
+      }
+    }
+  }
+
+  // 2. Segment sizes and per-partition cursors (relative to the segment).
+  for (int t = 0; t < number_of_targets; ++t) {
+    auto& target = targets[t];
+    offset_t* Ap = target.offsets->data();
+    std::int64_t stride = (std::int64_t)target.segments + 1;
+
+#pragma omp parallel for schedule(static)
+    for (std::int64_t s = 0; s < (std::int64_t)target.segments; ++s) {
+      offset_t sum = 0;
+      for (int p = 0; p < partitions; ++p) {
+        offset_t count = target.cursors[(std::size_t)p * stride + s];
+        target.cursors[(std::size_t)p * stride + s] = sum;
+        sum += count;
+      }
+      Ap[s] = sum;
+    }
+
+    Ap[target.segments] = algo::scan::host::exclusive_scan(
+        Ap, target.segments, Ap, offset_t(0));
+  }
+
+  // 3. Scatter.
+#pragma omp parallel for schedule(static)
+  for (int p = 0; p < partitions; ++p) {
+    for (int t = 0; t < number_of_targets; ++t) {
+      auto& target = targets[t];
+      offset_t* cursors = target.cursors.get() +
+                         (std::size_t)p * (target.segments + 1);
+      offset_t const* Ap = target.offsets->data();
+      index_t* Aj = target.indices->data();
+      value_t* Ax = target.values->data();
+
+      for (std::int64_t e = partition_begin(p); e < partition_begin(p + 1);
+           ++e) {
+        index_t key = target.keys[e];
+        assert(key >= 0 && key < target.segments);  // row (column) in range.
+        offset_t position = Ap[key] + cursors[key]++;
+        Aj[position] = target.items[e];
+        Ax[position] = V[e];
+      }
+    }
+  }
+
+  // 4. Sort and merge.
+  offset_t merged = number_of_nonzeros;
+  for (int t = 0; t < number_of_targets; ++t) {
+    auto& target = targets[t];
+    target.cursors.reset();
+
+    if (properties.sort || properties.merge_duplicates)
+      sort_segments(target.segments, target.offsets->data(),
+                    target.indices->data(), target.values->data());
+
+    if (properties.merge_duplicates)
+      merged = merge_segments<index_t, offset_t, value_t>(
+          target.segments, *target.offsets, *target.indices, *target.values,
+          op);
+  }
+
+  return merged;
+}
+
+}  // namespace detail
+}  // namespace format
+}  // namespace gunrock
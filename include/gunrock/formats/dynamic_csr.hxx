@@ -0,0 +1,470 @@
+/**
+ * @file dynamic_csr.hxx
+ * @brief Dynamic CSR format: rows with slack, relocated on overflow and
+ * compacted periodically, updated by sorted batches of edge insertions and
+ * deletions.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/memory.hxx>
+#include <gunrock/container/vector.hxx>
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/algorithms/scan/host.hxx>
+
+namespace gunrock {
+namespace format {
+
+using namespace memory;
+
+enum class update_t { insert, erase };  // enum: update_t
+
+/**
+ * @brief An edge update: `insert` adds the edge `(source, destination)` or
+ * sets its weight if it exists, `erase` removes it (if it exists). Batches
+ * are sorted by `(source, destination)`; updates of the same edge apply in
+ * batch order (the last one wins).
+ */
+template <typename index_t, typename value_t>
+struct edge_update_t {
+  index_t source;
+  index_t destination;
+  value_t weight;
+  update_t op;
+
+  bool operator<(edge_update_t const& rhs) const {
+    return (source < rhs.source) ||
+           (source == rhs.source && destination < rhs.destination);
+  }
+};
+
+/**
+ * @brief Storage policy: every (re)allocated row gets
+ * `max(minimum_slack, slack * degree)` free slots; a row that overflows moves
+ * to the end of the storage, leaving its old slots dead, and the whole
+ * storage is compacted once dead slots exceed `compaction_threshold` of it.
+ */
+struct dynamic_csr_properties_t {
+  double slack{0.25};
+  std::size_t minimum_slack{4};
+  double compaction_threshold{0.5};
+  dynamic_csr_properties_t() = default;
+};
+
+/**
+ * @brief Cumulative update statistics.
+ */
+struct dynamic_csr_stats_t {
+  std::size_t batches{0};
+  std::size_t updates{0};      // edge updates received.
+  std::size_t inserted{0};     // new edges.
+  std::size_t reweighted{0};   // inserts of an existing edge.
+  std::size_t erased{0};       // removed edges (erase of a missing edge: none).
+  std::size_t relocations{0};  // rows moved to the end of the storage.
+  std::size_t compactions{0};
+};
+
+/**
+ * @brief Compressed Sparse Row format that supports edge insertions and
+ * deletions. Host only; see `graph::graph_dynamic_csr_t` for the graph view.
+ *
+ * @par Overview
+ * Row `i` occupies the slots `[row_offsets[i], row_offsets[i] +
+ * row_capacities[i])` of `column_indices` and `nonzero_values`, the first
+ * `row_lengths[i]` of them live and sorted by column. Rows are not in order
+ * in the storage (relocated rows live at its end), and `row_indices` holds
+ * the row of every slot (invalid for free or dead slots). Slots are the edge
+ * ids of the graph view; they stay valid until the next `update()`.
+ *
+ * The graph is simple: parallel edges of the input are merged (smallest
+ * value) by `from_csr()`.
+ *
+ * @tparam index_t
+ * @tparam offset_t
+ * @tparam value_t
+ */
+template <memory_space_t space,
+          typename index_t,
+          typename offset_t,
+          typename value_t>
+struct dynamic_csr_t {
+  static_assert(space == memory_space_t::host,
+                "Dynamic CSR is only supported on the host.");
+
+  using update_type = edge_update_t<index_t, value_t>;
+
+  index_t number_of_rows;
+  index_t number_of_columns;
+  offset_t number_of_nonzeros;  // live edges.
+
+  dynamic_csr_properties_t properties;
+  dynamic_csr_stats_t stats;
+
+  vector_t<offset_t, space> row_offsets;     // first slot of every row.
+  vector_t<offset_t, space> row_lengths;     // live slots of every row.
+  vector_t<offset_t, space> row_capacities;  // slots of every row.
+  vector_t<index_t, space> column_indices;   // Aj, per slot.
+  vector_t<index_t, space> row_indices;      // row of every slot.
+  vector_t<value_t, space> nonzero_values;   // Ax, per slot.
+
+  dynamic_csr_t()
+      : number_of_rows(0),
+        number_of_columns(0),
+        number_of_nonzeros(0),
+        properties(),
+        stats(),
+        dead_slots(0) {}
+
+  ~dynamic_csr_t() {}
+
+  /**
+   * @brief Number of slots (live, free and dead), the range of edge ids.
+   */
+  offset_t get_number_of_slots() const {
+    return (offset_t)column_indices.size();
+  }
+
+  offset_t get_number_of_dead_slots() const { return dead_slots; }
+
+  std::size_t get_size_in_bytes() const {
+    return (row_offsets.size() + row_lengths.size() + row_capacities.size()) *
+               sizeof(offset_t) +
+           (column_indices.size() + row_indices.size()) * sizeof(index_t) +
+           nonzero_values.size() * sizeof(value_t);
+  }
+
+  /**
+   * @brief Build from a CSR: rows are sorted, merged and laid out with slack.
+   *
+   * @param csr input CSR (host).
+   * @param _properties see `dynamic_csr_properties_t`.
+   * @return dynamic_csr_t&
+   */
+  dynamic_csr_t& from_csr(
+      csr_t<memory_space_t::host, index_t, offset_t, value_t> const& csr,
+      dynamic_csr_properties_t _properties = dynamic_csr_properties_t()) {
+    number_of_rows = csr.number_of_rows;
+    number_of_columns = csr.number_of_columns;
+    properties = _properties;
+    stats = dynamic_csr_stats_t();
+
+    auto Ap = csr.row_offsets.data();
+    auto Aj = csr.column_indices.data();
+    auto Ax = csr.nonzero_values.data();
+    std::int64_t n = number_of_rows;
+
+    // Sorted, merged rows in a temporary CSR layout.
+    std::vector<index_t> columns(Aj, Aj + csr.number_of_nonzeros);
+    std::vector<value_t> values(Ax, Ax + csr.number_of_nonzeros);
+    row_lengths.resize(n);
+
+#pragma omp parallel
+    {
+      std::vector<std::pair<index_t, value_t>> row;
+#pragma omp for schedule(dynamic, 1024)
+      for (std::int64_t i = 0; i < n; ++i) {
+        row.clear();
+        for (offset_t e = Ap[i]; e < Ap[i + 1]; ++e)
+          row.emplace_back(Aj[e], Ax[e]);
+        std::sort(row.begin(), row.end());
+        offset_t length = 0;
+        for (std::size_t k = 0; k < row.size(); ++k)
+          if (k == 0 || row[k].first != row[k - 1].first) {
+            columns[Ap[i] + length] = row[k].first;
+            values[Ap[i] + length++] = row[k].second;
+          }
+        row_lengths[i] = length;
+      }
+    }
+
+    layout(Ap, columns.data(), values.data());
+    return *this;
+  }
+
+  /**
+   * @brief Apply a batch of edge updates, sorted by `(source, destination)`
+   * (see `edge_update_t`). Rows are merged with their updates in parallel,
+   * in place if they fit their capacity, otherwise into new slots at the end
+   * of the storage. Slots (edge ids) and storage pointers may change: rebuild
+   * the graph view after every batch.
+   *
+   * @param updates sorted batch.
+   * @param count number of updates.
+   */
+  void update(update_type const* updates, std::size_t count) {
+    if (!std::is_sorted(updates, updates + count)) {
+      std::cerr << "Error: edge updates must be sorted by (source, "
+                   "destination)."
+                << std::endl;
+      exit(1);
+    }
+    for (std::size_t k = 0; k < count; ++k)
+      if (updates[k].source < 0 || updates[k].source >= number_of_rows ||
+          updates[k].destination < 0 ||
+          updates[k].destination >= number_of_columns) {
+        std::cerr << "Error: edge update (" << updates[k].source << ", "
+                  << updates[k].destination << ") out of range." << std::endl;
+        exit(1);
+      }
+
+    // Updates of every row, [runs[r], runs[r + 1]).
+    std::vector<std::size_t> runs;
+    for (std::size_t k = 0; k < count; ++k)
+      if (k == 0 || updates[k].source != updates[k - 1].source)
+        runs.push_back(k);
+    std::int64_t number_of_runs = runs.size();
+    runs.push_back(count);
+
+    // Merge every row that fits in place; size the others.
+    std::vector<offset_t> moved(number_of_runs, 0);
+    std::size_t inserted = 0, reweighted = 0, erased = 0;
+#pragma omp parallel reduction(+ : inserted, reweighted, erased)
+    {
+      std::vector<index_t> columns;
+      std::vector<value_t> values;
+#pragma omp for schedule(dynamic, 64)
+      for (std::int64_t r = 0; r < number_of_runs; ++r) {
+        index_t i = updates[runs[r]].source;
+        offset_t length =
+            merge(i, updates + runs[r], updates + runs[r + 1], columns, values,
+                  inserted, reweighted, erased);
+        if (length <= row_capacities[i])
+          store(i, row_offsets[i], columns, values);
+        else
+          moved[r] = grow(length);
+      }
+    }
+
+    // Allocate the overflowing rows at the end, then merge them there.
+    offset_t slots = get_number_of_slots();
+    offset_t added = algo::scan::host::exclusive_scan(
+        moved.data(), number_of_runs, moved.data(), offset_t(0));
+    std::size_t relocated = 0;
+    if (added > 0) {
+      column_indices.resize(slots + added);
+      nonzero_values.resize(slots + added);
+      row_indices.resize(slots + added,
+                         gunrock::numeric_limits<index_t>::invalid());
+
+#pragma omp parallel reduction(+ : relocated)
+      {
+        std::vector<index_t> columns;
+        std::vector<value_t> values;
+        std::size_t ignored = 0;
+#pragma omp for schedule(dynamic, 64)
+        for (std::int64_t r = 0; r < number_of_runs; ++r) {
+          offset_t capacity =
+              (r + 1 < number_of_runs ? moved[r + 1] : added) - moved[r];
+          if (capacity == 0)
+            continue;
+          index_t i = updates[runs[r]].source;
+          merge(i, updates + runs[r], updates + runs[r + 1], columns, values,
+                ignored, ignored, ignored);
+          std::fill(row_indices.begin() + row_offsets[i],
+                    row_indices.begin() + row_offsets[i] + row_capacities[i],
+                    gunrock::numeric_limits<index_t>::invalid());
+          __atomic_fetch_add(&dead_slots, row_capacities[i], __ATOMIC_RELAXED);
+          row_offsets[i] = slots + moved[r];
+          row_capacities[i] = capacity;
+          store(i, row_offsets[i], columns, values);
+          ++relocated;
+        }
+      }
+    }
+
+    number_of_nonzeros += (offset_t)inserted - (offset_t)erased;
+    stats.batches++;
+    stats.updates += count;
+    stats.inserted += inserted;
+    stats.reweighted += reweighted;
+    stats.erased += erased;
+    stats.relocations += relocated;
+
+    if (dead_slots > properties.compaction_threshold * get_number_of_slots())
+      compact();
+  }
+
+  /**
+   * @brief Apply a batch of edge updates, see `update()`.
+   */
+  void update(std::vector<update_type> const& updates) {
+    update(updates.data(), updates.size());
+  }
+
+  /**
+   * @brief Lay the rows out again in row order, with fresh slack, dropping
+   * the dead slots.
+   */
+  void compact() {
+    std::int64_t n = number_of_rows;
+    std::vector<offset_t> offsets(n + 1);
+    std::vector<index_t> columns(number_of_nonzeros);
+    std::vector<value_t> values(number_of_nonzeros);
+    algo::scan::host::exclusive_scan(row_lengths.data(), n, offsets.data(),
+                                     offset_t(0));
+    offsets[n] = number_of_nonzeros;
+
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (std::int64_t i = 0; i < n; ++i) {
+      std::copy(column_indices.begin() + row_offsets[i],
+                column_indices.begin() + row_offsets[i] + row_lengths[i],
+                columns.begin() + offsets[i]);
+      std::copy(nonzero_values.begin() + row_offsets[i],
+                nonzero_values.begin() + row_offsets[i] + row_lengths[i],
+                values.begin() + offsets[i]);
+    }
+
+    layout(offsets.data(), columns.data(), values.data());
+    stats.compactions++;
+  }
+
+  /**
+   * @brief Live edges as a (sorted) CSR.
+   *
+   * @param csr output CSR (host).
+   */
+  void to_csr(csr_t<memory_space_t::host, index_t, offset_t, value_t>& csr)
+      const {
+    csr = csr_t<memory_space_t::host, index_t, offset_t, value_t>(
+        number_of_rows, number_of_columns, number_of_nonzeros);
+    std::int64_t n = number_of_rows;
+    algo::scan::host::exclusive_scan(row_lengths.data(), n,
+                                     csr.row_offsets.data(), offset_t(0));
+    csr.row_offsets[n] = number_of_nonzeros;
+
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (std::int64_t i = 0; i < n; ++i) {
+      std::copy(column_indices.begin() + row_offsets[i],
+                column_indices.begin() + row_offsets[i] + row_lengths[i],
+                csr.column_indices.begin() + csr.row_offsets[i]);
+      std::copy(nonzero_values.begin() + row_offsets[i],
+                nonzero_values.begin() + row_offsets[i] + row_lengths[i],
+                csr.nonzero_values.begin() + csr.row_offsets[i]);
+    }
+  }
+
+ private:
+  offset_t dead_slots;
+
+  offset_t grow(offset_t length) const {
+    return length + (offset_t)std::max<double>(properties.minimum_slack,
+                                               std::ceil(properties.slack *
+                                                         length));
+  }
+
+  /**
+   * @brief Rows `[Ap[i], Ap[i] + row_lengths[i])` of `Aj`/`Ax` (sorted and
+   * merged) into a fresh storage, in row order, with slack.
+   */
+  void layout(offset_t const* Ap, index_t const* Aj, value_t const* Ax) {
+    std::int64_t n = number_of_rows;
+    row_offsets.resize(n);
+    row_capacities.resize(n);
+
+#pragma omp parallel for schedule(static)
+    for (std::int64_t i = 0; i < n; ++i)
+      row_capacities[i] = grow(row_lengths[i]);
+
+    offset_t slots = algo::scan::host::exclusive_scan(
+        row_capacities.data(), n, row_offsets.data(), offset_t(0));
+
+    column_indices.resize(slots);
+    nonzero_values.resize(slots);
+    row_indices.resize(slots);
+
+    offset_t nonzeros = 0;
+#pragma omp parallel for schedule(dynamic, 1024) reduction(+ : nonzeros)
+    for (std::int64_t i = 0; i < n; ++i) {
+      offset_t begin = row_offsets[i], length = row_lengths[i];
+      std::copy(Aj + Ap[i], Aj + Ap[i] + length,
+                column_indices.begin() + begin);
+      std::copy(Ax + Ap[i], Ax + Ap[i] + length,
+                nonzero_values.begin() + begin);
+      std::fill(row_indices.begin() + begin,
+                row_indices.begin() + begin + length, (index_t)i);
+      std::fill(row_indices.begin() + begin + length,
+                row_indices.begin() + begin + row_capacities[i],
+                gunrock::numeric_limits<index_t>::invalid());
+      nonzeros += length;
+    }
+
+    number_of_nonzeros = nonzeros;
+    dead_slots = 0;
+  }
+
+  /**
+   * @brief Merge row `i` with its updates `[first, last)` into `columns` and
+   * `values`; returns the new length.
+   */
+  offset_t merge(index_t i,
+                 update_type const* first,
+                 update_type const* last,
+                 std::vector<index_t>& columns,
+                 std::vector<value_t>& values,
+                 std::size_t& inserted,
+                 std::size_t& reweighted,
+                 std::size_t& erased) const {
+    auto Aj = column_indices.data() + row_offsets[i];
+    auto Ax = nonzero_values.data() + row_offsets[i];
+    offset_t length = row_lengths[i];
+
+    columns.clear();
+    values.clear();
+    offset_t e = 0;
+    while (e < length || first != last) {
+      if (first == last || (e < length && Aj[e] < first->destination)) {
+        columns.push_back(Aj[e]);
+        values.push_back(Ax[e++]);
+        continue;
+      }
+
+      // Last update of this destination wins.
+      index_t j = first->destination;
+      while (first + 1 != last && (first + 1)->destination == j)
+        ++first;
+      bool exists = (e < length && Aj[e] == j);
+      if (first->op == update_t::insert) {
+        columns.push_back(j);
+        values.push_back(first->weight);
+        exists ? ++reweighted : ++inserted;
+      } else if (exists) {
+        ++erased;
+      }
+      e += exists;
+      ++first;
+    }
+    return (offset_t)columns.size();
+  }
+
+  void store(index_t i,
+             offset_t begin,
+             std::vector<index_t> const& columns,
+             std::vector<value_t> const& values) {
+    offset_t length = columns.size();
+    std::copy(columns.begin(), columns.end(), column_indices.begin() + begin);
+    std::copy(values.begin(), values.end(), nonzero_values.begin() + begin);
+    std::fill(row_indices.begin() + begin, row_indices.begin() + begin + length,
+              i);
+    std::fill(row_indices.begin() + begin + length,
+              row_indices.begin() + begin + row_capacities[i],
+              gunrock::numeric_limits<index_t>::invalid());
+    row_lengths[i] = length;
+  }
+};  // struct dynamic_csr_t
+
+}  // namespace format
+}  // namespace gunrock
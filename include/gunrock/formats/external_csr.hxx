@@ -0,0 +1,423 @@
+/**
+ * @file external_csr.hxx
+ * @brief Semi-external (out-of-core) binary CSR: the row offsets are resident,
+ * the adjacency stays on disk and is streamed in edge-balanced blocks, with
+ * asynchronous prefetch.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <future>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <gunrock/formats/binary.hxx>
+
+namespace gunrock {
+namespace format {
+namespace binary {
+
+/**
+ * @brief What a block read brings in: the column indices, the nonzero values
+ * or both (files without a values section read no values, they are 1).
+ */
+enum class contents_t : unsigned {
+  adjacency = 1 << 0,
+  weights = 1 << 1,
+  all = adjacency | weights
+};
+
+constexpr contents_t operator|(contents_t lhs, contents_t rhs) {
+  return static_cast<contents_t>(static_cast<unsigned>(lhs) |
+                                 static_cast<unsigned>(rhs));
+}
+
+constexpr contents_t operator&(contents_t lhs, contents_t rhs) {
+  return static_cast<contents_t>(static_cast<unsigned>(lhs) &
+                                 static_cast<unsigned>(rhs));
+}
+
+/**
+ * @brief Whether `contents` includes all of `part`.
+ */
+constexpr bool includes(contents_t contents, contents_t part) {
+  return (contents & part) == part;
+}
+
+struct external_csr_properties_t {
+  /*!
+   * Target size of a block (column indices and values), in bytes. Blocks are
+   * cut at row boundaries so that they hold about the same number of edges;
+   * a row larger than the target is a block of its own.
+   */
+  std::size_t block_bytes{std::size_t(64) << 20};
+
+  /*!
+   * Blocks in flight: while one block is processed, up to `depth - 1` of the
+   * next ones are read in the background. The adjacency resident at any time
+   * is about `depth * block_bytes`.
+   */
+  std::size_t depth{3};
+
+  external_csr_properties_t() = default;
+};
+
+/**
+ * @brief I/O counters (cumulative, see `external_csr_t::reset_stats()`):
+ * bytes and blocks read, and the time the caller waited for a block that was
+ * not read yet (0 when the reads are fully overlapped with the processing).
+ */
+struct external_csr_stats_t {
+  std::size_t bytes_read{0};
+  std::size_t blocks_read{0};
+  float read_time{0};  // ms, in the background.
+  float wait_time{0};  // ms, stalled on a read.
+};
+
+/**
+ * @brief A block of rows `[first_row, last_row)` and their edges
+ * `[first_edge, last_edge)`, in memory. Edge `e` of the file is at
+ * `column_indices[e - first_edge]`.
+ */
+template <typename index_t, typename offset_t, typename value_t>
+struct block_t {
+  std::size_t id{0};
+  index_t first_row{0};
+  index_t last_row{0};
+  offset_t first_edge{0};
+  offset_t last_edge{0};
+  std::vector<index_t> column_indices;
+  std::vector<value_t> nonzero_values;
+};
+
+/**
+ * @brief Semi-external view of a (versioned) binary CSR file, see
+ * `binary::write()`. Only the header and the row offsets are read when the
+ * file is opened; the rows are partitioned in edge-balanced blocks, and
+ * `for_each_block()` streams a selection of them (in file order, so the reads
+ * are large and sequential) while the caller processes the previous ones.
+ * Algorithms keep their vertex state in memory and select the blocks of
+ * their active vertices, see `applications/cpu/external.hxx`.
+ *
+ * @note Reads use `pread` on a file descriptor (no mapping), so the
+ * adjacency resident in the process is bounded by the blocks in flight, and
+ * `stats.bytes_read` is exactly what was asked of the disk (or page cache).
+ */
+template <typename index_t, typename offset_t, typename value_t>
+class external_csr_t {
+ public:
+  using block_type = block_t<index_t, offset_t, value_t>;
+
+  std::string filename;
+  index_t number_of_rows;
+  index_t number_of_columns;
+  offset_t number_of_nonzeros;
+
+  std::vector<offset_t> row_offsets;  // resident (Ap).
+  std::vector<index_t> block_offsets;  // first row of every block.
+
+  external_csr_properties_t properties;
+  external_csr_stats_t stats;
+
+  external_csr_t()
+      : number_of_rows(0),
+        number_of_columns(0),
+        number_of_nonzeros(0),
+        descriptor(-1),
+        values(false),
+        column_indices_offset(0),
+        nonzero_values_offset(0) {}
+
+  external_csr_t(std::string const& _filename,
+                 external_csr_properties_t _properties =
+                     external_csr_properties_t())
+      : external_csr_t() {
+    open(_filename, _properties);
+  }
+
+  ~external_csr_t() { close(); }
+
+  /*! Disable copy ctor and assignment operator (owns the descriptor). */
+  external_csr_t(const external_csr_t& rhs) = delete;
+  external_csr_t& operator=(const external_csr_t& rhs) = delete;
+
+  /**
+   * @brief Open `_filename`, read and validate its header, read (and verify)
+   * its row offsets, and partition its rows in blocks.
+   */
+  void open(std::string const& _filename,
+            external_csr_properties_t _properties =
+                external_csr_properties_t()) {
+    close();
+    filename = _filename;
+    properties = _properties;
+    properties.depth = std::max<std::size_t>(1, properties.depth);
+    stats = external_csr_stats_t();
+
+    if ((descriptor = ::open(filename.c_str(), O_RDONLY)) < 0) {
+      std::cerr << "File could not be opened: " << filename << std::endl;
+      exit(1);
+    }
+    std::uint64_t file_size = (std::uint64_t)lseek(descriptor, 0, SEEK_END);
+
+    header_t header;
+    if (file_size >= sizeof(header_t))
+      read(&header, 0, sizeof(header_t));
+    if (file_size < sizeof(header_t) ||
+        std::memcmp(header.magic, magic, sizeof(magic)) != 0) {
+      std::cerr << "Semi-external traversal needs a versioned binary CSR file "
+                   "(see binary::write()): "
+                << filename << std::endl;
+      exit(1);
+    }
+    detail::validate_header<index_t, offset_t, value_t>(header, file_size,
+                                                        filename);
+
+    number_of_rows = (index_t)header.number_of_rows;
+    number_of_columns = (index_t)header.number_of_columns;
+    number_of_nonzeros = (offset_t)header.number_of_nonzeros;
+    values = header.flags & binary::has_values;
+    column_indices_offset = header.sections[column_indices].offset;
+    nonzero_values_offset = header.sections[nonzero_values].offset;
+
+    auto const& offsets = header.sections[binary::row_offsets];
+    row_offsets.resize((std::size_t)number_of_rows + 1);
+    read(row_offsets.data(), offsets.offset, offsets.bytes);
+    if (checksum(row_offsets.data(), offsets.bytes) != offsets.checksum) {
+      std::cerr << "Binary CSR checksum mismatch (section "
+                << binary::row_offsets << "): " << filename << std::endl;
+      exit(1);
+    }
+    if (row_offsets.front() != 0 || row_offsets.back() != number_of_nonzeros) {
+      std::cerr << "Binary CSR row offsets do not span the "
+                << number_of_nonzeros << " nonzeros (first = "
+                << row_offsets.front()
+                << ", last = " << row_offsets.back() << "): " << filename
+                << std::endl;
+      exit(1);
+    }
+
+    partition();
+  }
+
+  /**
+   * @brief Close the file (safe to call twice). Resident offsets stay.
+   */
+  void close() {
+    if (descriptor >= 0)
+      ::close(descriptor);
+    descriptor = -1;
+  }
+
+  bool has_values() const { return values; }
+  std::size_t get_number_of_blocks() const { return block_offsets.size() - 1; }
+
+  /**
+   * @brief Block holding row `v`.
+   */
+  std::size_t get_block(index_t const& v) const {
+    return std::upper_bound(block_offsets.begin(), block_offsets.end(), v) -
+           block_offsets.begin() - 1;
+  }
+
+  /**
+   * @brief Bytes of the adjacency (and values) of a block, on disk.
+   */
+  std::size_t get_block_bytes(std::size_t b,
+                              contents_t contents = contents_t::all) const {
+    std::size_t edges = row_offsets[block_offsets[b + 1]] -
+                        row_offsets[block_offsets[b]];
+    bool adjacency = includes(contents, contents_t::adjacency);
+    bool weights = includes(contents, contents_t::weights) && values;
+    return edges * ((adjacency ? sizeof(index_t) : 0) +
+                    (weights ? sizeof(value_t) : 0));
+  }
+
+  void reset_stats() { stats = external_csr_stats_t(); }
+
+  /**
+   * @brief Read the blocks `blocks[0, count)` (in this order, increasing for
+   * sequential reads) and call `op(block)` on each, on the calling thread, as
+   * soon as it is in memory. Up to `properties.depth - 1` blocks are read
+   * ahead in the background while `op` runs, so `op` may itself be parallel
+   * (OpenMP) and overlaps with the I/O.
+   *
+   * @param blocks ids of the blocks to read.
+   * @param count number of blocks.
+   * @param op `void op(block_type const&)`.
+   * @param contents column indices, values or both.
+   */
+  template <typename op_t>
+  void for_each_block(std::size_t const* blocks,
+                      std::size_t count,
+                      op_t op,
+                      contents_t contents = contents_t::all) {
+    if (count == 0)
+      return;
+
+    std::size_t depth = std::min(properties.depth, count);
+    std::vector<block_type> ring(depth);
+    std::vector<std::future<float>> pending(depth);
+
+    auto issue = [&](std::size_t i) {
+      block_type* block = &ring[i % depth];
+      std::size_t b = blocks[i];
+      pending[i % depth] =
+          std::async(std::launch::async, [this, b, block, contents]() {
+            return load(b, *block, contents);
+          });
+    };
+
+    for (std::size_t i = 0; i < depth; ++i)
+      issue(i);
+
+    for (std::size_t i = 0; i < count; ++i) {
+      auto& future = pending[i % depth];
+      auto t_start = std::chrono::high_resolution_clock::now();
+      float elapsed = future.get();
+      auto t_stop = std::chrono::high_resolution_clock::now();
+      stats.wait_time +=
+          std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+      stats.read_time += elapsed;
+      stats.bytes_read += get_block_bytes(blocks[i], contents);
+      stats.blocks_read++;
+
+      op(static_cast<block_type const&>(ring[i % depth]));
+
+      if (i + depth < count)
+        issue(i + depth);
+    }
+  }
+
+  /**
+   * @brief `for_each_block()` over the blocks whose flag is set in
+   * `selected` (one per block).
+   */
+  template <typename op_t>
+  void for_each_block(std::vector<char> const& selected,
+                      op_t op,
+                      contents_t contents = contents_t::all) {
+    std::vector<std::size_t> blocks;
+    for (std::size_t b = 0; b < selected.size(); ++b)
+      if (selected[b])
+        blocks.push_back(b);
+    for_each_block(blocks.data(), blocks.size(), op, contents);
+  }
+
+ private:
+  int descriptor;
+  bool values;
+  std::uint64_t column_indices_offset;
+  std::uint64_t nonzero_values_offset;
+
+  /**
+   * @brief `bytes` bytes at `offset` of the file into `buffer`.
+   */
+  void read(void* buffer, std::uint64_t offset, std::size_t bytes) const {
+    char* cursor = static_cast<char*>(buffer);
+    while (bytes) {
+      ssize_t done = ::pread(descriptor, cursor, bytes, (off_t)offset);
+      if (done < 0 && errno == EINTR)
+        continue;
+      if (done <= 0) {
+        std::cerr << "Could not read from file: " << filename << std::endl;
+        exit(1);
+      }
+      cursor += done;
+      offset += done;
+      bytes -= done;
+    }
+  }
+
+  /**
+   * @brief Read block `b` into `block` (reusing its storage).
+   * @return float elapsed time in milliseconds.
+   */
+  float load(std::size_t b, block_type& block, contents_t contents) const {
+    auto t_start = std::chrono::high_resolution_clock::now();
+
+    block.id = b;
+    block.first_row = block_offsets[b];
+    block.last_row = block_offsets[b + 1];
+    block.first_edge = row_offsets[block.first_row];
+    block.last_edge = row_offsets[block.last_row];
+    std::size_t edges = block.last_edge - block.first_edge;
+
+    if (includes(contents, contents_t::adjacency)) {
+      block.column_indices.resize(edges);
+      read(block.column_indices.data(),
+           column_indices_offset + block.first_edge * sizeof(index_t),
+           edges * sizeof(index_t));
+
+      // The traversals index their per-vertex arrays with the column indices,
+      // which the file does not checksum: check they are vertices.
+      index_t vertices = std::min(number_of_rows, number_of_columns);
+      auto invalid = std::find_if(
+          block.column_indices.begin(), block.column_indices.end(),
+          [&](index_t const& v) { return v < 0 || v >= vertices; });
+      if (invalid != block.column_indices.end()) {
+        std::cerr << "Binary CSR column index " << *invalid << " of block " << b
+                  << " is not a vertex (there are " << vertices
+                  << "): " << filename << std::endl;
+        exit(1);
+      }
+    }
+
+    if (includes(contents, contents_t::weights)) {
+      if (values) {
+        block.nonzero_values.resize(edges);
+        read(block.nonzero_values.data(),
+             nonzero_values_offset + block.first_edge * sizeof(value_t),
+             edges * sizeof(value_t));
+      } else {
+        // Pattern-only graph, use value 1.0 for all nonzero entries.
+        block.nonzero_values.assign(edges, (value_t)1);
+      }
+    }
+
+    auto t_stop = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<float, std::milli>(t_stop - t_start).count();
+  }
+
+  /**
+   * @brief Edge-balanced blocks: each one ends at the first row boundary past
+   * `block_bytes` worth of edges from its start.
+   */
+  void partition() {
+    std::size_t edge_bytes =
+        sizeof(index_t) + (values ? sizeof(value_t) : 0);
+    offset_t block_edges = (offset_t)std::max<std::size_t>(
+        1, properties.block_bytes / edge_bytes);
+
+    block_offsets.assign(1, 0);
+    index_t n = number_of_rows;
+    for (index_t v = 0; v < n;) {
+      offset_t target = row_offsets[v] + block_edges;
+      index_t next = (index_t)(std::upper_bound(row_offsets.begin() + v + 1,
+                                                row_offsets.end(), target) -
+                               row_offsets.begin() - 1);
+      v = std::max<index_t>(v + 1, std::min(next, n));
+      block_offsets.push_back(v);
+    }
+    if (n == 0)
+      block_offsets.push_back(0);
+  }
+};  // class external_csr_t
+
+}  // namespace binary
+}  // namespace format
+}  // namespace gunrock
@@ -42,4 +42,8 @@ struct csc_t;
 
 #include <gunrock/formats/coo.hxx>
 #include <gunrock/formats/csc.hxx>
-#include <gunrock/formats/csr.hxx>
\ No newline at end of file
+#include <gunrock/formats/csr.hxx>
+#include <gunrock/formats/from_coo.hxx>
+#include <gunrock/formats/compressed_csr.hxx>
+#include <gunrock/formats/dynamic_csr.hxx>
+#include <gunrock/formats/external_csr.hxx>
\ No newline at end of file
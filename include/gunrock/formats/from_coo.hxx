@@ -0,0 +1,84 @@
+/**
+ * @file from_coo.hxx
+ * @brief Build the CSR and CSC formats of a coordinate list in one pass.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <gunrock/formats/formats.hxx>
+#include <gunrock/formats/detail/from_coo.hxx>
+
+namespace gunrock {
+namespace format {
+
+/**
+ * @brief Build both the CSR and the CSC of `coo` in a single pass over the
+ * coordinate list (shared histogram and scatter passes). Both formats hold
+ * the same (sorted and/or merged) entries, so `nonzero_values` of the CSC are
+ * the values of the CSR permuted into column order.
+ *
+ * @par Example
+ * @code
+ * format::csr_t<memory_space_t::host, int, int, float> csr;
+ * format::csc_t<memory_space_t::host, int, int, float> csc;
+ * format::from_coo(mm.load(filename), csr, csc,
+ *                  format::build_properties_t(true, true),
+ *                  format::reduce::minimum_t());
+ * @endcode
+ *
+ * @param coo coordinate list.
+ * @param csr output CSR.
+ * @param csc output CSC.
+ * @param properties sort and/or merge duplicate entries.
+ * @param op reducer for the values of duplicate entries.
+ */
+template <memory_space_t space,
+          typename index_t,
+          typename offset_t,
+          typename value_t,
+          typename reduce_op_t = reduce::first_t>
+void from_coo(
+    const coo_t<memory_space_t::host, index_t, offset_t, value_t>& coo,
+    csr_t<space, index_t, offset_t, value_t>& csr,
+    csc_t<space, index_t, offset_t, value_t>& csc,
+    build_properties_t properties = build_properties_t(),
+    reduce_op_t op = reduce_op_t()) {
+  csr.number_of_rows = csc.number_of_rows = coo.number_of_rows;
+  csr.number_of_columns = csc.number_of_columns = coo.number_of_columns;
+
+  if constexpr (space == memory_space_t::device) {
+    vector_t<offset_t, memory_space_t::host> _Ap, _Aj;
+    vector_t<index_t, memory_space_t::host> _Ac, _Ar;
+    vector_t<value_t, memory_space_t::host> _Ax, _Ay;
+
+    csr.number_of_nonzeros = detail::from_coo(
+        coo.number_of_rows, coo.number_of_columns, coo.number_of_nonzeros,
+        coo.row_indices.data(), coo.column_indices.data(),
+        coo.nonzero_values.data(), _Ap, _Ac, _Ax, &_Aj, &_Ar, &_Ay, properties,
+        op);
+
+    csr.row_offsets = _Ap;
+    csr.column_indices = _Ac;
+    csr.nonzero_values = _Ax;
+    csc.column_offsets = _Aj;
+    csc.row_indices = _Ar;
+    csc.nonzero_values = _Ay;
+  } else {
+    csr.number_of_nonzeros = detail::from_coo(
+        coo.number_of_rows, coo.number_of_columns, coo.number_of_nonzeros,
+        coo.row_indices.data(), coo.column_indices.data(),
+        coo.nonzero_values.data(), csr.row_offsets, csr.column_indices,
+        csr.nonzero_values, &csc.column_offsets, &csc.row_indices,
+        &csc.nonzero_values, properties, op);
+  }
+
+  csc.number_of_nonzeros = csr.number_of_nonzeros;
+}
+
+}  // namespace format
+}  // namespace gunrock
@@ -9,12 +9,19 @@
  *
  */
 
+#include <chrono>
 #include <vector>
 
+#include <thrust/functional.h>
+#include <thrust/transform_reduce.h>
+
 #include <gunrock/cuda/cuda.hxx>
+#include <gunrock/util/timer.hxx>
+#include <gunrock/util/type_limits.hxx>
 
 #include <gunrock/framework/frontier/frontier.hxx>
 #include <gunrock/framework/problem.hxx>
+#include <gunrock/framework/trace.hxx>
 
 #pragma once
 
@@ -41,6 +48,28 @@ struct enactor_properties_t {
    */
   std::size_t number_of_frontier_buffers{2};
 
+  /*!
+   * Host graphs use hybrid frontiers: a sparse (vector) frontier becomes a
+   * dense (bitmap) frontier when more than this fraction of the vertices
+   * (edges, for edge frontiers) is active. At 1/32, a bitmap of 32-bit items
+   * takes as much memory as the vector it replaces.
+   */
+  float dense_frontier_threshold{1.f / 32};
+
+  /*!
+   * A dense frontier becomes sparse again when less than this fraction of the
+   * vertices (edges) is active. Lower than `dense_frontier_threshold` so that
+   * a frontier around the threshold does not convert every iteration.
+   */
+  float sparse_frontier_threshold{1.f / 64};
+
+  /*!
+   * Opt-in instrumentation: if set, the enactor records its runs, iterations,
+   * operator calls and frontier swaps in this trace (see `trace_t`), which
+   * must outlive the enactor. Off (`nullptr`) by default.
+   */
+  trace_t* trace{nullptr};
+
   /**
    * @brief Construct a new enactor properties t object with default values.
    */
@@ -64,6 +93,10 @@ struct enactor_properties_t {
  * @see loop()
  * @see is_converged()
  *
+ * The frontiers and work segments live in the memory space of the problem's
+ * graph; for host graphs the operators run on the host backend (see
+ * `operators::load_balance_t::host_mapped`), `enact()` is the same.
+ *
  * @tparam algorithm_problem_t algorithm specific problem type.
  * @tparam frontier_kind `gunrock::frontier_kind_t` enum (vertex or
  * edge-based frontier). Currently, only vertex frontier is supported.
@@ -75,10 +108,20 @@ struct enactor_t {
   using vertex_t = typename algorithm_problem_t::vertex_t;
   using edge_t = typename algorithm_problem_t::edge_t;
 
+  static constexpr memory_space_t space =
+      algorithm_problem_t::graph_type::memory_space();
+
+  /*!
+   * Device graphs use vector frontiers, host graphs hybrid (sparse or dense)
+   * frontiers, see `switch_frontier_storage()`.
+   */
   using frontier_type = frontier_t<
       std::conditional_t<frontier_kind == frontier_kind_t::vertex_frontier,
                          vertex_t,
-                         edge_t>>;
+                         edge_t>,
+      (space == memory_space_t::host) ? frontier_storage_t::hybrid
+                                      : frontier_storage_t::vector,
+      space>;
 
   /*!
    * Enactor properties (frontier resizing factor, buffers, etc.)
@@ -108,7 +151,7 @@ struct enactor_t {
    * actually needs it is being run. Otherwise, it maybe a waste of memory space
    * to allocate this.
    */
-  thrust::device_vector<vertex_t> scanned_work_domain;
+  vector_t<vertex_t, space> scanned_work_domain;
 
   /*!
    * Active frontier buffer, this pointer can be obtained by
@@ -173,7 +216,10 @@ struct enactor_t {
 
     for (auto& buffer : frontiers) {
       buffer.set_resizing_factor(properties.frontier_sizing_factor);
-      buffer.reserve((std::size_t)(initial_size));
+      // Host frontiers grow on demand (and turn dense past a threshold),
+      // reserving the edges up front would defeat the purpose.
+      if constexpr (space != memory_space_t::host)
+        buffer.reserve((std::size_t)(initial_size));
     }
   }
 
@@ -203,6 +249,51 @@ struct enactor_t {
     buffer_selector ^= 1;
     active_frontier = &frontiers[buffer_selector];
     inactive_frontier = &frontiers[buffer_selector ^ 1];
+    observe_frontier(active_frontier);
+    if (properties.trace)
+      properties.trace->record_swap(iteration,
+                                    active_frontier->get_number_of_elements());
+  }
+
+  /**
+   * @brief Prepare another `enact()` over the same problem (for example,
+   * after `problem->reset()` for a new source): the frontiers are emptied but
+   * keep their storage, and the iterations restart from 0.
+   */
+  void reset() {
+    for (auto& buffer : frontiers)
+      buffer.clear();
+    buffer_selector = 0;
+    active_frontier = &frontiers[0];
+    inactive_frontier = &frontiers[1];
+    iteration = 0;
+  }
+
+  /**
+   * @brief Convert the input frontier between its sparse and dense
+   * representations, depending on the fraction of the vertices (edges) it
+   * holds. Called by `enact()` after every iteration of host graphs, see
+   * `enactor_properties_t::dense_frontier_threshold` and
+   * `enactor_properties_t::sparse_frontier_threshold`. No-op for frontiers
+   * that are not hybrid.
+   */
+  void switch_frontier_storage() {
+    if constexpr (frontier_type::underlying_storage() ==
+                  frontier_storage_t::hybrid) {
+      auto g = problem->get_graph();
+      std::size_t universe = (frontier_kind == frontier_kind_t::vertex_frontier)
+                                 ? g.get_number_of_vertices()
+                                 : g.get_number_of_edges();
+      float density =
+          (float)active_frontier->get_number_of_elements() / universe;
+
+      if (!active_frontier->is_dense() &&
+          density > properties.dense_frontier_threshold)
+        active_frontier->to_dense(universe);
+      else if (active_frontier->is_dense() &&
+               density < properties.sparse_frontier_threshold)
+        active_frontier->to_sparse();
+    }
   }
 
   /**
@@ -218,16 +309,121 @@ struct enactor_t {
    * **the** time for performance measurements).
    */
   float enact() {
-    auto single_context = context->get_context(0);
-    prepare_frontier(get_input_frontier(), *context);
-    auto timer = single_context->timer();
-    timer.begin();
-    while (!is_converged(*context)) {
-      loop(*context);
-      ++iteration;
+    trace_t* trace = properties.trace;
+    if (trace)
+      trace->begin_run();
+
+    if constexpr (space == memory_space_t::host) {
+      prepare_frontier(get_input_frontier(), *context);
+      observe_frontier(get_input_frontier());
+      util::host_timer_t timer;
+      timer.begin();
+      switch_frontier_storage();
+      while (!is_converged(*context)) {
+        if (trace)
+          trace->begin_iteration(iteration,
+                                 active_frontier->get_number_of_elements());
+        loop(*context);
+        if (trace)
+          trace->end_iteration(active_frontier->get_number_of_elements());
+        ++iteration;
+        switch_frontier_storage();
+      }
+      finalize(*context);
+      float elapsed = timer.end();
+      if (trace)
+        trace->end_run(iteration);
+      return elapsed;
+    } else {
+      auto single_context = context->get_context(0);
+      prepare_frontier(get_input_frontier(), *context);
+      observe_frontier(get_input_frontier());
+      auto timer = single_context->timer();
+      timer.begin();
+      while (!is_converged(*context)) {
+        if (trace) {
+          single_context->synchronize();
+          trace->begin_iteration(iteration,
+                                 active_frontier->get_number_of_elements());
+        }
+        loop(*context);
+        if (trace) {
+          single_context->synchronize();
+          trace->end_iteration(active_frontier->get_number_of_elements());
+        }
+        ++iteration;
+      }
+      finalize(*context);
+      float elapsed = timer.end();
+      if (trace)
+        trace->end_run(iteration);
+      return elapsed;
+    }
+  }
+
+  /**
+   * @brief Trace of the enactor (see `enactor_properties_t::trace`), nullptr
+   * if it is not instrumented.
+   */
+  trace_t* get_trace() { return properties.trace; }
+
+  /**
+   * @brief Record the start of an operator call on the input frontier (used
+   * by the operators' enactor interface when `get_trace()` is set).
+   *
+   * @param name operator name.
+   * @param count_edges count the edges out of the input frontier (advance).
+   * @return std::size_t the record, see `end_operator_trace()`.
+   */
+  std::size_t begin_operator_trace(char const* name, bool count_edges) {
+    std::size_t edges = count_edges ? count_input_edges() : 0;
+    if constexpr (space != memory_space_t::host)
+      context->get_context(0)->synchronize();
+    return properties.trace->begin_operator(
+        name, iteration, active_frontier->get_number_of_elements(), edges);
+  }
+
+  /**
+   * @brief Record the end of an operator call, before the buffers are
+   * swapped.
+   */
+  void end_operator_trace(std::size_t record) {
+    if constexpr (space != memory_space_t::host)
+      context->get_context(0)->synchronize();
+    properties.trace->end_operator(
+        record, inactive_frontier->get_number_of_elements());
+  }
+
+  /**
+   * @brief Edges out of the vertices of the input frontier (0 for edge
+   * frontiers).
+   */
+  std::size_t count_input_edges() {
+    if constexpr (frontier_kind != frontier_kind_t::vertex_frontier) {
+      return 0;
+    } else {
+      auto G = problem->get_graph();
+      auto degree = [G] __host__ __device__(vertex_t const& v) -> std::size_t {
+        return gunrock::util::limits::is_valid(v)
+                   ? (std::size_t)G.get_number_of_neighbors(v)
+                   : 0;
+      };
+
+      if constexpr (frontier_type::underlying_storage() ==
+                    frontier_storage_t::hybrid) {
+        if (active_frontier->is_dense()) {
+          std::size_t edges = 0;
+          auto& dense = active_frontier->get_dense_frontier();
+          dense.for_each(0, dense.get_capacity(),
+                         [&](vertex_t const& v) { edges += degree(v); });
+          return edges;
+        }
+      }
+      return thrust::transform_reduce(
+          problem->get_execution_policy(), active_frontier->begin(),
+          active_frontier->end(), degree, std::size_t(0),
+          thrust::plus<std::size_t>());
     }
-    finalize(*context);
-    return timer.end();
   }
 
   /**
@@ -284,6 +480,16 @@ struct enactor_t {
    */
   virtual void finalize(cuda::multi_context_t& context) {}
 
+  /**
+   * @brief Called with the initial frontier, then with the new input frontier
+   * every time the buffers are swapped (after every operator that swaps
+   * them). Does nothing by default; extend it to see every frontier of a run,
+   * e.g. `gunrock::session_t` records the vertices a query visited.
+   *
+   * @param f the (new) input frontier.
+   */
+  virtual void observe_frontier(frontier_type* f) {}
+
 };  // struct enactor_t
 
 }  // namespace gunrock
\ No newline at end of file
@@ -0,0 +1,232 @@
+/**
+ * @file bitmap_frontier.hxx
+ * @brief Bitmap-based (dense) frontier implementation, one bit per item.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+
+#include <gunrock/container/vector.hxx>
+#include <gunrock/algorithms/sort/radix_sort.hxx>
+#include <gunrock/framework/frontier/configs.hxx>
+#include <gunrock/framework/frontier/detail/compact.hxx>
+
+namespace gunrock {
+namespace frontier {
+using namespace memory;
+
+/**
+ * @brief Dense frontier with one bit per item of the universe (the vertices
+ * or the edges of the graph). Items are unique and ordered by construction.
+ * Insertions are atomic, so operators can write the frontier concurrently.
+ * Host only.
+ *
+ * @note The number of elements is not updated by `insert()` (that would be a
+ * contended counter); writers set it with `popcount()` once done.
+ */
+template <typename type_t, memory_space_t space = memory_space_t::host>
+class bitmap_frontier_t {
+  static_assert(space == memory_space_t::host,
+                "Bitmap frontiers are only supported on the host.");
+
+ public:
+  using word_t = std::uint64_t;
+  static constexpr std::size_t bits_per_word = 64;
+
+  static constexpr memory_space_t memory_space() { return space; }
+  static constexpr frontier_storage_t underlying_storage() {
+    return frontier_storage_t::bitmap;
+  }
+
+  bitmap_frontier_t() : storage(), num_elements(0), universe(0) {}
+  bitmap_frontier_t(std::size_t size) : bitmap_frontier_t() { reserve(size); }
+
+  /**
+   * @brief Get the number of elements within the frontier.
+   * @return std::size_t
+   */
+  std::size_t get_number_of_elements() const { return num_elements; }
+
+  /**
+   * @brief Get the capacity, the size of the universe (largest item + 1).
+   * @return std::size_t
+   */
+  std::size_t get_capacity() const { return universe; }
+
+  std::size_t get_allocated_size_in_bytes() const {
+    return storage.size() * sizeof(word_t);
+  }
+
+  void set_number_of_elements(std::size_t const& elements) {
+    num_elements = elements;
+  }
+
+  bool is_empty() const { return (this->get_number_of_elements() == 0); }
+  bool is_dense() const { return true; }
+
+  word_t* get_bitmap() { return storage.data(); }
+  word_t const* get_bitmap() const { return storage.data(); }
+
+  bool contains(type_t const& item) const {
+    return (storage[item / bits_per_word] >> (item % bits_per_word)) & 1;
+  }
+
+  /**
+   * @brief Atomically insert `item`.
+   * @return true if `item` was not in the frontier.
+   */
+  bool insert(type_t const& item) {
+    word_t mask = word_t(1) << (item % bits_per_word);
+    return !(__atomic_fetch_or(&storage[item / bits_per_word], mask,
+                               __ATOMIC_RELAXED) &
+             mask);
+  }
+
+  /**
+   * @brief Atomically remove `item`.
+   * @return true if `item` was in the frontier.
+   */
+  bool remove(type_t const& item) {
+    word_t mask = word_t(1) << (item % bits_per_word);
+    return __atomic_fetch_and(&storage[item / bits_per_word], ~mask,
+                              __ATOMIC_RELAXED) &
+           mask;
+  }
+
+  /**
+   * @brief (vertex-like) push back a value to the frontier, the universe
+   * grows if needed.
+   */
+  void push_back(type_t const& value) {
+    if ((std::size_t)value >= universe)
+      reserve((std::size_t)value + 1);
+    if (insert(value))
+      num_elements++;
+  }
+
+  /**
+   * @brief Remove all the items, the universe is kept.
+   */
+  void clear() {
+    word_t* words = storage.data();
+    std::int64_t size = storage.size();
+#pragma omp parallel for schedule(static)
+    for (std::int64_t w = 0; w < size; ++w)
+      words[w] = 0;
+    num_elements = 0;
+  }
+
+  /**
+   * @brief Insert the items `[initial_value, initial_value + size)`, the
+   * frontier is cleared first.
+   */
+  void sequence(type_t const initial_value,
+                std::size_t const& size,
+                cuda::stream_t stream = 0) {
+    std::size_t last = (std::size_t)initial_value + size;
+    if (last > universe)
+      reserve(last);
+    clear();
+
+    word_t* words = storage.data();
+#pragma omp parallel for schedule(static)
+    for (std::int64_t w = 0; w < (std::int64_t)storage.size(); ++w) {
+      std::size_t begin = std::max<std::size_t>(w * bits_per_word,
+                                                initial_value);
+      std::size_t end = std::min<std::size_t>((w + 1) * bits_per_word, last);
+      word_t word = 0;
+      for (std::size_t i = begin; i < end; ++i)
+        word |= word_t(1) << (i % bits_per_word);
+      words[w] = word;
+    }
+    num_elements = size;
+  }
+
+  /**
+   * @brief Grow the universe to at least `size` items (new items are not in
+   * the frontier). Never shrinks.
+   */
+  void reserve(std::size_t const& size) {
+    if (size <= universe)
+      return;
+    storage.resize((size + bits_per_word - 1) / bits_per_word, word_t(0));
+    universe = size;
+  }
+
+  /**
+   * @brief Free the storage (the universe becomes empty).
+   */
+  void release() {
+    storage.clear();
+    storage.shrink_to_fit();
+    universe = 0;
+    num_elements = 0;
+  }
+
+  /**
+   * @brief Count the items in the frontier (parallel).
+   */
+  std::size_t popcount() const {
+    word_t const* words = storage.data();
+    std::size_t count = 0;
+#pragma omp parallel for schedule(static) reduction(+ : count)
+    for (std::int64_t w = 0; w < (std::int64_t)storage.size(); ++w)
+      count += __builtin_popcountll(words[w]);
+    return count;
+  }
+
+  /**
+   * @brief Call `op(item)` for every item in `[begin, end)`, in order.
+   * `begin` must be a multiple of 64 (so that concurrent calls on disjoint
+   * ranges touch disjoint words).
+   */
+  template <typename operator_t>
+  void for_each(std::size_t begin, std::size_t end, operator_t op) const {
+    end = std::min(end, universe);
+    word_t const* words = storage.data();
+    for (std::size_t w = begin / bits_per_word; w * bits_per_word < end; ++w)
+      for (word_t word = words[w]; word; word &= word - 1) {
+        std::size_t item = w * bits_per_word + __builtin_ctzll(word);
+        if (item >= end)
+          break;
+        op((type_t)item);
+      }
+  }
+
+  /**
+   * @brief Write the items, in ascending order, to `output` (compaction to a
+   * vector).
+   * @return std::size_t number of items written.
+   */
+  std::size_t compact(type_t* output) const {
+    return detail::compact(*this, output);
+  }
+
+  /**
+   * @brief Items are always ordered, only ascending order is supported.
+   */
+  void sort(sort::order_t order = sort::order_t::ascending,
+            cuda::stream_t stream = 0) {}
+
+  void print() {
+    std::cout << "Frontier = ";
+    for_each(0, universe, [](type_t item) { std::cout << item << " "; });
+    std::cout << std::endl;
+  }
+
+ private:
+  vector_t<word_t, space> storage;
+  std::size_t num_elements;  // number of elements in the frontier.
+  std::size_t universe;      // number of items the bitmap can hold.
+};
+
+}  // namespace frontier
+}  // namespace gunrock
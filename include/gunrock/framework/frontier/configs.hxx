@@ -0,0 +1,37 @@
+/**
+ * @file configs.hxx
+ * @brief Frontier storage and kind options.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+namespace gunrock {
+
+/**
+ * @brief Underlying frontier data structure.
+ *
+ * @par Overview
+ * A vector lists the active items (sparse, may contain duplicates and
+ * invalids); a bitmap (1 bit) or a boolmap (1 byte) has a flag per item of
+ * the graph (dense, host only). A hybrid frontier is a vector or a bitmap,
+ * the enactor switches between the two every iteration depending on the
+ * fraction of the vertices that are active (see `enactor_properties_t`).
+ */
+enum frontier_storage_t {
+  vector,
+  bitmap,
+  boolmap,
+  hybrid
+};  // enum: frontier_storage_t
+
+enum frontier_kind_t {
+  edge_frontier,
+  vertex_frontier
+};  // enum: frontier_kind_t
+
+}  // namespace gunrock
@@ -0,0 +1,66 @@
+/**
+ * @file compact.hxx
+ * @brief Compaction of dense (bitmap, boolmap) frontiers to a vector.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include <omp.h>
+
+#include <gunrock/container/scratch.hxx>
+
+namespace gunrock {
+namespace frontier {
+namespace detail {
+
+/**
+ * @brief Write the items of a dense frontier, in ascending order, to
+ * `output`. The universe is cut into word-aligned blocks; every block is
+ * counted, the counts are scanned, and every block writes its items at its
+ * offset.
+ *
+ * @return std::size_t number of items written.
+ */
+template <typename dense_frontier_t, typename type_t>
+std::size_t compact(dense_frontier_t const& input, type_t* output) {
+  constexpr std::size_t block_size = 1 << 16;  // items, multiple of 64.
+
+  std::size_t universe = input.get_capacity();
+  std::size_t number_of_blocks = (universe + block_size - 1) / block_size;
+  struct offsets_tag_t {};
+  std::size_t* offsets =
+      get_scratch<std::size_t, offsets_tag_t>(number_of_blocks + 1);
+  offsets[0] = 0;
+
+#pragma omp parallel for schedule(dynamic, 1)
+  for (std::int64_t b = 0; b < (std::int64_t)number_of_blocks; ++b) {
+    std::size_t count = 0;
+    input.for_each(b * block_size, (b + 1) * block_size,
+                   [&](type_t const&) { ++count; });
+    offsets[b + 1] = count;
+  }
+
+  for (std::size_t b = 0; b < number_of_blocks; ++b)
+    offsets[b + 1] += offsets[b];
+
+#pragma omp parallel for schedule(dynamic, 1)
+  for (std::int64_t b = 0; b < (std::int64_t)number_of_blocks; ++b) {
+    type_t* position = output + offsets[b];
+    input.for_each(b * block_size, (b + 1) * block_size,
+                   [&](type_t const& item) { *position++ = item; });
+  }
+
+  return offsets[number_of_blocks];
+}
+
+}  // namespace detail
+}  // namespace frontier
+}  // namespace gunrock
@@ -17,7 +17,11 @@
 
 #pragma once
 
+#include <gunrock/framework/frontier/configs.hxx>
 #include <gunrock/framework/frontier/vector_frontier.hxx>
+#include <gunrock/framework/frontier/bitmap_frontier.hxx>
+#include <gunrock/framework/frontier/boolmap_frontier.hxx>
+#include <gunrock/framework/frontier/hybrid_frontier.hxx>
 #include <gunrock/util/type_limits.hxx>
 
 #include <gunrock/graph/graph.hxx>
@@ -28,32 +32,49 @@ namespace gunrock {
 using namespace memory;
 
 // Maybe we use for frontier related function
-namespace frontier {}  // namespace frontier
+namespace frontier {
 
 /**
- * @brief Underlying frontier data structure.
+ * @brief Frontier class implementing `underlying_st` in `space`.
  */
-enum frontier_storage_t {
-  vector,
-  bitmap,
-  boolmap
-};  // enum: frontier_storage_t
-
-enum frontier_kind_t {
-  edge_frontier,
-  vertex_frontier
-};  // enum: frontier_kind_t
+template <typename type_t,
+          frontier_storage_t underlying_st,
+          memory_space_t space>
+using underlying_frontier_t = std::conditional_t<
+    underlying_st == frontier_storage_t::bitmap,
+    bitmap_frontier_t<type_t, space>,
+    std::conditional_t<
+        underlying_st == frontier_storage_t::boolmap,
+        boolmap_frontier_t<type_t, space>,
+        std::conditional_t<underlying_st == frontier_storage_t::hybrid,
+                           hybrid_frontier_t<type_t, space>,
+                           vector_frontier_t<type_t, space>>>>;
+
+}  // namespace frontier
 
+/**
+ * @brief Frontier of vertices or edges.
+ *
+ * @tparam t type of the items (vertex or edge ids).
+ * @tparam underlying_st underlying data structure. `bitmap`, `boolmap` and
+ * `hybrid` are dense (or dense when needed) frontiers of host graphs, they
+ * also expose `is_dense()`, `insert()`, `popcount()`, `for_each()`, etc. (see
+ * the respective classes).
+ * @tparam space memory space of the storage, must match the memory space of
+ * the graph the frontier is used with (`graph_t::memory_space()`).
+ */
 template <typename t,
-          frontier_storage_t underlying_st = frontier_storage_t::vector>
-class frontier_t : public frontier::vector_frontier_t<t> {
+          frontier_storage_t underlying_st = frontier_storage_t::vector,
+          memory_space_t space = memory_space_t::device>
+class frontier_t
+    : public frontier::underlying_frontier_t<t, underlying_st, space> {
  public:
   using type_t = t;
   using pointer_t = type_t*;
-  using frontier_type_t = frontier_t<type_t>;
+  using frontier_type_t = frontier_t<type_t, underlying_st, space>;
 
-  // We can use std::conditional to figure out what type to use.
-  using underlying_frontier_t = frontier::vector_frontier_t<type_t>;
+  using underlying_frontier_t =
+      frontier::underlying_frontier_t<type_t, underlying_st, space>;
 
   // <todo> revisit frontier constructors/destructor
   frontier_t()
@@ -79,6 +100,15 @@ class frontier_t : public frontier::vector_frontier_t<t> {
     return this->get_number_of_elements() * sizeof(type_t);
   }
 
+  /**
+   * @brief Get the memory held by the frontier's storage (capacity of a
+   * vector, universe of a bitmap or boolmap).
+   * @return std::size_t
+   */
+  std::size_t get_allocated_size_in_bytes() const {
+    return underlying_frontier_t::get_allocated_size_in_bytes();
+  }
+
   /**
    * @brief Get the number of elements within the frontier.
    * @return std::size_t
@@ -202,11 +232,23 @@ class frontier_t : public frontier::vector_frontier_t<t> {
    * report the actual size, not reserved size. See std::vector for more detail.
    *
    * @param size size to reserve (size is in count not bytes).
+   *
+   * @note Dense frontiers reserve exactly `size`, the size of their
+   * universe, a resizing factor would only waste memory.
    */
   void reserve(std::size_t const& size) {
-    underlying_frontier_t::reserve(size * resizing_factor);
+    if (this->is_dense())
+      underlying_frontier_t::reserve(size);
+    else
+      underlying_frontier_t::reserve(size * resizing_factor);
   }
 
+  /**
+   * @brief Remove all the items, the storage is kept (see the underlying
+   * frontiers).
+   */
+  void clear() { underlying_frontier_t::clear(); }
+
   /**
    * @brief Parallel sort the frontier.
    *
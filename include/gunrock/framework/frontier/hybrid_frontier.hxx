@@ -0,0 +1,235 @@
+/**
+ * @file hybrid_frontier.hxx
+ * @brief Hybrid frontier: a sparse (vector) or a dense (bitmap)
+ * representation, converted from one to the other on demand.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/framework/frontier/configs.hxx>
+#include <gunrock/framework/frontier/vector_frontier.hxx>
+#include <gunrock/framework/frontier/bitmap_frontier.hxx>
+
+namespace gunrock {
+namespace frontier {
+using namespace memory;
+
+/**
+ * @brief Frontier that is either a vector of items (sparse) or a bitmap over
+ * the universe (dense); only the active representation holds memory, unless
+ * `set_storage_retention()` asks to keep both (for reuse). The
+ * enactor converts it every iteration depending on its density (see
+ * `enactor_properties_t`), the operators check `is_dense()` and work on the
+ * matching representation. Host only.
+ *
+ * @par Overview
+ * A sparse frontier costs `sizeof(type_t)` bytes per active item, a dense
+ * frontier 1 bit per item of the universe: above ~1/32 of the universe
+ * active (for 32-bit items), the bitmap is the smaller of the two, and the
+ * operators writing it need no per-thread buffers, no sort and no
+ * uniquification (items are unique by construction).
+ */
+template <typename type_t, memory_space_t space = memory_space_t::host>
+class hybrid_frontier_t {
+  static_assert(space == memory_space_t::host,
+                "Hybrid frontiers are only supported on the host.");
+
+ public:
+  using pointer_t = type_t*;
+  using sparse_frontier_t = vector_frontier_t<type_t, space>;
+  using dense_frontier_t = bitmap_frontier_t<type_t, space>;
+
+  static constexpr memory_space_t memory_space() { return space; }
+  static constexpr frontier_storage_t underlying_storage() {
+    return frontier_storage_t::hybrid;
+  }
+
+  hybrid_frontier_t()
+      : sparse(), dense(), dense_mode(false), retain_storage(false) {}
+  hybrid_frontier_t(std::size_t size)
+      : sparse(size), dense(), dense_mode(false), retain_storage(false) {}
+
+  /**
+   * @brief Is the dense (bitmap) representation the active one?
+   */
+  bool is_dense() const { return dense_mode; }
+
+  /**
+   * @brief Keep the storage of the inactive representation when converting
+   * (`to_dense()`, `to_sparse()`, `match_representation()`, `clear()`)
+   * instead of freeing it. Costs the memory of both representations, but a
+   * frontier reused many times (see `gunrock::session_t`) stops allocating
+   * once both have reached their largest size.
+   */
+  void set_storage_retention(bool retain) { retain_storage = retain; }
+
+  sparse_frontier_t& get_sparse_frontier() { return sparse; }
+  dense_frontier_t& get_dense_frontier() { return dense; }
+
+  std::size_t get_number_of_elements() const {
+    return dense_mode ? dense.get_number_of_elements()
+                      : sparse.get_number_of_elements();
+  }
+
+  std::size_t get_capacity() const {
+    return dense_mode ? dense.get_capacity() : sparse.get_capacity();
+  }
+
+  std::size_t get_allocated_size_in_bytes() const {
+    return sparse.get_allocated_size_in_bytes() +
+           dense.get_allocated_size_in_bytes();
+  }
+
+  void set_number_of_elements(std::size_t const& elements) {
+    if (dense_mode)
+      dense.set_number_of_elements(elements);
+    else
+      sparse.set_number_of_elements(elements);
+  }
+
+  /**
+   * @brief Items of the sparse representation, only valid if
+   * `!is_dense()`.
+   */
+  pointer_t data() { return sparse.data(); }
+  pointer_t begin() { return sparse.begin(); }
+  pointer_t end() { return sparse.end(); }
+  bool is_empty() const { return (this->get_number_of_elements() == 0); }
+
+  void push_back(type_t const& value) {
+    if (dense_mode)
+      dense.push_back(value);
+    else
+      sparse.push_back(value);
+  }
+
+  /**
+   * @brief Fill the sparse representation with a value, no-op if dense.
+   */
+  void fill(type_t const value, cuda::stream_t stream = 0) {
+    if (!dense_mode)
+      sparse.fill(value, stream);
+  }
+
+  void sequence(type_t const initial_value,
+                std::size_t const& size,
+                cuda::stream_t stream = 0) {
+    if (dense_mode)
+      dense.sequence(initial_value, size, stream);
+    else
+      sparse.sequence(initial_value, size, stream);
+  }
+
+  void reserve(std::size_t const& size) {
+    if (dense_mode)
+      dense.reserve(size);
+    else
+      sparse.reserve(size);
+  }
+
+  void release() {
+    sparse.release();
+    dense.release();
+  }
+
+  /**
+   * @brief Remove all the items, the frontier becomes sparse.
+   */
+  void clear() {
+    if (dense_mode && !retain_storage)
+      dense.release();
+    dense_mode = false;
+    sparse.clear();
+  }
+
+  void sort(sort::order_t order = sort::order_t::ascending,
+            cuda::stream_t stream = 0) {
+    if (!dense_mode)
+      sparse.sort(order, stream);
+  }
+
+  /**
+   * @brief Convert to the dense representation over `[0, universe)`. The
+   * valid items of the vector are inserted in the bitmap (duplicates
+   * collapse), the vector is freed (unless retained).
+   */
+  void to_dense(std::size_t universe) {
+    if (dense_mode)
+      return;
+    dense.reserve(universe);
+    dense.clear();
+
+    auto items = sparse.data();
+    std::int64_t size = sparse.get_number_of_elements();
+#pragma omp parallel for schedule(static)
+    for (std::int64_t i = 0; i < size; ++i)
+      if (gunrock::util::limits::is_valid(items[i]))
+        dense.insert(items[i]);
+
+    dense.set_number_of_elements(dense.popcount());
+    if (!retain_storage)
+      sparse.release();
+    dense_mode = true;
+  }
+
+  /**
+   * @brief Convert to the sparse representation, the bitmap is compacted
+   * (in ascending order) to the vector and freed (unless retained).
+   */
+  void to_sparse() {
+    if (!dense_mode)
+      return;
+    std::size_t size = dense.get_number_of_elements();
+    sparse.reserve(size);
+    sparse.set_number_of_elements(dense.compact(sparse.data()));
+    if (!retain_storage)
+      dense.release();
+    dense_mode = false;
+  }
+
+  /**
+   * @brief Switch to the representation of `other` (used by the operators on
+   * their output frontier), dropping the content of this frontier. A dense
+   * frontier spans `[0, universe)`.
+   */
+  void match_representation(hybrid_frontier_t const& other,
+                            std::size_t universe) {
+    if (&other == this)
+      return;
+    if (other.is_dense() && !dense_mode) {
+      if (!retain_storage)
+        sparse.release();
+      dense.reserve(universe);
+      dense_mode = true;
+    } else if (!other.is_dense() && dense_mode) {
+      if (!retain_storage)
+        dense.release();
+      dense_mode = false;
+    }
+    set_number_of_elements(0);
+  }
+
+  void print() {
+    if (dense_mode)
+      dense.print();
+    else
+      sparse.print();
+  }
+
+ private:
+  sparse_frontier_t sparse;  // vector of items.
+  dense_frontier_t dense;    // bitmap over the universe.
+  bool dense_mode;           // which of the two holds the frontier.
+  bool retain_storage;       // keep the inactive representation's storage.
+};
+
+}  // namespace frontier
+}  // namespace gunrock
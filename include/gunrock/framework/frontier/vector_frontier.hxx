@@ -11,20 +11,33 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include <gunrock/util/type_limits.hxx>
 #include <gunrock/container/vector.hxx>
 #include <gunrock/algorithms/sort/radix_sort.hxx>
+#include <gunrock/algorithms/sort/host.hxx>
+#include <gunrock/framework/frontier/configs.hxx>
 #include <thrust/sequence.h>
 
 namespace gunrock {
 namespace frontier {
 using namespace memory;
 
-template <typename type_t>
+/**
+ * @brief Frontier stored as a vector of items in `space` (device memory for
+ * device graphs, host memory for host graphs).
+ */
+template <typename type_t, memory_space_t space = memory_space_t::device>
 class vector_frontier_t {
  public:
   using pointer_t = type_t*;
 
+  static constexpr memory_space_t memory_space() { return space; }
+  static constexpr frontier_storage_t underlying_storage() {
+    return frontier_storage_t::vector;
+  }
+
   vector_frontier_t() : storage(), num_elements(0) {}
   vector_frontier_t(std::size_t size) : storage(size), num_elements(size) {}
 
@@ -40,6 +53,10 @@ class vector_frontier_t {
    */
   std::size_t get_capacity() const { return storage.capacity(); }
 
+  std::size_t get_allocated_size_in_bytes() const {
+    return storage.capacity() * sizeof(type_t);
+  }
+
   /**
    * @brief Set how many number of elements the frontier contains. Note, this is
    * manually managed right now, we can look for better and cleaner options
@@ -56,6 +73,7 @@ class vector_frontier_t {
   pointer_t begin() { return this->data(); }
   pointer_t end() { return this->begin() + this->get_number_of_elements(); }
   bool is_empty() const { return (this->get_number_of_elements() == 0); }
+  bool is_dense() const { return false; }
 
   /**
    * @brief (vertex-like) push back a value to the frontier.
@@ -74,8 +92,11 @@ class vector_frontier_t {
    * @param stream
    */
   void fill(type_t const value, cuda::stream_t stream = 0) {
-    thrust::fill(thrust::cuda::par.on(stream), this->begin(), this->end(),
-                 value);
+    if constexpr (space == memory_space_t::host)
+      std::fill(this->begin(), this->end(), value);
+    else
+      thrust::fill(thrust::cuda::par.on(stream), this->begin(), this->end(),
+                   value);
   }
 
   /**
@@ -91,8 +112,12 @@ class vector_frontier_t {
   void sequence(type_t const initial_value,
                 std::size_t const& size,
                 cuda::stream_t stream = 0) {
-    thrust::sequence(thrust::cuda::par.on(stream), this->begin(), this->end(),
-                     initial_value);
+    if constexpr (space == memory_space_t::host)
+      thrust::sequence(thrust::host, this->begin(), this->end(),
+                       initial_value);
+    else
+      thrust::sequence(thrust::cuda::par.on(stream), this->begin(),
+                       this->end(), initial_value);
   }
 
   /**
@@ -119,6 +144,23 @@ class vector_frontier_t {
    */
   void reserve(std::size_t const& size) { storage.reserve(size); }
 
+  /**
+   * @brief Remove all the items, the capacity is kept.
+   */
+  void clear() {
+    storage.clear();
+    num_elements = 0;
+  }
+
+  /**
+   * @brief Free the storage (capacity becomes 0).
+   */
+  void release() {
+    storage.clear();
+    storage.shrink_to_fit();
+    num_elements = 0;
+  }
+
   /**
    * @brief Parallel sort the frontier.
    *
@@ -127,8 +169,12 @@ class vector_frontier_t {
    */
   void sort(sort::order_t order = sort::order_t::ascending,
             cuda::stream_t stream = 0) {
-    sort::radix::sort_keys(storage.data().get(), this->get_number_of_elements(),
-                           order, stream);
+    if constexpr (space == memory_space_t::host)
+      sort::host::sort_keys(this->data(), this->get_number_of_elements(),
+                            order);
+    else
+      sort::radix::sort_keys(this->data(), this->get_number_of_elements(),
+                             order, stream);
   }
 
   void print() {
@@ -140,7 +186,7 @@ class vector_frontier_t {
   }
 
  private:
-  vector_t<type_t, memory_space_t::device> storage;
+  vector_t<type_t, space> storage;
   std::size_t num_elements;  // number of elements in the frontier.
 };
 
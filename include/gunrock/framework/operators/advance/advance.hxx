@@ -21,6 +21,7 @@
 #include <gunrock/framework/operators/advance/merge_path.hxx>
 #include <gunrock/framework/operators/advance/thread_mapped.hxx>
 #include <gunrock/framework/operators/advance/block_mapped.hxx>
+#include <gunrock/framework/operators/advance/host_mapped.hxx>
 
 namespace gunrock {
 namespace operators {
@@ -83,6 +84,10 @@ namespace advance {
  * @param segments storaged space for scanned items (segment offsets).
  * @param context a `cuda::multi_context_t` that contains GPU contexts for the
  * available CUDA devices. Used to launch the advance kernels.
+ *
+ * @note Host graphs (`graph_t::memory_space() == memory_space_t::host`) always
+ * run on the host backend, `load_balance_t::host_mapped`, whatever `lb` is;
+ * the device load-balancing techniques need device memory.
  */
 template <advance_type_t type,
           advance_direction_t direction,
@@ -97,7 +102,12 @@ void execute(graph_t& G,
              frontier_t* output,
              work_tiles_t& segments,
              cuda::multi_context_t& context) {
-  if (context.size() == 1) {
+  if constexpr (graph_t::memory_space() == memory_space_t::host) {
+    host_mapped::execute<type, direction>(G, op, input, output, segments);
+  } else if (lb == load_balance_t::host_mapped) {
+    error::throw_if_exception(cudaErrorUnknown,
+                              "`host_mapped` advance requires a host graph.");
+  } else if (context.size() == 1) {
     auto context0 = context.get_context(0);
 
     // std::cout << "[ADV] Input:: ";
@@ -196,6 +206,11 @@ void execute(graph_t& G,
              operator_type op,
              cuda::multi_context_t& context,
              bool swap_buffers = true) {
+  // Opt-in instrumentation (see `enactor_properties_t::trace`).
+  std::size_t record = 0;
+  if (E->get_trace())
+    record = E->begin_operator_trace("advance", true);
+
   execute<type, direction, lb>(G,                         // graph
                                op,                        // advance operator
                                E->get_input_frontier(),   // input frontier
@@ -204,6 +219,9 @@ void execute(graph_t& G,
                                context                    // gpu context
   );
 
+  if (E->get_trace())
+    E->end_operator_trace(record);
+
   /*!
    * @note if the Enactor interface is used, we, the library writers assume
    * control of the frontiers and swap the input/output buffers as needed,
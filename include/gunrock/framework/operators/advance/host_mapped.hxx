@@ -0,0 +1,288 @@
+/**
+ * @file host_mapped.hxx
+ * @brief Advance on the host (OpenMP): the edges of the input frontier are
+ * split in equal chunks that are scheduled over a work-stealing pool.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/error.hxx>
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/algorithms/scan/host.hxx>
+
+#include <gunrock/framework/frontier/configs.hxx>
+#include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/operators/detail/work_stealing.hxx>
+
+namespace gunrock {
+namespace operators {
+namespace advance {
+namespace host_mapped {
+
+/**
+ * @brief Host advance of a sparse (vector) frontier. The degrees of the input
+ * frontier are scanned into `segments`, the resulting edge space `[0, total)`
+ * is cut into equal chunks, and every chunk finds its first input vertex with a
+ * binary search. This balances the work regardless of the degree distribution
+ * (a hub's adjacency is split among many chunks). Neighbors for which `op`
+ * returns true are appended to a per-thread buffer, the buffers are
+ * concatenated into the output frontier.
+ *
+ * Items are vertices or edges as `type` says: an input edge is a segment of
+ * one edge (from its source vertex), an output frontier of edges gets the
+ * edges that passed `op` instead of their destinations.
+ *
+ * @note Unlike the device advance, the output frontier only contains the
+ * neighbors that passed `op` (no invalid placeholders).
+ */
+template <advance_type_t type,
+          typename graph_t,
+          typename operator_t,
+          typename frontier_t,
+          typename work_tiles_t>
+void execute_sparse(graph_t& G,
+                    operator_t op,
+                    frontier_t* input,
+                    frontier_t* output,
+                    work_tiles_t& segments) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+  using offset_t = typename work_tiles_t::value_type;
+
+  constexpr bool edge_input = (type == advance_type_t::edge_to_edge ||
+                               type == advance_type_t::edge_to_vertex);
+  constexpr bool edge_output = (type == advance_type_t::vertex_to_edge ||
+                                type == advance_type_t::edge_to_edge);
+
+  // Edges per chunk: enough chunks per thread to steal from, but large
+  // enough to amortize the binary search and the scheduling.
+  constexpr std::size_t minimum_chunk_size = 1 << 11;
+  constexpr std::size_t chunks_per_thread = 16;
+
+  std::size_t total_elems = input->get_number_of_elements();
+  if (segments.size() < total_elems + 1)
+    segments.resize(total_elems + 1);
+
+  auto input_data = input->data();
+  offset_t* offsets = memory::raw_pointer_cast(segments.data());
+
+#pragma omp parallel for schedule(static)
+  for (std::int64_t i = 0; i < (std::int64_t)total_elems; ++i) {
+    auto item = input_data[i];
+    // if item is invalid, segment size is 0.
+    if (!gunrock::util::limits::is_valid(item))
+      offsets[i] = (offset_t)0;
+    else if constexpr (edge_input)
+      offsets[i] = (offset_t)1;
+    else
+      offsets[i] = (offset_t)G.get_number_of_neighbors(item);
+  }
+
+  std::size_t total_edges = (std::size_t)algo::scan::host::exclusive_scan(
+      offsets, total_elems, offsets, (offset_t)0);
+  offsets[total_elems] = (offset_t)total_edges;
+
+  // If output frontier is empty, resize and return.
+  if (total_edges == 0) {
+    output->set_number_of_elements(0);
+    return;
+  }
+
+  int threads = omp_get_max_threads();
+  std::size_t chunk_size = std::max(
+      minimum_chunk_size, total_edges / (threads * chunks_per_thread) + 1);
+  std::size_t number_of_chunks = (total_edges + chunk_size - 1) / chunk_size;
+
+  auto& buffers = detail::get_thread_buffers<vertex_t>();
+
+  detail::for_each_chunk(number_of_chunks, [&](std::size_t chunk, int t) {
+    auto& local = buffers[t];
+    std::size_t begin = chunk * chunk_size;
+    std::size_t end = std::min(begin + chunk_size, total_edges);
+
+    // First input item whose segment contains `begin`.
+    std::size_t i =
+        std::upper_bound(offsets, offsets + total_elems + 1, (offset_t)begin) -
+        offsets - 1;
+
+    for (; i < total_elems && (std::size_t)offsets[i] < end; ++i) {
+      std::size_t first = std::max<std::size_t>(begin, offsets[i]);
+      std::size_t last = std::min<std::size_t>(end, offsets[i + 1]);
+      if (first >= last)
+        continue;
+
+      auto item = input_data[i];
+      vertex_t v;
+      edge_t start_edge;
+      if constexpr (edge_input) {
+        start_edge = (edge_t)item;
+        v = G.get_source_vertex(start_edge);
+      } else {
+        v = (vertex_t)item;
+        start_edge = G.get_starting_edge(v);
+      }
+      for (std::size_t rank = first - offsets[i]; rank < last - offsets[i];
+           ++rank) {
+        auto e = start_edge + (edge_t)rank;
+        auto n = G.get_destination_vertex(e);
+        auto w = G.get_edge_weight(e);
+        if (!op(v, n, e, w))
+          continue;
+        if constexpr (edge_output)
+          local.push_back((vertex_t)e);
+        else
+          local.push_back(n);
+      }
+    }
+  });
+
+  detail::gather(buffers, output);
+}
+
+/**
+ * @brief Number of items a dense output frontier of an advance of `type`
+ * spans: the edges of `G` for edge outputs, its vertices otherwise.
+ */
+template <advance_type_t type, typename graph_t>
+std::size_t get_output_universe(graph_t& G) {
+  if constexpr (type == advance_type_t::vertex_to_edge ||
+                type == advance_type_t::edge_to_edge)
+    return G.get_number_of_edges();
+  else
+    return G.get_number_of_vertices();
+}
+
+/**
+ * @brief Host advance of a dense (bitmap, boolmap) frontier into a dense
+ * frontier. The universe of the input is cut into word-aligned blocks of
+ * items scheduled over the work-stealing pool, neighbors for which `op`
+ * returns true are inserted (atomically) in the output: no buffers, no gather
+ * and no duplicates. The output is counted once at the end.
+ *
+ * Items are vertices or edges as `type` says: an input edge expands to
+ * itself (from its source vertex), an output frontier of edges gets the
+ * edges that passed `op` and spans the edges of `G` (see
+ * `get_output_universe()`).
+ */
+template <advance_type_t type,
+          typename graph_t,
+          typename operator_t,
+          typename input_frontier_t,
+          typename output_frontier_t>
+void execute_dense(graph_t& G,
+                   operator_t op,
+                   input_frontier_t* input,
+                   output_frontier_t* output) {
+  using vertex_t = typename graph_t::vertex_type;
+  using edge_t = typename graph_t::edge_type;
+
+  constexpr bool edge_input = (type == advance_type_t::edge_to_edge ||
+                               type == advance_type_t::edge_to_vertex);
+  constexpr bool edge_output = (type == advance_type_t::vertex_to_edge ||
+                                type == advance_type_t::edge_to_edge);
+  constexpr std::size_t block_size = 1 << 12;  // items, multiple of 64.
+
+  output->reserve(get_output_universe<type>(G));
+  output->clear();
+
+  auto expand = [&](vertex_t const& v, edge_t begin, edge_t end) {
+    for (edge_t e = begin; e < end; ++e) {
+      auto n = G.get_destination_vertex(e);
+      auto w = G.get_edge_weight(e);
+      if (!op(v, n, e, w))
+        continue;
+      if constexpr (edge_output)
+        output->insert(e);
+      else
+        output->insert(n);
+    }
+  };
+
+  std::size_t universe = input->get_capacity();
+  detail::for_each_chunk(
+      (universe + block_size - 1) / block_size, [&](std::size_t block, int) {
+        input->for_each(block * block_size, (block + 1) * block_size,
+                        [&](auto const& item) {
+                          if constexpr (edge_input) {
+                            edge_t e = (edge_t)item;
+                            expand(G.get_source_vertex(e), e, e + 1);
+                          } else {
+                            vertex_t v = (vertex_t)item;
+                            edge_t start = G.get_starting_edge(v);
+                            expand(v, start,
+                                   start + G.get_number_of_neighbors(v));
+                          }
+                        });
+      });
+
+  output->set_number_of_elements(output->popcount());
+}
+
+/**
+ * @brief Host advance, dispatches on the storage of the frontiers. A hybrid
+ * output frontier takes the representation of the input (the enactor
+ * converts the input between iterations, see `enactor_properties_t`).
+ */
+template <advance_type_t type,
+          typename graph_t,
+          typename operator_t,
+          typename frontier_t,
+          typename work_tiles_t>
+void execute(graph_t& G,
+             operator_t op,
+             frontier_t* input,
+             frontier_t* output,
+             work_tiles_t& segments) {
+  if constexpr (frontier_t::underlying_storage() ==
+                frontier_storage_t::hybrid) {
+    output->match_representation(*input, get_output_universe<type>(G));
+    if (input->is_dense())
+      execute_dense<type>(G, op, &input->get_dense_frontier(),
+                          &output->get_dense_frontier());
+    else
+      execute_sparse<type>(G, op, &input->get_sparse_frontier(),
+                           &output->get_sparse_frontier(), segments);
+  } else if constexpr (frontier_t::underlying_storage() ==
+                       frontier_storage_t::vector) {
+    execute_sparse<type>(G, op, input, output, segments);
+  } else {
+    execute_dense<type>(G, op, input, output);
+  }
+}
+
+template <advance_type_t type,
+          advance_direction_t direction,
+          typename graph_t,
+          typename operator_t,
+          typename frontier_t,
+          typename work_tiles_t>
+void execute(graph_t& G,
+             operator_t op,
+             frontier_t* input,
+             frontier_t* output,
+             work_tiles_t& segments) {
+  if ((direction == advance_direction_t::forward) ||
+      direction == advance_direction_t::backward) {
+    execute<type>(G, op, input, output, segments);
+  } else {
+    error::throw_if_exception(
+        cudaErrorUnknown,
+        "Direction-optimized advance is not supported on the host.");
+  }
+}
+
+}  // namespace host_mapped
+}  // namespace advance
+}  // namespace operators
+}  // namespace gunrock
@@ -35,6 +35,8 @@ enum load_balance_t {
   bucketing,      /// Davidson et al. (SSSP)
   merge_path,     /// Merrill & Garland (SpMV)
   work_stealing,  /// <cite>
+  host_mapped     /// Edge-balanced chunks on host threads (work-stealing),
+                  /// used for all host graphs (`memory_space_t::host`).
 };
 
 /**
@@ -0,0 +1,158 @@
+/**
+ * @file work_stealing.hxx
+ * @brief Work-stealing chunk scheduler and per-thread output buffers used by
+ * the host (OpenMP) backend of the operators.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/container/scratch.hxx>
+
+namespace gunrock {
+namespace operators {
+namespace detail {
+
+/**
+ * @brief Run `op(chunk, thread)` for every chunk in `[0, number_of_chunks)`
+ * on the host threads.
+ *
+ * @par Overview
+ * Every thread owns a contiguous range of chunks and takes them from the
+ * front, one at a time. A thread that runs out of work steals from the
+ * ranges of the other threads (round-robin, starting at its neighbor), so a
+ * few expensive chunks (e.g. around a high-degree vertex) do not hold up the
+ * rest of the threads. The owner keeps its locality as long as nobody steals
+ * from it.
+ *
+ * @param number_of_chunks number of chunks.
+ * @param op `void(std::size_t chunk, int thread)`, `thread` is in
+ * `[0, omp_get_max_threads())` and may index per-thread storage.
+ */
+template <typename operator_t>
+void for_each_chunk(std::size_t number_of_chunks, operator_t op) {
+  if (number_of_chunks == 0)
+    return;
+
+  struct alignas(64) range_t {
+    std::atomic<std::size_t> next;
+    std::size_t end;
+  };
+
+  // The ranges are kept across calls, one set per nesting level of the
+  // calling thread: an `op` that calls for_each_chunk() again gets a set of
+  // its own rather than overwriting the ranges of the enclosing call.
+  struct level_t {
+    std::unique_ptr<range_t[]> ranges;
+    int size{0};
+  };
+  thread_local std::vector<level_t> levels;
+  thread_local std::size_t depth = 0;
+
+  int threads = (int)std::min<std::size_t>(omp_get_max_threads(),
+                                           number_of_chunks);
+  if (levels.size() <= depth)
+    levels.resize(depth + 1);
+  level_t& level = levels[depth];
+  if (level.size < threads) {
+    level.ranges.reset(new range_t[threads]);
+    level.size = threads;
+    get_scratch_allocations()++;
+  }
+
+  range_t* ranges = level.ranges.get();
+  for (int t = 0; t < threads; ++t) {
+    ranges[t].next.store((number_of_chunks * t) / threads,
+                         std::memory_order_relaxed);
+    ranges[t].end = (number_of_chunks * (t + 1)) / threads;
+  }
+
+  ++depth;
+#pragma omp parallel num_threads(threads)
+  {
+    int t = omp_get_thread_num();
+    // Own range first (k = 0), then steal. Also covers the ranges of threads
+    // the runtime did not start.
+    for (int k = 0; k < threads; ++k) {
+      auto& range = ranges[(t + k) % threads];
+      for (std::size_t chunk;
+           (chunk = range.next.fetch_add(1, std::memory_order_relaxed)) <
+           range.end;)
+        op(chunk, t);
+    }
+  }
+  --depth;
+}
+
+/**
+ * @brief Capacities of the per-thread output buffers of type `type_t` when
+ * they were last handed out (see `get_thread_buffers()` and `gather()`).
+ */
+template <typename type_t>
+std::vector<std::size_t>& get_thread_buffer_capacities() {
+  thread_local std::vector<std::size_t> capacities;
+  return capacities;
+}
+
+/**
+ * @brief Per-thread output buffers, one per host thread, emptied. They are
+ * reused by the next call on the calling thread (see `get_scratch()`), so
+ * their capacity carries over from one operator call to the next; `gather()`
+ * counts the buffers that grew in `get_scratch_allocations()`.
+ */
+template <typename type_t>
+std::vector<std::vector<type_t>>& get_thread_buffers() {
+  thread_local std::vector<std::vector<type_t>> buffers;
+  buffers.resize(omp_get_max_threads());
+  auto& capacities = get_thread_buffer_capacities<type_t>();
+  capacities.resize(buffers.size());
+  for (std::size_t t = 0; t < buffers.size(); ++t) {
+    buffers[t].clear();
+    capacities[t] = buffers[t].capacity();
+  }
+  return buffers;
+}
+
+/**
+ * @brief Concatenate the per-thread `buffers` (in thread order) into the
+ * `output` frontier; the offsets are the prefix sum of the buffer sizes.
+ */
+template <typename type_t, typename frontier_t>
+void gather(std::vector<std::vector<type_t>>& buffers, frontier_t* output) {
+  struct offsets_tag_t {};
+  std::size_t* offsets =
+      get_scratch<std::size_t, offsets_tag_t>(buffers.size() + 1);
+  auto& capacities = get_thread_buffer_capacities<type_t>();
+  offsets[0] = 0;
+  for (std::size_t t = 0; t < buffers.size(); ++t) {
+    offsets[t + 1] = offsets[t] + buffers[t].size();
+    if (buffers[t].capacity() > capacities[t])
+      get_scratch_allocations()++;
+  }
+
+  std::size_t size = offsets[buffers.size()];
+  if (output->get_capacity() < size)
+    output->reserve(size);
+  output->set_number_of_elements(size);
+
+  auto output_data = output->data();
+#pragma omp parallel for schedule(static)
+  for (std::size_t t = 0; t < buffers.size(); ++t)
+    std::copy(buffers[t].begin(), buffers[t].end(), output_data + offsets[t]);
+}
+
+}  // namespace detail
+}  // namespace operators
+}  // namespace gunrock
@@ -9,6 +9,7 @@
 #include <gunrock/framework/operators/filter/predicated.hxx>
 #include <gunrock/framework/operators/filter/bypass.hxx>
 #include <gunrock/framework/operators/filter/remove.hxx>
+#include <gunrock/framework/operators/filter/host_mapped.hxx>
 
 #include <gunrock/framework/operators/uniquify/uniquify.hxx>
 
@@ -26,7 +27,14 @@ void execute(graph_t& G,
              frontier_t* output,
              cuda::multi_context_t& context,
              bool filter_and_uniquify = true) {
-  if (context.size() == 1) {
+  // Host graphs run every filter algorithm on the host backend.
+  if constexpr (graph_t::memory_space() == memory_space_t::host) {
+    host_mapped::execute<type>(G, op, input, output);
+
+    if (filter_and_uniquify)
+      operators::uniquify::execute<uniquify_algorithm_t::unique>(output, input,
+                                                                 context);
+  } else if (context.size() == 1) {
     auto single_context = context.get_context(0);
 
     if (type == filter_algorithm_t::compact) {
@@ -71,6 +79,11 @@ void execute(graph_t& G,
              cuda::multi_context_t& context,
              bool filter_and_uniquify = true,
              bool swap_buffers = true) {
+  // Opt-in instrumentation (see `enactor_properties_t::trace`).
+  std::size_t record = 0;
+  if (E->get_trace())
+    record = E->begin_operator_trace("filter", false);
+
   execute<type>(G,                         // graph
                 op,                        // operator_t
                 E->get_input_frontier(),   // input frontier
@@ -79,6 +92,9 @@ void execute(graph_t& G,
                 filter_and_uniquify        // flag to deduplicate
   );
 
+  if (E->get_trace())
+    E->end_operator_trace(record);
+
   /*!
    * @note if the Enactor interface is used, we, the library writers assume
    * control of the frontiers and swap the input/output buffers as needed,
@@ -0,0 +1,161 @@
+/**
+ * @file host_mapped.hxx
+ * @brief Filter on the host (OpenMP), for all the filter algorithms.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/util/type_limits.hxx>
+
+#include <gunrock/framework/frontier/configs.hxx>
+#include <gunrock/framework/operators/configs.hxx>
+#include <gunrock/framework/operators/detail/work_stealing.hxx>
+
+namespace gunrock {
+namespace operators {
+namespace filter {
+namespace host_mapped {
+
+/**
+ * @brief Host filter of a sparse (vector) frontier. `bypass` marks the items
+ * that fail `op` as invalid in place of removing them. The other algorithms
+ * (`compact`, `predicated`, `remove`) all keep the valid items for which `op`
+ * returns true; the input is cut into chunks scheduled over a work-stealing
+ * pool (`op` may be expensive, e.g. a scan of the vertex's neighbors), kept
+ * items go to per-thread buffers that are concatenated into the output
+ * frontier.
+ */
+template <filter_algorithm_t type,
+          typename graph_t,
+          typename operator_t,
+          typename frontier_t>
+void execute_sparse(graph_t& G,
+                    operator_t op,
+                    frontier_t* input,
+                    frontier_t* output) {
+  using type_t = std::remove_pointer_t<decltype(input->data())>;
+
+  constexpr std::size_t chunk_size = 1 << 10;
+
+  std::size_t total_elems = input->get_number_of_elements();
+
+  if (type == filter_algorithm_t::bypass) {
+    if ((output->data() != input->data()) &&
+        (output->get_capacity() < total_elems))
+      output->reserve(total_elems);
+    output->set_number_of_elements(total_elems);
+
+    auto input_data = input->data();
+    auto output_data = output->data();
+
+#pragma omp parallel for schedule(dynamic, chunk_size)
+    for (std::int64_t i = 0; i < (std::int64_t)total_elems; ++i) {
+      type_t item = input_data[i];
+      output_data[i] = (gunrock::util::limits::is_valid(item) && op(item))
+                           ? item
+                           : gunrock::numeric_limits<type_t>::invalid();
+    }
+    return;
+  }
+
+  auto input_data = input->data();
+  auto& buffers = detail::get_thread_buffers<type_t>();
+
+  detail::for_each_chunk(
+      (total_elems + chunk_size - 1) / chunk_size,
+      [&](std::size_t chunk, int t) {
+        auto& local = buffers[t];
+        std::size_t end = std::min(total_elems, (chunk + 1) * chunk_size);
+        for (std::size_t i = chunk * chunk_size; i < end; ++i) {
+          type_t item = input_data[i];
+          if (gunrock::util::limits::is_valid(item) && op(item))
+            local.push_back(item);
+        }
+      });
+
+  detail::gather(buffers, output);
+}
+
+/**
+ * @brief Host filter of a dense (bitmap, boolmap) frontier. Items for which
+ * `op` returns false are removed in place if `output` is `input`, otherwise
+ * the kept items are inserted in `output` (all filter algorithms are the
+ * same on a dense frontier, there are no invalid items to keep or drop).
+ */
+template <filter_algorithm_t type,
+          typename graph_t,
+          typename operator_t,
+          typename frontier_t>
+void execute_dense(graph_t& G,
+                   operator_t op,
+                   frontier_t* input,
+                   frontier_t* output) {
+  constexpr std::size_t block_size = 1 << 12;  // items, multiple of 64.
+
+  bool in_place = (input == output);
+  std::size_t universe = input->get_capacity();
+  if (!in_place) {
+    output->reserve(universe);
+    output->clear();
+  }
+
+  detail::for_each_chunk(
+      (universe + block_size - 1) / block_size, [&](std::size_t block, int) {
+        input->for_each(block * block_size, (block + 1) * block_size,
+                        [&](auto const& item) {
+                          bool keep = op(item);
+                          if (in_place && !keep)
+                            input->remove(item);
+                          else if (!in_place && keep)
+                            output->insert(item);
+                        });
+      });
+
+  output->set_number_of_elements(output->popcount());
+}
+
+/**
+ * @brief Host filter, dispatches on the storage of the frontiers. A hybrid
+ * output frontier takes the representation of the input.
+ */
+template <filter_algorithm_t type,
+          typename graph_t,
+          typename operator_t,
+          typename frontier_t>
+void execute(graph_t& G,
+             operator_t op,
+             frontier_t* input,
+             frontier_t* output) {
+  if constexpr (frontier_t::underlying_storage() ==
+                frontier_storage_t::hybrid) {
+    output->match_representation(*input, input->get_capacity());
+    if (input->is_dense())
+      execute_dense<type>(G, op, &input->get_dense_frontier(),
+                          &output->get_dense_frontier());
+    else
+      execute_sparse<type>(G, op, &input->get_sparse_frontier(),
+                           &output->get_sparse_frontier());
+  } else if constexpr (frontier_t::underlying_storage() ==
+                       frontier_storage_t::vector) {
+    execute_sparse<type>(G, op, input, output);
+  } else {
+    execute_dense<type>(G, op, input, output);
+  }
+}
+
+}  // namespace host_mapped
+}  // namespace filter
+}  // namespace operators
+}  // namespace gunrock
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 #include <gunrock/cuda/context.hxx>
 
 #include <gunrock/framework/operators/configs.hxx>
@@ -18,23 +20,30 @@ void execute(graph_t& G, operator_t op, cuda::multi_context_t& context) {
                                     typename graph_t::vertex_type,
                                     typename graph_t::edge_type>;
 
-  auto single_context = context.get_context(0);
-
   std::size_t size = (type == parallel_for_each_t::vertex)
                          ? G.get_number_of_vertices()
                          : G.get_number_of_edges();
-  auto apply = [=] __device__(type_t const& x) {
-    op(x);
-    return x;  // output ignored.
-  };
-
-  thrust::transform(
-      thrust::cuda::par.on(single_context->stream()),
-      thrust::make_counting_iterator<type_t>(0),     // Begin: 0
-      thrust::make_counting_iterator<type_t>(size),  // End: # of Edges
-      thrust::make_discard_iterator(),               // output iterator: ignore
-      apply                                          // Unary Operator
-  );
+
+  // Host graphs: dynamic schedule, `op` may be unbalanced (e.g. per-vertex).
+  if constexpr (graph_t::memory_space() == memory_space_t::host) {
+#pragma omp parallel for schedule(dynamic, 1024)
+    for (std::int64_t x = 0; x < (std::int64_t)size; ++x)
+      op((type_t)x);
+  } else {
+    auto single_context = context.get_context(0);
+    auto apply = [=] __device__(type_t const& x) {
+      op(x);
+      return x;  // output ignored.
+    };
+
+    thrust::transform(
+        thrust::cuda::par.on(single_context->stream()),
+        thrust::make_counting_iterator<type_t>(0),     // Begin: 0
+        thrust::make_counting_iterator<type_t>(size),  // End: # of Edges
+        thrust::make_discard_iterator(),  // output iterator: ignore
+        apply                             // Unary Operator
+    );
+  }
 }
 
 }  // namespace parallel_for
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <algorithm>
+
 #include <gunrock/cuda/context.hxx>
+#include <gunrock/framework/frontier/configs.hxx>
 #include <gunrock/framework/operators/configs.hxx>
 #include <gunrock/util/type_limits.hxx>
 #include <gunrock/util/type_traits.hxx>
@@ -18,7 +21,38 @@ void execute(frontier_t* input,
              cuda::multi_context_t& context,
              const float& uniquification_percent = 100,
              bool best_effort_uniquification = false) {
-  if (context.size() == 1) {
+  // Host frontiers (of host graphs): sort in parallel, unique is a single
+  // linear pass. Dense frontiers are unique by construction.
+  if constexpr (frontier_t::memory_space() == memory_space_t::host) {
+    constexpr frontier_storage_t storage = frontier_t::underlying_storage();
+    if constexpr (storage != frontier_storage_t::vector) {
+      if (input->is_dense()) {
+        if (type == uniquify_algorithm_t::unique_copy)
+          *output = *input;
+        return;
+      }
+    }
+
+    if constexpr (storage == frontier_storage_t::vector ||
+                  storage == frontier_storage_t::hybrid) {
+      if (!best_effort_uniquification && (uniquification_percent == 100))
+        input->sort(sort::order_t::ascending);
+      if (type == uniquify_algorithm_t::unique) {
+        auto new_end = std::unique(input->begin(), input->end());
+        input->set_number_of_elements(new_end - input->begin());
+      } else {
+        if constexpr (storage == frontier_storage_t::hybrid)
+          output->match_representation(*input, input->get_capacity());
+        if (output->get_capacity() < input->get_number_of_elements())
+          output->reserve(input->get_number_of_elements());
+        auto new_end =
+            std::unique_copy(input->begin(), input->end(), output->begin());
+        output->set_number_of_elements(new_end - output->begin());
+      }
+    }
+  }
+
+  else if (context.size() == 1) {
     auto single_context = context.get_context(0);
 
     if (type == uniquify_algorithm_t::unique) {
@@ -53,6 +87,11 @@ void execute(enactor_type* E,
           cudaErrorUnknown,
           "Uniquification percentage must be a +ve float between 0 and 100.");
 
+  // Opt-in instrumentation (see `enactor_properties_t::trace`).
+  std::size_t record = 0;
+  if (E->get_trace())
+    record = E->begin_operator_trace("uniquify", false);
+
   execute<type>(E->get_input_frontier(),    // input frontier
                 E->get_output_frontier(),   // output frontier
                 context,                    // context
@@ -60,6 +99,9 @@ void execute(enactor_type* E,
                 best_effort_uniquification  // best effort attempt
   );
 
+  if (E->get_trace())
+    E->end_operator_trace(record);
+
   /*!
    * @note if the Enactor interface is used, we, the library writers assume
    * control of the frontiers and swap the input/output buffers as needed,
@@ -12,6 +12,8 @@
 #pragma once
 
 #include <gunrock/graph/graph.hxx>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
 
 namespace gunrock {
 /**
@@ -28,6 +30,7 @@ namespace gunrock {
  */
 template <typename graph_t>
 struct problem_t {
+  using graph_type = graph_t;
   using vertex_t = typename graph_t::vertex_type;
   using edge_t = typename graph_t::edge_type;
   using weight_t = typename graph_t::weight_type;
@@ -46,9 +49,33 @@ struct problem_t {
     return context->get_context(device);
   }
 
+  /**
+   * @brief Thrust execution policy matching the memory space of the graph:
+   * the single-gpu context's stream for device graphs, the host (system) for
+   * host graphs.
+   */
+  auto get_execution_policy() {
+    if constexpr (graph_t::memory_space() == memory_space_t::host)
+      return thrust::host;
+    else
+      return get_single_context()->execution_policy();
+  }
+
   virtual void init() = 0;
   virtual void reset() = 0;
 
+  /**
+   * @brief Reset the state of `vertices[0, size)` only, all the other
+   * vertices being in their reset state already (they were not visited since
+   * the last reset). This is what lets `gunrock::session_t` reset in time
+   * proportional to the previous query instead of the graph. `vertices` is in
+   * the memory space of the graph, items may repeat or be invalid. Defaults to
+   * a full `reset()`.
+   */
+  virtual void reset_vertices(vertex_t const* vertices, std::size_t size) {
+    reset();
+  }
+
   /*! Disable copy ctor and assignment operator. We do not want to let user copy
    * only a slice. Explanation:
    * https://www.geeksforgeeks.org/preventing-object-copy-in-cpp-3-different-ways/
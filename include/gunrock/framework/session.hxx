@@ -0,0 +1,267 @@
+/**
+ * @file session.hxx
+ * @brief Query session: a problem and an enactor bound to a graph once, and
+ * reused by many queries (e.g. single-source searches from many sources).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <gunrock/cuda/cuda.hxx>
+#include <gunrock/container/scratch.hxx>
+
+#include <gunrock/framework/frontier/frontier.hxx>
+#include <gunrock/framework/problem.hxx>
+#include <gunrock/framework/enactor.hxx>
+
+namespace gunrock {
+
+/**
+ * @brief Counters of a `session_t`. The pooled buffers are the frontiers, the
+ * enactor's work domain and the session's list of visited vertices; the
+ * allocations also count the growth of the host scratch spaces (see
+ * `get_scratch_allocations()`) while the session runs.
+ */
+struct session_stats_t {
+  std::size_t queries{0};            // queries answered.
+  std::size_t allocations{0};        // buffers (re)allocated, total.
+  std::size_t query_allocations{0};  // ... during the last query.
+  std::size_t allocated_bytes{0};    // held by the pooled buffers.
+  std::size_t full_resets{0};        // resets of the whole problem.
+  std::size_t reset_vertices{0};     // vertices reset by the last query.
+
+  void print() const {
+    std::cout << "Queries = " << queries << std::endl;
+    std::cout << "Allocations = " << allocations
+              << " (last query = " << query_allocations << ")" << std::endl;
+    std::cout << "Allocated (bytes) = " << allocated_bytes << std::endl;
+    std::cout << "Full resets = " << full_resets << std::endl;
+    std::cout << "Reset vertices (last query) = " << reset_vertices
+              << std::endl;
+  }
+};
+
+/**
+ * @brief Answers many queries of one algorithm on one graph, keeping the
+ * problem, the enactor and their buffers warm between queries.
+ *
+ * @par Overview
+ * `run()` style entry points create a context, initialize a problem and
+ * construct an enactor (which allocates its frontiers) for every query. A
+ * session does all of that once; a query only resets the problem and the
+ * enactor and enacts. The vertices of every frontier of a query are recorded
+ * (see `enactor_t::observe_frontier()`), and the next query resets only those
+ * (see `problem_t::reset_vertices()`), so the reset is proportional to the
+ * previous query's visited set rather than to the graph. If the recorded
+ * vertices outgrow the number of vertices, the next query falls back to a
+ * full `reset()`, which then costs no more than the recording did.
+ *
+ * Frontiers keep their storage between queries (hybrid frontiers keep both
+ * representations), and the host operators reuse their scratch space (see
+ * `get_scratch()`), so host queries stop allocating once warm;
+ * `session_stats_t::query_allocations` counts the growth of the pooled
+ * buffers and of the scratch spaces to confirm it. The scratch spaces are
+ * shared by the whole process, so the count includes any host work running
+ * concurrently with the query.
+ *
+ * @note The results are written to the arrays given at construction, and
+ * the session assumes that only queries modify them; call `reset()` after
+ * modifying them elsewhere. A session answers one query at a time.
+ *
+ * @tparam problem_type algorithm's problem (e.g. `bfs::problem_t`), with
+ * `param` and `result` members and a `(G, param, result, context)`
+ * constructor.
+ * @tparam enactor_type algorithm's enactor (e.g. `bfs::enactor_t`) over a
+ * vertex frontier.
+ */
+template <typename problem_type, typename enactor_type>
+class session_t {
+ public:
+  using graph_type = typename problem_type::graph_type;
+  using vertex_t = typename problem_type::vertex_t;
+  using param_type = decltype(problem_type::param);
+  using result_type = decltype(problem_type::result);
+  using frontier_type = typename enactor_type::frontier_type;
+
+  static constexpr memory_space_t space = graph_type::memory_space();
+
+  /**
+   * @brief Bind a session to `G`: creates the context, initializes the
+   * problem and constructs the enactor.
+   *
+   * @param G graph, must outlive the session.
+   * @param param parameters of the problem (each query sets its own).
+   * @param result output arrays, written by every query.
+   * @param properties see `enactor_properties_t`.
+   */
+  session_t(graph_type& G,
+            param_type param,
+            result_type result,
+            enactor_properties_t properties = enactor_properties_t())
+      : context(std::shared_ptr<cuda::multi_context_t>(
+            new cuda::multi_context_t((space == memory_space_t::host)
+                                          ? cuda::host_device
+                                          : 0))),
+        problem(new problem_type(G, param, result, context)),
+        enactor(nullptr),
+        visited(G.get_number_of_vertices()),
+        number_of_visited(0),
+        full_reset(true),
+        overflow(false),
+        scratch_allocations(get_scratch_allocations()) {
+    problem->init();
+    enactor.reset(
+        new recording_enactor_t(problem.get(), context, properties, this));
+
+    if constexpr (frontier_type::underlying_storage() ==
+                  frontier_storage_t::hybrid)
+      for (auto& buffer : enactor->frontiers)
+        buffer.set_storage_retention(true);
+
+    pooled_bytes.assign(enactor->frontiers.size() + 2, 0);
+    track_allocations();
+  }
+
+  session_t(const session_t& rhs) = delete;
+  session_t& operator=(const session_t& rhs) = delete;
+
+  /**
+   * @brief Answer one query: resets what the previous query visited, then
+   * enacts with `param`.
+   *
+   * @param param parameters of the query (e.g. the source vertex).
+   * @return float time took by the enactor (see `enactor_t::enact()`).
+   */
+  float query(param_type const& param) {
+    // Scratch space grown between queries is not the session's.
+    scratch_allocations = get_scratch_allocations();
+    std::size_t allocations = stats.allocations;
+    problem->param = param;
+
+    if (full_reset || overflow) {
+      problem->reset();
+      stats.reset_vertices = problem->get_graph().get_number_of_vertices();
+      stats.full_resets++;
+    } else {
+      problem->reset_vertices(memory::raw_pointer_cast(visited.data()),
+                              number_of_visited);
+      stats.reset_vertices = number_of_visited;
+    }
+    full_reset = false;
+    overflow = false;
+    number_of_visited = 0;
+
+    enactor->reset();
+    float elapsed = enactor->enact();
+    track_allocations();
+
+    stats.query_allocations = stats.allocations - allocations;
+    stats.queries++;
+    return elapsed;
+  }
+
+  /**
+   * @brief Make the next query reset the whole problem (e.g. after the
+   * result arrays were modified outside of the session).
+   */
+  void reset() { full_reset = true; }
+
+  session_stats_t const& get_stats() const { return stats; }
+  problem_type* get_problem() { return problem.get(); }
+  enactor_type* get_enactor() { return enactor.get(); }
+
+ private:
+  /**
+   * @brief The algorithm's enactor, reporting every frontier it sees to the
+   * session.
+   */
+  struct recording_enactor_t : enactor_type {
+    recording_enactor_t(problem_type* _problem,
+                        std::shared_ptr<cuda::multi_context_t> _context,
+                        enactor_properties_t _properties,
+                        session_t* _session)
+        : enactor_type(_problem, _context, _properties), session(_session) {}
+
+    void observe_frontier(frontier_type* f) override { session->record(f); }
+
+    session_t* session;
+  };
+
+  /**
+   * @brief Append the vertices of `f` to the visited list (stops recording
+   * once the list would outgrow the vertices, see `overflow`).
+   */
+  void record(frontier_type* f) {
+    if (overflow)
+      return;
+
+    std::size_t size = f->get_number_of_elements();
+    if (number_of_visited + size > visited.size()) {
+      overflow = true;
+      return;
+    }
+
+    vertex_t* output =
+        memory::raw_pointer_cast(visited.data()) + number_of_visited;
+    if constexpr (frontier_type::underlying_storage() ==
+                  frontier_storage_t::hybrid) {
+      if (f->is_dense()) {
+        number_of_visited += f->get_dense_frontier().compact(output);
+        track_allocations();
+        return;
+      }
+    }
+    thrust::copy(problem->get_execution_policy(), f->begin(), f->end(),
+                 output);
+    number_of_visited += size;
+    track_allocations();
+  }
+
+  /**
+   * @brief Count the pooled buffers whose size changed, and the scratch
+   * spaces that grew, since the last call.
+   */
+  void track_allocations() {
+    std::size_t scratch = get_scratch_allocations();
+    stats.allocations += scratch - scratch_allocations;
+    scratch_allocations = scratch;
+
+    std::size_t index = 0;
+    std::size_t total = 0;
+    auto track = [&](std::size_t bytes) {
+      if (bytes != pooled_bytes[index])
+        stats.allocations++;
+      pooled_bytes[index++] = bytes;
+      total += bytes;
+    };
+
+    for (auto& buffer : enactor->frontiers)
+      track(buffer.get_allocated_size_in_bytes());
+    track(enactor->scanned_work_domain.capacity() * sizeof(vertex_t));
+    track(visited.capacity() * sizeof(vertex_t));
+    stats.allocated_bytes = total;
+  }
+
+  std::shared_ptr<cuda::multi_context_t> context;
+  std::unique_ptr<problem_type> problem;
+  std::unique_ptr<recording_enactor_t> enactor;
+
+  vector_t<vertex_t, space> visited;  // vertices of the query's frontiers.
+  std::size_t number_of_visited;
+  bool full_reset;  // the next query resets the whole problem.
+  bool overflow;    // `visited` is incomplete.
+
+  std::vector<std::size_t> pooled_bytes;  // last seen size of every buffer.
+  std::size_t scratch_allocations;  // last seen `get_scratch_allocations()`.
+  session_stats_t stats;
+};  // class session_t
+
+}  // namespace gunrock
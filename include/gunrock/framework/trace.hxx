@@ -0,0 +1,303 @@
+/**
+ * @file trace.hxx
+ * @brief Opt-in instrumentation of the enactor: per-iteration frontier sizes
+ * and edges, per-operator times and frontier swaps, exported to `io::json` or
+ * to a Chrome trace (Perfetto) file.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <gunrock/io/json.hxx>
+
+namespace gunrock {
+
+/**
+ * @brief Records what an enactor does: every `enact()`, every iteration of
+ * its loop, every `advance`, `filter` and `uniquify` call (through the enactor
+ * interface) and every swap of the frontier buffers.
+ *
+ * @par Overview
+ * Instrumentation is off unless a trace is given to the enactor (see
+ * `enactor_properties_t::trace`); without one, the enactor and the operators
+ * only test a null pointer. With one, device runs are synchronized around
+ * every recorded event (so that the times are those of the event), and the
+ * edges out of every advance's input frontier are counted before the advance
+ * (outside of its time). Times are in microseconds since the trace was
+ * constructed (or `reset()`). A trace accumulates the runs of all the
+ * enactors it is given to, until `reset()`.
+ *
+ * @par Example
+ * \code
+ * gunrock::trace_t trace;
+ * gunrock::enactor_properties_t properties;
+ * properties.trace = &trace;
+ * gunrock::bfs::run(G, source, distances, predecessors, properties);
+ * trace.print();
+ * trace.write_chrome_trace("bfs.trace.json");  // chrome://tracing, Perfetto
+ * \endcode
+ */
+struct trace_t {
+  using clock_t = std::chrono::steady_clock;
+
+  /**
+   * @brief One `enact()`.
+   */
+  struct run_record_t {
+    double begin;
+    double duration;
+    int iterations;
+  };
+
+  /**
+   * @brief One iteration of the enactor's loop (`loop()`).
+   */
+  struct iteration_record_t {
+    int iteration;
+    double begin;
+    double duration;
+    std::size_t input;      // input frontier, before the iteration.
+    std::size_t output;     // input frontier of the next iteration.
+    std::size_t edges;      // edges out of the advances' input frontiers.
+    std::size_t operators;  // recorded operator calls.
+    std::size_t swaps;      // swaps of the frontier buffers.
+  };
+
+  /**
+   * @brief One call to an operator.
+   */
+  struct operator_record_t {
+    char const* name;  // "advance", "filter", "uniquify".
+    int iteration;
+    double begin;
+    double duration;
+    std::size_t input;   // input frontier.
+    std::size_t output;  // output frontier.
+    std::size_t edges;   // edges out of the input frontier (advance).
+  };
+
+  /**
+   * @brief One swap of the frontier buffers.
+   */
+  struct swap_record_t {
+    int iteration;
+    double time;
+    std::size_t size;  // new input frontier.
+  };
+
+  std::vector<run_record_t> runs;
+  std::vector<iteration_record_t> iterations;
+  std::vector<operator_record_t> operators;
+  std::vector<swap_record_t> swaps;
+
+  trace_t() { reset(); }
+
+  /**
+   * @brief Drop all the records and restart the clock.
+   */
+  void reset() {
+    runs.clear();
+    iterations.clear();
+    operators.clear();
+    swaps.clear();
+    in_iteration = false;
+    origin = clock_t::now();
+  }
+
+  /**
+   * @brief Microseconds since the trace was constructed (or reset).
+   */
+  double now() const {
+    return std::chrono::duration<double, std::micro>(clock_t::now() - origin)
+        .count();
+  }
+
+  // Recording, called by the enactor and the operators.
+  // record <start>
+  void begin_run() { runs.push_back({now(), 0, 0}); }
+
+  void end_run(int iterations) {
+    runs.back().duration = now() - runs.back().begin;
+    runs.back().iterations = iterations;
+  }
+
+  void begin_iteration(int iteration, std::size_t input) {
+    iterations.push_back({iteration, now(), 0, input, 0, 0, 0, 0});
+    in_iteration = true;
+  }
+
+  void end_iteration(std::size_t output) {
+    auto& record = iterations.back();
+    record.duration = now() - record.begin;
+    record.output = output;
+    in_iteration = false;
+  }
+
+  /**
+   * @brief Start recording an operator call.
+   * @return std::size_t the record, to pass to `end_operator()`.
+   */
+  std::size_t begin_operator(char const* name,
+                             int iteration,
+                             std::size_t input,
+                             std::size_t edges) {
+    if (in_iteration) {
+      iterations.back().edges += edges;
+      iterations.back().operators++;
+    }
+    operators.push_back({name, iteration, now(), 0, input, 0, edges});
+    return operators.size() - 1;
+  }
+
+  void end_operator(std::size_t record, std::size_t output) {
+    operators[record].duration = now() - operators[record].begin;
+    operators[record].output = output;
+  }
+
+  void record_swap(int iteration, std::size_t size) {
+    if (in_iteration)
+      iterations.back().swaps++;
+    swaps.push_back({iteration, now(), size});
+  }
+  // record <end>
+
+  /**
+   * @brief Print the iterations: frontier sizes, edges, time and throughput.
+   */
+  void print() const {
+    std::cout << std::setw(10) << "iteration" << std::setw(12) << "input"
+              << std::setw(12) << "output" << std::setw(14) << "edges"
+              << std::setw(12) << "time (ms)" << std::setw(10) << "MTEPS"
+              << std::endl;
+    for (auto const& record : iterations)
+      std::cout << std::setw(10) << record.iteration << std::setw(12)
+                << record.input << std::setw(12) << record.output
+                << std::setw(14) << record.edges << std::setw(12)
+                << record.duration * 1e-3 << std::setw(10)
+                << ((record.duration > 0) ? record.edges / record.duration : 0)
+                << std::endl;
+    for (auto const& record : runs)
+      std::cout << "Run: " << record.iterations << " iterations, "
+                << record.duration * 1e-3 << " (ms)" << std::endl;
+  }
+
+  /**
+   * @brief Append the records to `json`, as the arrays "runs", "iterations",
+   * "operators" and "swaps".
+   */
+  void write(io::json& json) const {
+    for (auto const& record : runs) {
+      auto object = json.new_object();
+      json.set_val("begin_us", record.begin, object);
+      json.set_val("duration_us", record.duration, object);
+      json.set_val("iterations", record.iterations, object);
+      json.append_object("runs", object);
+    }
+    for (auto const& record : iterations) {
+      auto object = json.new_object();
+      json.set_val("iteration", record.iteration, object);
+      json.set_val("begin_us", record.begin, object);
+      json.set_val("duration_us", record.duration, object);
+      json.set_val("input", (unsigned long)record.input, object);
+      json.set_val("output", (unsigned long)record.output, object);
+      json.set_val("edges", (unsigned long)record.edges, object);
+      json.set_val("operators", (unsigned long)record.operators, object);
+      json.set_val("swaps", (unsigned long)record.swaps, object);
+      json.append_object("iterations", object);
+    }
+    for (auto const& record : operators) {
+      auto object = json.new_object();
+      json.set_val("name", std::string(record.name), object);
+      json.set_val("iteration", record.iteration, object);
+      json.set_val("begin_us", record.begin, object);
+      json.set_val("duration_us", record.duration, object);
+      json.set_val("input", (unsigned long)record.input, object);
+      json.set_val("output", (unsigned long)record.output, object);
+      json.set_val("edges", (unsigned long)record.edges, object);
+      json.append_object("operators", object);
+    }
+    for (auto const& record : swaps) {
+      auto object = json.new_object();
+      json.set_val("iteration", record.iteration, object);
+      json.set_val("time_us", record.time, object);
+      json.set_val("size", (unsigned long)record.size, object);
+      json.append_object("swaps", object);
+    }
+  }
+
+  /**
+   * @brief Write the records in the Trace Event Format, for chrome://tracing
+   * and Perfetto: runs, iterations and operators are nested slices, swaps are
+   * instant events and the input frontier size is a counter.
+   *
+   * @param filename output file.
+   */
+  void write_chrome_trace(std::string filename) const {
+    std::ofstream file(filename);
+    if (!file) {
+      std::cerr << "Unable to open trace file: " << filename << std::endl;
+      exit(1);
+    }
+
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+    bool first = true;
+    auto event = [&](char const* name, char const* category, char phase,
+                     double time) -> std::ofstream& {
+      file << (first ? "" : ",\n") << "{\"name\": \"" << name
+           << "\", \"cat\": \"" << category << "\", \"ph\": \"" << phase
+           << "\", \"pid\": 1, \"tid\": 1, \"ts\": " << time;
+      first = false;
+      return file;
+    };
+
+    for (auto const& record : runs)
+      event("enact", "run", 'X', record.begin)
+          << ", \"dur\": " << record.duration
+          << ", \"args\": {\"iterations\": " << record.iterations << "}}";
+
+    for (auto const& record : iterations) {
+      std::string name = "iteration " + std::to_string(record.iteration);
+      event(name.c_str(), "iteration", 'X', record.begin)
+          << ", \"dur\": " << record.duration
+          << ", \"args\": {\"input\": " << record.input
+          << ", \"output\": " << record.output
+          << ", \"edges\": " << record.edges << "}}";
+    }
+
+    for (auto const& record : operators)
+      event(record.name, "operator", 'X', record.begin)
+          << ", \"dur\": " << record.duration
+          << ", \"args\": {\"iteration\": " << record.iteration
+          << ", \"input\": " << record.input
+          << ", \"output\": " << record.output
+          << ", \"edges\": " << record.edges << "}}";
+
+    for (auto const& record : swaps) {
+      event("swap", "frontier", 'i', record.time)
+          << ", \"s\": \"t\", \"args\": {\"size\": " << record.size << "}}";
+      event("frontier", "frontier", 'C', record.time)
+          << ", \"args\": {\"size\": " << record.size << "}}";
+    }
+
+    file << "\n]}\n";
+  }
+
+ private:
+  clock_t::time_point origin;
+  bool in_iteration;
+};  // struct trace_t
+
+}  // namespace gunrock
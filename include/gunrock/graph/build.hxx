@@ -34,6 +34,73 @@ auto from_csr(vertex_t const& r,
   return detail::from_csr<space, build_views>(r, c, nnz, Ap, J, X, I, Aj);
 }
 
+/**
+ * @brief Build a graph from prebuilt CSR and CSC formats (for example, from
+ * `format::from_coo(coo, csr, csc)`), no conversion is performed for the CSC
+ * view. The COO view, if requested, is built from the CSR into `I`.
+ *
+ * @param Ap CSR row offsets.
+ * @param J CSR column indices.
+ * @param X CSR values.
+ * @param Aj CSC column offsets.
+ * @param Ai CSC row indices.
+ * @param Xc CSC values (in column order).
+ * @param I COO row indices (output, only used with `view_t::coo`).
+ */
+template <memory_space_t space,
+          view_t build_views,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto from_csr_and_csc(vertex_t const& r,
+                      vertex_t const& c,
+                      edge_t const& nnz,
+                      edge_t* Ap,
+                      vertex_t* J,
+                      weight_t* X,
+                      edge_t* Aj,
+                      vertex_t* Ai,
+                      weight_t* Xc,
+                      vertex_t* I = nullptr) {
+  return detail::from_csr_and_csc<space, build_views>(r, c, nnz, Ap, J, X, Aj,
+                                                      Ai, Xc, I);
+}
+
+/**
+ * @brief Build a graph with the compressed CSR view (host only) over a
+ * compressed CSR, see `format::compressed_csr_t`. The graph keeps pointers to
+ * `C`'s storage.
+ *
+ * @tparam build_views must be `view_t::compressed_csr`.
+ */
+template <memory_space_t space,
+          view_t build_views,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto from_compressed_csr(
+    format::compressed_csr_t<space, vertex_t, edge_t, weight_t>& C) {
+  return detail::from_compressed_csr<space, build_views>(C);
+}
+
+/**
+ * @brief Build a graph with the dynamic CSR view (host only) over a dynamic
+ * CSR, see `format::dynamic_csr_t`. The graph keeps pointers to `D`'s
+ * storage, which `D.update()` may move: build the graph again after every
+ * batch (cheap, no copy).
+ *
+ * @tparam build_views must be `view_t::dynamic_csr`.
+ */
+template <memory_space_t space,
+          view_t build_views,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto from_dynamic_csr(
+    format::dynamic_csr_t<space, vertex_t, edge_t, weight_t>& D) {
+  return detail::from_dynamic_csr<space, build_views>(D);
+}
+
 }  // namespace build
 }  // namespace graph
 }  // namespace gunrock
\ No newline at end of file
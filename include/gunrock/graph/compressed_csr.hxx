@@ -0,0 +1,221 @@
+/**
+ * @file compressed_csr.hxx
+ * @brief Compressed CSR graph view (see `format::compressed_csr_t`).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include <gunrock/memory.hxx>
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/graph/vertex_pair.hxx>
+#include <gunrock/formats/detail/compression.hxx>
+
+namespace gunrock {
+namespace graph {
+
+struct empty_compressed_csr_t {};
+
+using namespace memory;
+
+/**
+ * @brief Graph view over a compressed CSR (host only). Adjacency lists are
+ * decoded on the fly: iterate them with `for_each_neighbor()`, which streams
+ * through the encoded row, or `for_each_edge()` for a range of rows.
+ * `get_number_of_neighbors()` and `get_starting_edge()` locate the row from
+ * its offset sample (a few rows are skipped, not decoded). Random access by
+ * edge id (`get_destination_vertex()`, `get_source_vertex()`) decodes the row
+ * and is meant for occasional use only.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+class graph_compressed_csr_t {
+  using vertex_type = vertex_t;
+  using edge_type = edge_t;
+  using weight_type = weight_t;
+
+  using vertex_pair_type = vertex_pair_t<vertex_type>;
+  using byte_t = format::detail::compression::byte_t;
+
+ public:
+  graph_compressed_csr_t()
+      : number_of_vertices(0),
+        number_of_edges(0),
+        compression(format::compression_t::varint),
+        sampling_shift(0),
+        adjacency(nullptr),
+        edge_samples(nullptr),
+        byte_samples(nullptr),
+        values(nullptr) {}
+
+  edge_type get_number_of_neighbors(vertex_type const& v) const {
+    format::detail::compression::row_header_t header;
+    format::detail::compression::read_header(locate(v).first, header);
+    return (edge_type)header.degree;
+  }
+
+  edge_type get_starting_edge(vertex_type const& v) const {
+    return locate(v).second;
+  }
+
+  /**
+   * @brief Call `op(neighbor, edge)` for every neighbor of `v`, in
+   * increasing order.
+   */
+  template <typename operator_t>
+  void for_each_neighbor(vertex_type const& v, operator_t op) const {
+    auto [row, e] = locate(v);
+    format::detail::compression::decode_row<vertex_type>(
+        row, v, compression, [&](vertex_type const& n, std::size_t rank) {
+          op(n, (edge_type)(e + rank));
+          return true;
+        });
+  }
+
+  /**
+   * @brief Call `op(source, neighbor, edge)` for every edge of the vertices
+   * `[begin, end)`, streaming through the rows (one row lookup in total);
+   * the fastest way to scan a range of adjacency lists.
+   */
+  template <typename operator_t>
+  void for_each_edge(vertex_type const& begin,
+                     vertex_type const& end,
+                     operator_t op) const {
+    if (begin >= end)
+      return;
+    auto [row, e] = locate(begin);
+    for (vertex_type v = begin; v < end; ++v) {
+      edge_type start = e;
+      row = format::detail::compression::decode_row<vertex_type>(
+          row, v, compression, [&](vertex_type const& n, std::size_t rank) {
+            op(v, n, (edge_type)(start + rank));
+            ++e;
+            return true;
+          });
+    }
+  }
+
+  vertex_type get_source_vertex(edge_type const& e) const {
+    // Last sample starting at or before `e`, then skip rows.
+    edge_type const* sample =
+        std::upper_bound(edge_samples, edge_samples + number_of_samples(),
+                         e) -
+        1;
+    vertex_type v = (vertex_type)((sample - edge_samples) << sampling_shift);
+    byte_t const* row = adjacency + byte_samples[sample - edge_samples];
+    edge_type start = *sample;
+    for (;;) {
+      format::detail::compression::row_header_t header;
+      auto payload = format::detail::compression::read_header(row, header);
+      if (e < start + (edge_type)header.degree)
+        return v;
+      start += header.degree;
+      row = payload + header.payload;
+      ++v;
+    }
+  }
+
+  vertex_type get_destination_vertex(edge_type const& e) const {
+    vertex_type v = get_source_vertex(e);
+    auto [row, start] = locate(v);
+    vertex_type destination = gunrock::numeric_limits<vertex_type>::invalid();
+    format::detail::compression::decode_row<vertex_type>(
+        row, v, compression, [&](vertex_type const& n, std::size_t rank) {
+          destination = n;
+          return (start + (edge_type)rank) < e;
+        });
+    return destination;
+  }
+
+  vertex_pair_type get_source_and_destination_vertices(
+      const edge_type& e) const {
+    return {get_source_vertex(e), get_destination_vertex(e)};
+  }
+
+  /**
+   * @brief Edge from `source` to `destination`, invalid if there is none.
+   */
+  edge_type get_edge(const vertex_type& source,
+                     const vertex_type& destination) const {
+    auto [row, start] = locate(source);
+    edge_type edge = gunrock::numeric_limits<edge_type>::invalid();
+    format::detail::compression::decode_row<vertex_type>(
+        row, source, compression,
+        [&](vertex_type const& n, std::size_t rank) {
+          if (n == destination)
+            edge = start + (edge_type)rank;
+          return n < destination;
+        });
+    return edge;
+  }
+
+  weight_type get_edge_weight(edge_type const& e) const { return values[e]; }
+
+  // Representation specific functions
+  // ...
+  byte_t const* get_compressed_adjacency() const { return adjacency; }
+
+ protected:
+  void set(vertex_type const& _number_of_vertices,
+           edge_type const& _number_of_edges,
+           format::compression_t _compression,
+           int _sampling_shift,
+           byte_t const* _adjacency,
+           edge_type const* _edge_samples,
+           std::uint64_t const* _byte_samples,
+           weight_type* _values) {
+    number_of_vertices = _number_of_vertices;
+    number_of_edges = _number_of_edges;
+    compression = _compression;
+    sampling_shift = _sampling_shift;
+    adjacency = _adjacency;
+    edge_samples = _edge_samples;
+    byte_samples = _byte_samples;
+    values = _values;
+  }
+
+ private:
+  std::size_t number_of_samples() const {
+    return ((std::size_t)number_of_vertices + (1 << sampling_shift) - 1) >>
+           sampling_shift;
+  }
+
+  /**
+   * @brief Encoded row of `v` and its starting edge: from the sample of `v`,
+   * skip the rows before `v` (headers only).
+   */
+  std::pair<byte_t const*, edge_type> locate(vertex_type const& v) const {
+    std::size_t sample = (std::size_t)v >> sampling_shift;
+    byte_t const* row = adjacency + byte_samples[sample];
+    edge_type e = edge_samples[sample];
+    for (vertex_type u = (vertex_type)(sample << sampling_shift); u < v; ++u) {
+      format::detail::compression::row_header_t header;
+      row = format::detail::compression::read_header(row, header) +
+            header.payload;
+      e += (edge_type)header.degree;
+    }
+    return {row, e};
+  }
+
+  // Underlying data storage
+  vertex_type number_of_vertices;  // XXX: redundant
+  edge_type number_of_edges;       // XXX: redundant
+
+  format::compression_t compression;
+  int sampling_shift;
+
+  byte_t const* adjacency;
+  edge_type const* edge_samples;
+  std::uint64_t const* byte_samples;
+  weight_type* values;
+};  // struct graph_compressed_csr_t
+
+}  // namespace graph
+}  // namespace gunrock
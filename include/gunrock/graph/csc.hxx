@@ -100,8 +100,8 @@ class graph_csc_t {
     this->number_of_vertices = _number_of_vertices;
     this->number_of_edges = _number_of_edges;
     // Set raw pointers
-    offsets = raw_pointer_cast<edge_type>(Aj);
-    indices = raw_pointer_cast<vertex_type>(Ap);
+    offsets = raw_pointer_cast<edge_type>(Ap);
+    indices = raw_pointer_cast<vertex_type>(Aj);
     values = raw_pointer_cast<weight_type>(Ax);
   }
 
@@ -53,6 +53,17 @@ class graph_csr_t {
     return (offsets[v + 1] - offsets[v]);
   }
 
+  /**
+   * @brief Call `op(neighbor, edge)` for every neighbor of `v`.
+   */
+  template <typename operator_t>
+  __host__ __device__ __forceinline__ void for_each_neighbor(
+      vertex_type const& v,
+      operator_t op) const {
+    for (edge_type e = offsets[v]; e < offsets[v + 1]; ++e)
+      op(indices[e], e);
+  }
+
   __host__ __device__ __forceinline__ vertex_type
   get_source_vertex(edge_type const& e) const {
     auto keys = get_row_offsets();
@@ -9,6 +9,7 @@
  *
  */
 
+#include <gunrock/formats/formats.hxx>
 #include <gunrock/graph/conversions/convert.hxx>
 
 namespace gunrock {
@@ -28,7 +29,9 @@ auto builder(vertex_t const& r,
              vertex_t* J,
              edge_t* Ap,
              edge_t* Aj,
-             weight_t* X) {
+             weight_t* X,
+             vertex_t* Ai = nullptr,
+             weight_t* Xc = nullptr) {
   // Enable the types based on the different views required.
   // Enable CSR.
   using csr_v_t =
@@ -58,7 +61,8 @@ auto builder(vertex_t const& r,
   }
 
   if constexpr (has(build_views, view_t::csc)) {
-    G.template set<csc_v_t>(r, nnz, Aj, I, X);
+    // CSC row indices and values, if built separately (column order).
+    G.template set<csc_v_t>(r, nnz, Aj, Ai ? Ai : I, Xc ? Xc : X);
   }
 
   if constexpr (has(build_views, view_t::coo)) {
@@ -96,6 +100,83 @@ auto from_csr(vertex_t const& r,
                  build_views  // supported views
                  >(r, c, nnz, I, J, Ap, Aj, X);
 }
+
+template <memory_space_t space,
+          view_t build_views,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto from_csr_and_csc(vertex_t const& r,
+                      vertex_t const& c,
+                      edge_t const& nnz,
+                      edge_t* Ap,
+                      vertex_t* J,
+                      weight_t* X,
+                      edge_t* Aj,
+                      vertex_t* Ai,
+                      weight_t* Xc,
+                      vertex_t* I = nullptr) {
+  if constexpr (has(build_views, view_t::coo)) {
+    const edge_t size_of_offsets = r + 1;
+    convert::offsets_to_indices<space>(Ap, size_of_offsets, I, nnz);
+  }
+
+  return builder<space,       // build for host
+                 build_views  // supported views
+                 >(r, c, nnz, I, J, Ap, Aj, X, Ai, Xc);
+}
+
+template <memory_space_t space,
+          view_t build_views,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto from_compressed_csr(
+    format::compressed_csr_t<space, vertex_t, edge_t, weight_t>& C) {
+  static_assert(build_views == view_t::compressed_csr,
+                "A compressed CSR only builds the compressed CSR view.");
+
+  using compressed_csr_v_t =
+      graph::graph_compressed_csr_t<vertex_t, edge_t, weight_t>;
+  using graph_type =
+      graph::graph_t<space, vertex_t, edge_t, weight_t, compressed_csr_v_t>;
+
+  graph_type G;
+  G.template set<compressed_csr_v_t>(
+      C.number_of_rows, C.number_of_nonzeros, C.compression, C.sampling_shift,
+      memory::raw_pointer_cast(C.adjacency.data()),
+      memory::raw_pointer_cast(C.edge_samples.data()),
+      memory::raw_pointer_cast(C.byte_samples.data()),
+      memory::raw_pointer_cast(C.nonzero_values.data()));
+  return G;
+}
+
+template <memory_space_t space,
+          view_t build_views,
+          typename edge_t,
+          typename vertex_t,
+          typename weight_t>
+auto from_dynamic_csr(
+    format::dynamic_csr_t<space, vertex_t, edge_t, weight_t>& D) {
+  static_assert(build_views == view_t::dynamic_csr,
+                "A dynamic CSR only builds the dynamic CSR view.");
+
+  using dynamic_csr_v_t =
+      graph::graph_dynamic_csr_t<vertex_t, edge_t, weight_t>;
+  using graph_type =
+      graph::graph_t<space, vertex_t, edge_t, weight_t, dynamic_csr_v_t>;
+
+  graph_type G;
+  G.template set<dynamic_csr_v_t>(
+      D.number_of_rows, D.get_number_of_slots(),
+      memory::raw_pointer_cast(D.row_offsets.data()),
+      memory::raw_pointer_cast(D.row_lengths.data()),
+      memory::raw_pointer_cast(D.column_indices.data()),
+      memory::raw_pointer_cast(D.row_indices.data()),
+      memory::raw_pointer_cast(D.nonzero_values.data()));
+  return G;
+}
+
 }  // namespace detail
 }  // namespace build
 }  // namespace graph
@@ -0,0 +1,138 @@
+/**
+ * @file dynamic_csr.hxx
+ * @brief Dynamic CSR graph view (see `format::dynamic_csr_t`).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include <gunrock/memory.hxx>
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/graph/vertex_pair.hxx>
+
+namespace gunrock {
+namespace graph {
+
+struct empty_dynamic_csr_t {};
+
+using namespace memory;
+
+/**
+ * @brief Graph view over a dynamic CSR (host only). Edge ids are storage
+ * slots: the edges of `v` are `[get_starting_edge(v), get_starting_edge(v) +
+ * get_number_of_neighbors(v))`, sorted by destination, and the graph's
+ * number of edges is the number of slots (live edges, slack and dead slots),
+ * so that edge ids stay below it. The view holds pointers into the format:
+ * build it again after every batch of updates.
+ */
+template <typename vertex_t, typename edge_t, typename weight_t>
+class graph_dynamic_csr_t {
+  using vertex_type = vertex_t;
+  using edge_type = edge_t;
+  using weight_type = weight_t;
+
+  using vertex_pair_type = vertex_pair_t<vertex_type>;
+
+ public:
+  graph_dynamic_csr_t()
+      : number_of_vertices(0),
+        number_of_edges(0),
+        offsets(nullptr),
+        lengths(nullptr),
+        indices(nullptr),
+        sources(nullptr),
+        values(nullptr) {}
+
+  edge_type get_number_of_neighbors(vertex_type const& v) const {
+    return lengths[v];
+  }
+
+  edge_type get_starting_edge(vertex_type const& v) const {
+    return offsets[v];
+  }
+
+  /**
+   * @brief Call `op(neighbor, edge)` for every neighbor of `v`, in
+   * increasing order.
+   */
+  template <typename operator_t>
+  void for_each_neighbor(vertex_type const& v, operator_t op) const {
+    for (edge_type e = offsets[v]; e < offsets[v] + lengths[v]; ++e)
+      op(indices[e], e);
+  }
+
+  /**
+   * @brief Source of edge `e` (invalid for a free or dead slot).
+   */
+  vertex_type get_source_vertex(edge_type const& e) const {
+    return sources[e];
+  }
+
+  vertex_type get_destination_vertex(edge_type const& e) const {
+    return indices[e];
+  }
+
+  vertex_pair_type get_source_and_destination_vertices(
+      const edge_type& e) const {
+    return {get_source_vertex(e), get_destination_vertex(e)};
+  }
+
+  /**
+   * @brief Edge from `source` to `destination`, invalid if there is none.
+   */
+  edge_type get_edge(const vertex_type& source,
+                     const vertex_type& destination) const {
+    auto first = indices + offsets[source];
+    auto last = first + lengths[source];
+    auto it = std::lower_bound(first, last, destination);
+    return (it != last && *it == destination)
+               ? (edge_type)(it - indices)
+               : gunrock::numeric_limits<edge_type>::invalid();
+  }
+
+  weight_type get_edge_weight(edge_type const& e) const { return values[e]; }
+
+  // Representation specific functions
+  // ...
+  edge_type const* get_row_offsets() const { return offsets; }
+  edge_type const* get_row_lengths() const { return lengths; }
+  vertex_type const* get_column_indices() const { return indices; }
+  weight_type const* get_nonzero_values() const { return values; }
+
+ protected:
+  void set(vertex_type const& _number_of_vertices,
+           edge_type const& _number_of_edges,
+           edge_type const* _offsets,
+           edge_type const* _lengths,
+           vertex_type const* _indices,
+           vertex_type const* _sources,
+           weight_type const* _values) {
+    number_of_vertices = _number_of_vertices;
+    number_of_edges = _number_of_edges;
+    offsets = _offsets;
+    lengths = _lengths;
+    indices = _indices;
+    sources = _sources;
+    values = _values;
+  }
+
+ private:
+  // Underlying data storage
+  vertex_type number_of_vertices;  // XXX: redundant
+  edge_type number_of_edges;       // XXX: redundant
+
+  edge_type const* offsets;
+  edge_type const* lengths;
+  vertex_type const* indices;
+  vertex_type const* sources;
+  weight_type const* values;
+};  // struct graph_dynamic_csr_t
+
+}  // namespace graph
+}  // namespace gunrock
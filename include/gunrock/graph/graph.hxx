@@ -17,6 +17,8 @@
 #include <gunrock/graph/coo.hxx>
 #include <gunrock/graph/csc.hxx>
 #include <gunrock/graph/csr.hxx>
+#include <gunrock/graph/compressed_csr.hxx>
+#include <gunrock/graph/dynamic_csr.hxx>
 
 namespace gunrock {
 namespace graph {
@@ -74,6 +76,10 @@ class graph_t : public graph_view_t... {
   using graph_csr_view_t = graph_csr_t<vertex_type, edge_type, weight_type>;
   using graph_csc_view_t = graph_csc_t<vertex_type, edge_type, weight_type>;
   using graph_coo_view_t = graph_coo_t<vertex_type, edge_type, weight_type>;
+  using graph_compressed_csr_view_t =
+      graph_compressed_csr_t<vertex_type, edge_type, weight_type>;
+  using graph_dynamic_csr_view_t =
+      graph_dynamic_csr_t<vertex_type, edge_type, weight_type>;
 
   __host__ __device__ graph_t()
       : number_of_vertices(0),
@@ -110,8 +116,8 @@ class graph_t : public graph_view_t... {
     return std::disjunction_v<std::is_same<input_view_t, graph_view_t>...>;
   }
 
-  __host__ __device__ __forceinline__ constexpr memory_space_t memory_space()
-      const {
+  __host__ __device__ __forceinline__ static constexpr memory_space_t
+  memory_space() {
     return space;
   }
 
@@ -177,6 +183,19 @@ class graph_t : public graph_view_t... {
     return input_view_t::get_edge_weight(e);
   }
 
+  /**
+   * @brief Call `op(neighbor, edge)` for every neighbor of `v`. The way to
+   * scan adjacency lists that works with every view (a compressed view
+   * decodes the list as it goes).
+   */
+  template <typename input_view_t = first_view_t, typename operator_t>
+  __host__ __device__ __forceinline__ void for_each_neighbor(
+      vertex_type const& v,
+      operator_t op) const {
+    assert(v < this->get_number_of_vertices());
+    input_view_t::for_each_neighbor(v, op);
+  }
+
  private:
   // TODO: fix this, it is including empty_t structs for now.
   // We can subtract those structs to get the real value.
@@ -198,7 +217,7 @@ class graph_t : public graph_view_t... {
  */
 template <typename graph_type>
 __host__ __device__ double get_average_degree(graph_type const& G) {
-  auto sum = 0;
+  double sum = 0;
   for (auto v = 0; v < G.get_number_of_vertices(); ++v)
     sum += G.get_number_of_neighbors(v);
 
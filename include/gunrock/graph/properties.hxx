@@ -20,6 +20,8 @@ enum view_t : uint32_t {
   csr = 1 << 1,
   csc = 1 << 2,
   coo = 1 << 3,
+  compressed_csr = 1 << 4,  // host only, see graph_compressed_csr_t.
+  dynamic_csr = 1 << 5,     // host only, see graph_dynamic_csr_t.
   invalid = 1 << 0
 };
 
@@ -0,0 +1,221 @@
+/**
+ * @file parse.hxx
+ * @brief Minimal, locale-independent text parsers used by the loaders. These
+ * operate on a `[begin, end)` character range (for example, a chunk of a
+ * memory-mapped file) and advance the cursor past what they consumed.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace gunrock {
+namespace io {
+namespace detail {
+namespace parse {
+
+inline bool is_blank(char c) {
+  return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\v') ||
+         (c == '\f');
+}
+
+inline bool is_digit(char c) {
+  return (c >= '0') && (c <= '9');
+}
+
+/**
+ * @brief Skip spaces and tabs (but not new lines).
+ */
+inline void skip_blanks(const char*& p, const char* end) {
+  while (p < end && is_blank(*p))
+    ++p;
+}
+
+/**
+ * @brief Move the cursor to the first character of the next line (or `end`).
+ */
+inline void skip_line(const char*& p, const char* end) {
+  auto newline = static_cast<const char*>(std::memchr(p, '\n', end - p));
+  p = newline ? newline + 1 : end;
+}
+
+/**
+ * @brief Is the line starting at `p` empty (only blanks) or a `%` comment?
+ */
+inline bool is_empty_or_comment(const char* p, const char* end) {
+  skip_blanks(p, end);
+  return (p == end) || (*p == '\n') || (*p == '%');
+}
+
+/**
+ * @brief Parse an unsigned decimal integer, blanks before the number are
+ * skipped.
+ *
+ * @return true if at least one digit was consumed and the value fits.
+ */
+template <typename type_t>
+bool parse_unsigned(const char*& p, const char* end, type_t& value) {
+  skip_blanks(p, end);
+  if (p == end || !is_digit(*p))
+    return false;
+
+  std::uint64_t result = 0;
+  constexpr std::uint64_t cutoff = std::numeric_limits<std::uint64_t>::max() / 10;
+  while (p < end && is_digit(*p)) {
+    std::uint64_t digit = (std::uint64_t)(*p - '0');
+    if (result > cutoff || (result == cutoff && digit > 5))
+      return false;  // overflow
+    result = result * 10 + digit;
+    ++p;
+  }
+
+  if (result > (std::uint64_t)std::numeric_limits<type_t>::max())
+    return false;
+
+  value = (type_t)result;
+  return true;
+}
+
+/**
+ * @brief Parse a floating-point number in the plain C format
+ * (`[+-]digits[.digits][(e|E)[+-]digits]`), independent of the current locale.
+ * `inf` and `nan` are accepted as well. Up to 19 significant digits are kept,
+ * which is more than a `double` can represent. Short inputs take the exact
+ * (Clinger) fast path, everything else is evaluated in extended precision.
+ *
+ * @return true if a number was consumed.
+ */
+inline bool parse_real(const char*& p, const char* end, double& value) {
+  // Exact powers of ten representable as doubles.
+  static constexpr double powers_of_ten[] = {
+      1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+  skip_blanks(p, end);
+  if (p == end)
+    return false;
+
+  bool negative = false;
+  if (*p == '-' || *p == '+') {
+    negative = (*p == '-');
+    ++p;
+  }
+
+  // Special values (rare, keep it simple).
+  if (p < end && (*p == 'i' || *p == 'I' || *p == 'n' || *p == 'N')) {
+    auto starts_with = [&](const char* word) {
+      std::size_t n = std::strlen(word);
+      if ((std::size_t)(end - p) < n)
+        return false;
+      for (std::size_t i = 0; i < n; ++i)
+        if ((p[i] | 0x20) != word[i])
+          return false;
+      return true;
+    };
+
+    if (starts_with("infinity") || starts_with("inf")) {
+      p += starts_with("infinity") ? 8 : 3;
+      value = negative ? -std::numeric_limits<double>::infinity()
+                       : std::numeric_limits<double>::infinity();
+      return true;
+    }
+    if (starts_with("nan")) {
+      p += 3;
+      value = std::numeric_limits<double>::quiet_NaN();
+      return true;
+    }
+    return false;
+  }
+
+  std::uint64_t mantissa = 0;
+  int significant = 0;
+  int exponent = 0;
+  bool any_digit = false;
+
+  // Integral part.
+  while (p < end && is_digit(*p)) {
+    any_digit = true;
+    if (significant < 19) {
+      mantissa = mantissa * 10 + (std::uint64_t)(*p - '0');
+      if (mantissa)
+        ++significant;
+    } else {
+      ++exponent;  // dropped digit, scale up.
+    }
+    ++p;
+  }
+
+  // Fractional part.
+  if (p < end && *p == '.') {
+    ++p;
+    while (p < end && is_digit(*p)) {
+      any_digit = true;
+      if (significant < 19) {
+        mantissa = mantissa * 10 + (std::uint64_t)(*p - '0');
+        if (mantissa)
+          ++significant;
+        --exponent;
+      }
+      ++p;
+    }
+  }
+
+  if (!any_digit)
+    return false;
+
+  // Exponent.
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    const char* q = p + 1;
+    bool negative_exponent = false;
+    if (q < end && (*q == '-' || *q == '+')) {
+      negative_exponent = (*q == '-');
+      ++q;
+    }
+    if (q < end && is_digit(*q)) {
+      int e = 0;
+      while (q < end && is_digit(*q)) {
+        if (e < 100000)
+          e = e * 10 + (*q - '0');
+        ++q;
+      }
+      exponent += negative_exponent ? -e : e;
+      p = q;
+    }
+  }
+
+  double result;
+  if (mantissa <= (std::uint64_t(1) << 53) && exponent >= -22 &&
+      exponent <= 22) {
+    // Exact operands, a single (correctly) rounded operation.
+    result = (double)mantissa;
+    if (exponent > 0)
+      result *= powers_of_ten[exponent];
+    else if (exponent < 0)
+      result /= powers_of_ten[-exponent];
+  } else {
+    // Long mantissas, large exponents: use extended precision to keep the
+    // rounding error well below what a double can represent.
+    long double extended = (long double)mantissa;
+    if (mantissa != 0 && exponent != 0)
+      extended *= std::pow(10.0L, (long double)exponent);
+    result = (double)extended;
+  }
+
+  value = negative ? -result : result;
+  return true;
+}
+
+}  // namespace parse
+}  // namespace detail
+}  // namespace io
+}  // namespace gunrock
@@ -7,13 +7,22 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cassert>
 #include <cmath>
 #include <cstdio>
 #include <ctime>
+#include <iostream>
+#include <sstream>
+#include <string>
 #include <time.h>
+#include <typeindex>
 #include <vector>
 
 // RapidJSON includes (required)
+#ifndef RAPIDJSON_HAS_STDSTRING
+#define RAPIDJSON_HAS_STDSTRING 1
+#endif
 #include <rapidjson/document.h>
 #include <rapidjson/filewritestream.h>
 #include <rapidjson/prettywriter.h>
@@ -47,29 +56,38 @@ class json {
 
  public:
   /**
-   * @brief info default constructor
+   * @brief json default constructor
    */
-  info()
+  json()
       : _time_str(""),
         _application_name(""),
         _filename(""),
+        _file(nullptr),
         _stream(nullptr),
         _writer(nullptr),
-        _file(nullptr),
         _document(nullptr) {}
 
-  info(std::string application, std::string filename)
+  /**
+   * @brief json document of an application, see `write()`.
+   *
+   * @param application application name.
+   * @param filename output file, stdout if empty.
+   */
+  json(std::string application, std::string filename)
       : _time_str(""),
         _application_name(application),
         _filename(filename),
+        _file(nullptr),
         _stream(nullptr),
         _writer(nullptr),
-        _file(nullptr),
         _document(nullptr) {
     init();
   }
 
-  ~info() {
+  json(const json& rhs) = delete;
+  json& operator=(const json& rhs) = delete;
+
+  ~json() {
     _time_str = "";
     _application_name = "";
     _filename = "";
@@ -138,7 +156,7 @@ class json {
     // ever write incomplete files. With a FileWriteStream, rapidjson will
     // decide to start writing whenever the buffer we provide is full
     _stream = new buffer_t();
-    _writer = new writer_t(*stream);
+    _writer = new writer_t(*_stream);
 
     // Write the initial copy of the file with an invalid json-integrity
     /*
@@ -146,14 +164,19 @@ class json {
      */
 
     // Traverse the document for writing events
-    if (stream != NULL) {
-      _document->Accept(*writer);
-      assert(writer->IsComplete());
+    if (_stream != NULL) {
+      _document->Accept(*_writer);
+      assert(_writer->IsComplete());
     }
     if (_filename != "") {
       _file = std::fopen(_filename.c_str(), "w");
+      if (!_file) {
+        std::cerr << "Unable to open json file: " << _filename << std::endl;
+        exit(1);
+      }
       std::fputs(_stream->GetString(), _file);
       std::fclose(_file);
+      _file = nullptr;
     }
 
     // We now start over with a new stream and writer. We can't reuse them.
@@ -166,9 +189,43 @@ class json {
     _writer = new writer_t(*_stream);
 
     _document->SetObject();
-    /*
-     * @todo do stuff...
-     */
+    set_base_info();
+  }
+
+  /**
+   * @brief Attach the application name, the time of the run and the git SHA1
+   * of the build (see `util/gitsha1.hxx`).
+   */
+  void set_base_info() {
+    set_val("application", _application_name);
+    set_val("time", _time_str.substr(0, _time_str.find_last_not_of('\n') + 1));
+    set_val("git_sha1", std::string(g_GIT_SHA1));
+  }
+
+  /**
+   * @brief Write the document to the json file (stdout if there is none).
+   */
+  void write() {
+    if (_document == NULL)
+      return;
+
+    _stream->Clear();
+    _writer->Reset(*_stream);
+    _document->Accept(*_writer);
+
+    if (_filename == "") {
+      std::cout << _stream->GetString() << std::endl;
+      return;
+    }
+
+    _file = std::fopen(_filename.c_str(), "w");
+    if (!_file) {
+      std::cerr << "Unable to open json file: " << _filename << std::endl;
+      exit(1);
+    }
+    std::fputs(_stream->GetString(), _file);
+    std::fclose(_file);
+    _file = nullptr;
   }
 
   // Get values from the json document.
@@ -336,8 +393,40 @@ class json {
       std::string str = ostr.str();
 
       value_t key(name, _document->GetAllocator());
-      json_object.AddMember(key, str, _document->GetAllocator());
+      value_t value(str, _document->GetAllocator());
+      json_object.AddMember(key, value, _document->GetAllocator());
+    }
+  }
+
+  /**
+   * @brief Attach `vec` as an array, whatever its size (`set_val()` writes a
+   * vector of one item as that item). Use it for fields that are always
+   * arrays, such as per-repetition times.
+   */
+  template <typename T>
+  void set_array(std::string name,
+                 const std::vector<T>& vec,
+                 value_t& json_object) {
+    if (_document == NULL)
+      return;
+
+    value_t arr(rapidjson::kArrayType);
+    for (const T& i : vec) {
+      value_t val = get_val(i);
+
+      arr.PushBack(val, _document->GetAllocator());
     }
+
+    value_t key(name, _document->GetAllocator());
+    json_object.AddMember(key, arr, _document->GetAllocator());
+  }
+
+  template <typename T>
+  void set_array(std::string name, const std::vector<T>& vec) {
+    if (_document == NULL)
+      return;
+
+    set_array(name, vec, *_document);
   }
 
   template <typename T>
@@ -345,26 +434,16 @@ class json {
                const std::vector<T>& vec,
                value_t& json_object) {
     /*
-     * @todo update parameters to support "ALWAYS_ARRAY" type currently using a
-     * hack to make sure tag is always an array in JSON. This is also required
-     * for fields such as srcs, process-times, etc.
+     * @todo "tag" is always an array for compatibility; other fields that must
+     * always be arrays (srcs, process-times, etc.) use `set_array()`.
      */
     if (_document == NULL)
       return;
 
-    if (vec.size() == 1 && (name.compare("tag") != 0)) {
+    if (vec.size() == 1 && (name.compare("tag") != 0))
       set_val(name, vec.front(), json_object);
-    } else {
-      value_t arr(rapidjson::kArrayType);
-      for (const T& i : vec) {
-        value_t val = get_val(i);
-
-        arr.PushBack(val, _document->GetAllocator());
-      }
-
-      value_t key(name, _document->GetAllocator());
-      json_object.AddMember(key, arr, _document->GetAllocator());
-    }
+    else
+      set_array(name, vec, json_object);
   }
 
   template <typename T>
@@ -391,6 +470,48 @@ class json {
 
     set_val(name, val, *_document);
   }
+
+  /**
+   * @brief A new (empty) json object: fill it with `set_val(name, val,
+   * object)`, then attach it with `set_object()` or `append_object()`.
+   */
+  value_t new_object() const { return value_t(rapidjson::kObjectType); }
+
+  /**
+   * @brief Attach `object` (moved) as the member `name` of `json_object`.
+   */
+  void set_object(std::string name, value_t& object, value_t& json_object) {
+    if (_document == NULL)
+      return;
+
+    value_t key(name, _document->GetAllocator());
+    json_object.AddMember(key, object, _document->GetAllocator());
+  }
+
+  void set_object(std::string name, value_t& object) {
+    if (_document == NULL)
+      return;
+
+    set_object(name, object, *_document);
+  }
+
+  /**
+   * @brief Append `object` (moved) to the array `name` of the document,
+   * created on first use.
+   */
+  void append_object(std::string name, value_t& object) {
+    if (_document == NULL)
+      return;
+
+    auto member = _document->FindMember(name.c_str());
+    if (member == _document->MemberEnd()) {
+      value_t key(name, _document->GetAllocator());
+      value_t array(rapidjson::kArrayType);
+      _document->AddMember(key, array, _document->GetAllocator());
+      member = _document->FindMember(name.c_str());
+    }
+    member->value.PushBack(object, _document->GetAllocator());
+  }
   // set <end>
 
 };  // class json
@@ -0,0 +1,180 @@
+/**
+ * @file labels.hxx
+ * @brief Parallel loader for `.labels` (coordinates) files.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/util/type_limits.hxx>
+#include <gunrock/io/detail/parse.hxx>
+#include <gunrock/io/mapped_file.hxx>
+
+namespace gunrock {
+namespace io {
+
+/**
+ * @brief Reads a labels (coordinates) file into two dense arrays, latitudes
+ * and longitudes (structure of arrays).
+ *
+ * Here is an example of the labels file
+ * +-------------------------+
+ * |%%Labels Formatted File  | <-- header
+ * |%                        | <-+
+ * |% comments               |   |-- comments
+ * |%                        | <-+
+ * |  N L L                  | <-- num_nodes, num_labels, num_labels
+ * |  I0 L1A L1B             | <-- node id, latitude, longitude
+ * |  I4                     | <-- coordinates missing, populated as invalids
+ * |  I5 L5A L5B             |
+ * |  . . .                  |
+ * |  IN LNA LNB             |
+ * +-------------------------+
+ *
+ * @note Node ID (first column) must be 0-based, and less than `n`.
+ * @note If a Node ID is present but coordinates are missing, or the Node ID is
+ *       missing altogether, the coordinates are filled as invalids.
+ *
+ * @par Overview
+ * The file is memory-mapped and its body (after the size line) is split into
+ * line-aligned chunks parsed in parallel (OpenMP) with the locale-independent
+ * parsers of `detail::parse`, straight into the output arrays (every line
+ * names its node, so chunks need no offsets). See `matrix_market_t::load()`.
+ *
+ * @tparam vertex_t
+ * @tparam coordinate_t
+ */
+template <typename vertex_t, typename coordinate_t = float>
+struct labels_t {
+  std::string filename;
+  std::size_t number_of_nodes;  // N, from the size line.
+  std::size_t valid;            // lines with both coordinates.
+
+  labels_t() : number_of_nodes(0), valid(0) {}
+  ~labels_t() {}
+
+  /**
+   * @brief Load the coordinates of the nodes `[0, n)`; every other entry is
+   * invalid (`gunrock::numeric_limits<coordinate_t>::invalid()`).
+   *
+   * @param _filename input file name (.labels)
+   * @param n number of nodes (e.g. vertices of the graph).
+   * @param latitudes output, `n` latitudes.
+   * @param longitudes output, `n` longitudes.
+   * @return std::size_t number of nodes with valid coordinates.
+   */
+  std::size_t load(std::string _filename,
+                   vertex_t n,
+                   coordinate_t* latitudes,
+                   coordinate_t* longitudes) {
+    filename = _filename;
+    constexpr coordinate_t invalid =
+        gunrock::numeric_limits<coordinate_t>::invalid();
+
+#pragma omp parallel for schedule(static)
+    for (vertex_t v = 0; v < n; ++v) {
+      latitudes[v] = invalid;
+      longitudes[v] = invalid;
+    }
+
+    mapped_file_t mapped(filename, access_pattern_t::sequential);
+    const char* cursor = mapped.begin();
+    const char* end = mapped.end();
+
+    // Skip the header, comments and empty lines.
+    while (cursor < end && detail::parse::is_empty_or_comment(cursor, end))
+      detail::parse::skip_line(cursor, end);
+
+    std::uint64_t nodes, labels_x, labels_y;
+    if (!detail::parse::parse_unsigned(cursor, end, nodes) ||
+        !detail::parse::parse_unsigned(cursor, end, labels_x) ||
+        !detail::parse::parse_unsigned(cursor, end, labels_y)) {
+      std::cerr << "Could not read labels file info (N, L, L)" << std::endl;
+      exit(1);
+    }
+    detail::parse::skip_line(cursor, end);
+    number_of_nodes = nodes;
+
+    // Split the body into line-aligned chunks.
+    std::size_t body_size = end - cursor;
+    std::size_t minimum_chunk = 1 << 16;  // 64 KiB
+    std::size_t number_of_chunks = std::max<std::size_t>(
+        1, std::min<std::size_t>(4 * omp_get_max_threads(),
+                                 body_size / minimum_chunk));
+
+    std::vector<const char*> boundaries(number_of_chunks + 1);
+    boundaries[0] = cursor;
+    boundaries[number_of_chunks] = end;
+    for (std::size_t c = 1; c < number_of_chunks; ++c) {
+      const char* split = cursor + (body_size * c) / number_of_chunks;
+      if (split > cursor && split[-1] != '\n')
+        detail::parse::skip_line(split, end);
+      boundaries[c] = std::max(split, boundaries[c - 1]);
+    }
+
+    std::size_t valid_lines = 0;
+    std::vector<char> failed(number_of_chunks, 0);
+
+#pragma omp parallel for schedule(dynamic, 1) reduction(+ : valid_lines)
+    for (std::size_t c = 0; c < number_of_chunks; ++c) {
+      const char* chunk_end = boundaries[c + 1];
+      for (const char* p = boundaries[c]; p < chunk_end;) {
+        if (detail::parse::is_empty_or_comment(p, chunk_end)) {
+          detail::parse::skip_line(p, chunk_end);
+          continue;
+        }
+
+        std::uint64_t node;
+        double latitude, longitude;
+        if (!detail::parse::parse_unsigned(p, chunk_end, node) ||
+            node >= (std::uint64_t)n) {
+          failed[c] = 1;
+          break;
+        }
+
+        // Only the node id: coordinates stay invalid.
+        detail::parse::skip_blanks(p, chunk_end);
+        bool missing = (p == chunk_end) || (*p == '\n');
+        if (!missing &&
+            (!detail::parse::parse_real(p, chunk_end, latitude) ||
+             !detail::parse::parse_real(p, chunk_end, longitude))) {
+          failed[c] = 1;
+          break;
+        }
+        detail::parse::skip_line(p, chunk_end);
+
+        if (!missing) {
+          latitudes[node] = (coordinate_t)latitude;
+          longitudes[node] = (coordinate_t)longitude;
+          ++valid_lines;
+        }
+      }
+    }
+
+    for (std::size_t c = 0; c < number_of_chunks; ++c) {
+      if (failed[c]) {
+        std::cerr << "Invalid coordinates file format: " << filename
+                  << std::endl;
+        exit(1);
+      }
+    }
+
+    valid = valid_lines;
+    return valid;
+  }
+};
+
+}  // namespace io
+}  // namespace gunrock
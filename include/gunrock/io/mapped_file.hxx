@@ -0,0 +1,150 @@
+/**
+ * @file mapped_file.hxx
+ * @brief Read-only memory-mapped files, used by the loaders to parse (or view)
+ * an input file in place instead of streaming it through `stdio`.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <iostream>
+#include <cstdlib>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace gunrock {
+namespace io {
+
+/**
+ * @brief Access pattern hint passed to the kernel (`madvise`) for a mapping.
+ */
+enum access_pattern_t { normal, sequential, random };
+
+/**
+ * @brief A read-only, private memory mapping of an entire file. The mapping
+ * lives as long as the object does; views (raw pointers) into the mapping
+ * must not outlive it.
+ *
+ * @par Overview
+ * Mapping a file costs a couple of system calls, pages are brought in lazily
+ * on first touch. This makes it the right tool for both parsing large text
+ * inputs with many threads (each thread faults in its own chunk) and for
+ * opening binary formats without copying them into freshly allocated arrays.
+ */
+class mapped_file_t {
+ public:
+  mapped_file_t() : descriptor(-1), pointer(nullptr), length(0) {}
+
+  mapped_file_t(std::string const& filename,
+                access_pattern_t pattern = access_pattern_t::normal)
+      : mapped_file_t() {
+    open(filename, pattern);
+  }
+
+  ~mapped_file_t() { close(); }
+
+  /*! Disable copy ctor and assignment operator. The mapping is owned by
+   * exactly one object, share it through a `std::shared_ptr` if needed.
+   */
+  mapped_file_t(const mapped_file_t& rhs) = delete;
+  mapped_file_t& operator=(const mapped_file_t& rhs) = delete;
+
+  /**
+   * @brief Map the file `filename` into memory (read-only).
+   *
+   * @param filename path to the file.
+   * @param pattern access pattern hint, see `access_pattern_t`.
+   */
+  void open(std::string const& filename,
+            access_pattern_t pattern = access_pattern_t::normal) {
+    close();
+
+    if ((descriptor = ::open(filename.c_str(), O_RDONLY)) < 0) {
+      std::cerr << "File could not be opened: " << filename << std::endl;
+      exit(1);
+    }
+
+    struct stat status;
+    if (fstat(descriptor, &status) != 0) {
+      std::cerr << "Could not stat file: " << filename << std::endl;
+      exit(1);
+    }
+
+    length = (std::size_t)status.st_size;
+
+    // Zero-sized mappings are not allowed, an empty file is an empty view.
+    if (length == 0)
+      return;
+
+    void* address =
+        mmap(nullptr, length, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (address == MAP_FAILED) {
+      std::cerr << "File could not be memory-mapped: " << filename << std::endl;
+      exit(1);
+    }
+
+    pointer = static_cast<char*>(address);
+    advise(pattern);
+  }
+
+  /**
+   * @brief Unmap the file and close the descriptor (safe to call twice).
+   */
+  void close() {
+    if (pointer)
+      munmap(pointer, length);
+    if (descriptor >= 0)
+      ::close(descriptor);
+
+    descriptor = -1;
+    pointer = nullptr;
+    length = 0;
+  }
+
+  /**
+   * @brief Hint the kernel about how the mapping (or a range of it) is going to
+   * be accessed. Sequential access enables aggressive read-ahead.
+   *
+   * @param pattern access pattern hint.
+   * @param offset offset (in bytes) of the range, rounded down to a page.
+   * @param bytes size of the range (0 = until the end of the file).
+   */
+  void advise(access_pattern_t pattern,
+              std::size_t offset = 0,
+              std::size_t bytes = 0) const {
+    if (!pointer)
+      return;
+
+    std::size_t page = (std::size_t)sysconf(_SC_PAGESIZE);
+    std::size_t begin = (offset / page) * page;
+    std::size_t end = (bytes == 0) ? length : std::min(length, offset + bytes);
+
+    int advice = (pattern == access_pattern_t::sequential) ? MADV_SEQUENTIAL
+                 : (pattern == access_pattern_t::random)   ? MADV_RANDOM
+                                                           : MADV_NORMAL;
+    madvise(pointer + begin, end - begin, advice);
+  }
+
+  const char* data() const { return pointer; }
+  const char* begin() const { return pointer; }
+  const char* end() const { return pointer + length; }
+  std::size_t size() const { return length; }
+  bool is_open() const { return descriptor >= 0; }
+
+ private:
+  int descriptor;
+  char* pointer;
+  std::size_t length;
+};  // class mapped_file_t
+
+}  // namespace io
+}  // namespace gunrock
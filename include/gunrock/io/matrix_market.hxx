@@ -11,9 +11,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <string>
+#include <vector>
+
+#include <omp.h>
 
 #include <gunrock/io/detail/mmio.hxx>
+#include <gunrock/io/detail/parse.hxx>
+#include <gunrock/io/mapped_file.hxx>
 
 #include <gunrock/util/filepath.hxx>
 #include <gunrock/formats/formats.hxx>
@@ -91,10 +100,24 @@ struct matrix_market_t {
    * coordinate array. This needs to be further extended to support dense
    * arrays, those are the only two formats mtx are written in.
    *
+   * @par Overview
+   * The file is memory-mapped and its body (everything after the size line) is
+   * split into line-aligned chunks that are parsed in parallel (OpenMP) with a
+   * locale-independent parser. A first, cheap pass counts the entries of every
+   * chunk so each chunk knows where its entries land in the output; the second
+   * pass parses straight into a pre-sized COO. Symmetric matrices are mirrored
+   * within that same pass (the COO is sized for the worst case, `2 * L`, and
+   * the slots left empty by diagonal entries are squeezed out at the end). The
+   * size line is read as 64-bit integers, so `edge_t = int64_t` works for
+   * inputs with more than 2^31 nonzeros.
+   *
    * @param _filename input file name (.mtx)
    * @return coordinate sparse format
    */
   auto load(std::string _filename) {
+    using coo_type =
+        format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+
     filename = _filename;
     dataset = util::extract_dataset(util::extract_filename(filename));
 
@@ -111,100 +134,202 @@ struct matrix_market_t {
       exit(1);
     }
 
-    int num_rows, num_columns, num_nonzeros;  // XXX: requires all ints intially
-    if ((mm_read_mtx_crd_size(file, &num_rows, &num_columns, &num_nonzeros)) !=
-        0) {
-      std::cerr << "Could not read file info (M, N, NNZ)" << std::endl;
-      exit(1);
-    }
-
-    // mtx are generally written as coordinate formaat
-    format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t> coo(
-        (vertex_t)num_rows, (vertex_t)num_columns, (edge_t)num_nonzeros);
+    fclose(file);
 
     if (mm_is_coordinate(code))
       format = matrix_market_format_t::coordinate;
     else
       format = matrix_market_format_t::array;
 
-    if (mm_is_pattern(code)) {
+    if (mm_is_pattern(code))
       data = matrix_market_data_t::pattern;
+    else if (mm_is_real(code))
+      data = matrix_market_data_t::real;
+    else if (mm_is_integer(code))
+      data = matrix_market_data_t::integer;
+    else {
+      std::cerr << "Unrecognized matrix market format type" << std::endl;
+      exit(1);
+    }
 
-      // pattern matrix defines sparsity pattern, but not values
-      for (vertex_t i = 0; i < num_nonzeros; ++i) {
-        assert(fscanf(file, " %d %d \n", &(coo.row_indices[i]),
-                      &(coo.column_indices[i])) == 2);
-        coo.row_indices[i]--;  // adjust from 1-based to 0-based indexing
-        coo.column_indices[i]--;
-        coo.nonzero_values[i] =
-            (weight_t)1.0;  // use value 1.0 for all nonzero entries
-      }
-    } else if (mm_is_real(code) || mm_is_integer(code)) {
-      if (mm_is_real(code))
-        data = matrix_market_data_t::real;
-      else
-        data = matrix_market_data_t::integer;
+    if (mm_is_symmetric(code))
+      scheme = matrix_market_storage_scheme_t::symmetric;
+    else if (mm_is_skew(code))
+      scheme = matrix_market_storage_scheme_t::skew;
+    else if (mm_is_hermitian(code))
+      scheme = matrix_market_storage_scheme_t::hermitian;
+    else
+      scheme = matrix_market_storage_scheme_t::general;
 
-      for (vertex_t i = 0; i < coo.number_of_nonzeros; ++i) {
-        vertex_t I, J;
-        double V;  // always read in a double and convert later if necessary
+    if (format != matrix_market_format_t::coordinate) {
+      std::cerr << "Dense (array) matrix market files are not supported"
+                << std::endl;
+      exit(1);
+    }
 
-        assert(fscanf(file, " %d %d %lf \n", &I, &J, &V) == 3);
+    // Map the whole file, the banner was already validated above.
+    mapped_file_t mapped(filename, access_pattern_t::sequential);
+    const char* cursor = mapped.begin();
+    const char* end = mapped.end();
+
+    // Skip the banner, comments and empty lines.
+    detail::parse::skip_line(cursor, end);
+    while (cursor < end && detail::parse::is_empty_or_comment(cursor, end))
+      detail::parse::skip_line(cursor, end);
+
+    // XXX: used to require all ints intially, the size line is now 64-bit.
+    std::uint64_t num_rows, num_columns, num_nonzeros;
+    if (!detail::parse::parse_unsigned(cursor, end, num_rows) ||
+        !detail::parse::parse_unsigned(cursor, end, num_columns) ||
+        !detail::parse::parse_unsigned(cursor, end, num_nonzeros)) {
+      std::cerr << "Could not read file info (M, N, NNZ)" << std::endl;
+      exit(1);
+    }
+    detail::parse::skip_line(cursor, end);
+
+    bool symmetric = (scheme == matrix_market_storage_scheme_t::symmetric);
+    std::uint64_t capacity = symmetric ? 2 * num_nonzeros : num_nonzeros;
 
-        coo.row_indices[i] = (vertex_t)I - 1;
-        coo.column_indices[i] = (vertex_t)J - 1;
-        coo.nonzero_values[i] = (weight_t)V;
+    if (num_rows > (std::uint64_t)std::numeric_limits<vertex_t>::max() ||
+        num_columns > (std::uint64_t)std::numeric_limits<vertex_t>::max() ||
+        num_nonzeros > (std::uint64_t)std::numeric_limits<edge_t>::max()) {
+      std::cerr << "Matrix dimensions do not fit in vertex_t/edge_t"
+                << std::endl;
+      exit(1);
+    }
+
+    // mtx are generally written as coordinate formaat, sized for the worst
+    // case (every symmetric entry is off-diagonal).
+    coo_type coo((vertex_t)num_rows, (vertex_t)num_columns, (edge_t)0);
+    coo.row_indices.resize(capacity);
+    coo.column_indices.resize(capacity);
+    coo.nonzero_values.resize(capacity);
+
+    // Split the body into line-aligned chunks.
+    std::size_t body_size = end - cursor;
+    std::size_t minimum_chunk = 1 << 16;  // 64 KiB
+    std::size_t number_of_chunks = std::max<std::size_t>(
+        1, std::min<std::size_t>(4 * omp_get_max_threads(),
+                                 body_size / minimum_chunk));
+
+    std::vector<const char*> boundaries(number_of_chunks + 1);
+    boundaries[0] = cursor;
+    boundaries[number_of_chunks] = end;
+    for (std::size_t c = 1; c < number_of_chunks; ++c) {
+      const char* split = cursor + (body_size * c) / number_of_chunks;
+      // Start at the beginning of the next line.
+      if (split > cursor && split[-1] != '\n')
+        detail::parse::skip_line(split, end);
+      boundaries[c] = std::max(split, boundaries[c - 1]);
+    }
+
+    // Pass 1: count the entries of every chunk.
+    std::vector<std::uint64_t> entries(number_of_chunks + 1, 0);
+#pragma omp parallel for schedule(dynamic, 1)
+    for (std::size_t c = 0; c < number_of_chunks; ++c) {
+      std::uint64_t count = 0;
+      for (const char* p = boundaries[c]; p < boundaries[c + 1];) {
+        if (!detail::parse::is_empty_or_comment(p, boundaries[c + 1]))
+          ++count;
+        detail::parse::skip_line(p, boundaries[c + 1]);
       }
-    } else {
-      std::cerr << "Unrecognized matrix market format type" << std::endl;
+      entries[c + 1] = count;
+    }
+
+    for (std::size_t c = 0; c < number_of_chunks; ++c)
+      entries[c + 1] += entries[c];
+
+    if (entries[number_of_chunks] != num_nonzeros) {
+      std::cerr << "Expected " << num_nonzeros << " entries, found "
+                << entries[number_of_chunks] << std::endl;
       exit(1);
     }
 
-    if (mm_is_symmetric(code)) {  // duplicate off diagonal entries
-      scheme = matrix_market_storage_scheme_t::symmetric;
-      vertex_t off_diagonals = 0;
-      for (vertex_t i = 0; i < coo.number_of_nonzeros; ++i) {
-        if (coo.row_indices[i] != coo.column_indices[i])
-          ++off_diagonals;
+    // Pass 2: parse (and mirror) every chunk into its slice of the COO.
+    vertex_t* I = coo.row_indices.data();
+    vertex_t* J = coo.column_indices.data();
+    weight_t* V = coo.nonzero_values.data();
+
+    bool pattern = (data == matrix_market_data_t::pattern);
+    std::vector<std::uint64_t> written(number_of_chunks, 0);
+    std::vector<char> failed(number_of_chunks, 0);
+
+#pragma omp parallel for schedule(dynamic, 1)
+    for (std::size_t c = 0; c < number_of_chunks; ++c) {
+      std::uint64_t position = symmetric ? 2 * entries[c] : entries[c];
+      std::uint64_t first = position;
+      const char* chunk_end = boundaries[c + 1];
+
+      for (const char* p = boundaries[c]; p < chunk_end;) {
+        if (detail::parse::is_empty_or_comment(p, chunk_end)) {
+          detail::parse::skip_line(p, chunk_end);
+          continue;
+        }
+
+        std::uint64_t i, j;
+        double v = 1.0;  // use value 1.0 for all pattern entries
+        if (!detail::parse::parse_unsigned(p, chunk_end, i) ||
+            !detail::parse::parse_unsigned(p, chunk_end, j) ||
+            (!pattern && !detail::parse::parse_real(p, chunk_end, v)) ||
+            (i < 1) || (i > num_rows) || (j < 1) || (j > num_columns)) {
+          failed[c] = 1;
+          break;
+        }
+        detail::parse::skip_line(p, chunk_end);
+
+        // adjust from 1-based to 0-based indexing
+        I[position] = (vertex_t)(i - 1);
+        J[position] = (vertex_t)(j - 1);
+        V[position] = (weight_t)v;
+        ++position;
+
+        // duplicate off diagonal entries
+        if (symmetric && (i != j)) {
+          I[position] = (vertex_t)(j - 1);
+          J[position] = (vertex_t)(i - 1);
+          V[position] = (weight_t)v;
+          ++position;
+        }
       }
+      written[c] = position - first;
+    }
+
+    for (std::size_t c = 0; c < number_of_chunks; ++c) {
+      if (failed[c]) {
+        std::cerr << "Could not parse entry (I, J[, V]) in: " << filename
+                  << std::endl;
+        exit(1);
+      }
+    }
 
-      vertex_t _nonzeros =
-          2 * off_diagonals + (coo.number_of_nonzeros - off_diagonals);
-
-      vector_t<vertex_t, memory_space_t::host> new_I(_nonzeros);
-      vector_t<vertex_t, memory_space_t::host> new_J(_nonzeros);
-      vector_t<weight_t, memory_space_t::host> new_V(_nonzeros);
-
-      vertex_t* _I = new_I.data();
-      vertex_t* _J = new_J.data();
-      weight_t* _V = new_V.data();
-
-      vertex_t ptr = 0;
-      for (vertex_t i = 0; i < coo.number_of_nonzeros; ++i) {
-        if (coo.row_indices[i] != coo.column_indices[i]) {
-          _I[ptr] = coo.row_indices[i];
-          _J[ptr] = coo.column_indices[i];
-          _V[ptr] = coo.nonzero_values[i];
-          ++ptr;
-          _J[ptr] = coo.row_indices[i];
-          _I[ptr] = coo.column_indices[i];
-          _V[ptr] = coo.nonzero_values[i];
-          ++ptr;
-        } else {
-          _I[ptr] = coo.row_indices[i];
-          _J[ptr] = coo.column_indices[i];
-          _V[ptr] = coo.nonzero_values[i];
-          ++ptr;
+    std::uint64_t total = num_nonzeros;
+    if (symmetric) {
+      // Squeeze out the slots left empty by diagonal entries. Destinations
+      // never pass their sources, so an in-order sweep is safe.
+      total = 0;
+      for (std::size_t c = 0; c < number_of_chunks; ++c) {
+        std::uint64_t source = 2 * entries[c];
+        if (source != total) {
+          std::memmove(I + total, I + source, written[c] * sizeof(vertex_t));
+          std::memmove(J + total, J + source, written[c] * sizeof(vertex_t));
+          std::memmove(V + total, V + source, written[c] * sizeof(weight_t));
         }
+        total += written[c];
       }
-      coo.row_indices = new_I;
-      coo.column_indices = new_J;
-      coo.nonzero_values = new_V;
-      coo.number_of_nonzeros = _nonzeros;
-    }  // end symmetric case
 
-    fclose(file);
+      if (total > (std::uint64_t)std::numeric_limits<edge_t>::max()) {
+        std::cerr << "Number of (mirrored) nonzeros does not fit in edge_t"
+                  << std::endl;
+        exit(1);
+      }
+
+      // Shrinking does not reallocate.
+      coo.row_indices.resize(total);
+      coo.column_indices.resize(total);
+      coo.nonzero_values.resize(total);
+    }  // end symmetric case
 
+    coo.number_of_nonzeros = (edge_t)total;
     return coo;
   }
 };
@@ -1 +1,3 @@
-extern const char g_GIT_SHA1[];
\ No newline at end of file
+#pragma once
+
+extern "C" const char g_GIT_SHA1[];
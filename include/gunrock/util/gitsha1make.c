@@ -1,5 +0,0 @@
-#ifndef GIT_SHA1
-#define GIT_SHA1 "GIT-SHA-NOT-FOUND"
-#endif
-
-const char g_GIT_SHA1[] = GIT_SHA1;
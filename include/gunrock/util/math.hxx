@@ -10,6 +10,7 @@
 #include <cmath>
 #include <cstdlib>
 #include <functional>
+#include <type_traits>
 
 #include <gunrock/cuda/atomic_functions.hxx>
 
@@ -63,7 +64,9 @@ constexpr const type_t& min(const type_t& a, const type_t& b) {
 /**
  * @brief namespace atomic, for atomic operations supported on both host and
  * device. In concurrent programming, it means that there will be no context
- * switch during it - nothing can affect the execution of atomic command.
+ * switch during it - nothing can affect the execution of atomic command. On
+ * the host, these use the GCC/Clang `__atomic` builtins (relaxed ordering for
+ * the arithmetic operations), so they are safe to use from OpenMP threads.
  *
  */
 namespace atomic {
@@ -73,10 +76,17 @@ __host__ __device__ __forceinline__ type_t add(type_t* address, type_t value) {
 #ifdef __CUDA_ARCH__
   return atomicAdd(address, value);
 #else
-  // use std::atomic::fetch_add();
-  auto old_value = *address;
-  *address += value;
-  return old_value;
+  if constexpr (std::is_integral_v<type_t>) {
+    return __atomic_fetch_add(address, value, __ATOMIC_RELAXED);
+  } else {
+    type_t old_value, new_value;
+    __atomic_load(address, &old_value, __ATOMIC_RELAXED);
+    do {
+      new_value = old_value + value;
+    } while (!__atomic_compare_exchange(address, &old_value, &new_value, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    return old_value;
+  }
 #endif
 }
 
@@ -85,7 +95,13 @@ __host__ __device__ __forceinline__ type_t min(type_t* address, type_t value) {
 #ifdef __CUDA_ARCH__
   return cuda::atomicMin(address, value);
 #else
-  return std::min<type_t>(*address, value);  // use std::atomic;
+  type_t old_value;
+  __atomic_load(address, &old_value, __ATOMIC_RELAXED);
+  while (value < old_value &&
+         !__atomic_compare_exchange(address, &old_value, &value, true,
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+    ;
+  return old_value;
 #endif
 }
 
@@ -96,9 +112,9 @@ __host__ __device__ __forceinline__ type_t cas(type_t* address,
 #ifdef __CUDA_ARCH__
   return atomicCAS(address, compare, value);
 #else
-  type_t old = *address;
-  *address = (old == compare) ? value : old;  // use std::atomic;
-  return old;
+  __atomic_compare_exchange(address, &compare, &value, false, __ATOMIC_ACQ_REL,
+                            __ATOMIC_ACQUIRE);
+  return compare;  // holds the old value on failure.
 #endif
 }
 
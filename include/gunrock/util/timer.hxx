@@ -1,7 +1,8 @@
 /**
  * @file timer.hxx
  * @author Muhammad Osama (mosama@ucdavis.edu)
- * @brief Simple timer utility for device side code.
+ * @brief Simple timer utilities for device (CUDA events) and host
+ * (`std::chrono`) side code.
  * @version 0.1
  * @date 2020-10-05
  *
@@ -11,6 +12,8 @@
 
 #pragma once
 
+#include <chrono>
+
 namespace gunrock {
 namespace util {
 
@@ -47,5 +50,34 @@ struct timer_t {
   cudaEvent_t start_, stop_;
 };
 
+/**
+ * @brief Timer with the interface of `timer_t`, on the host's steady clock:
+ * no CUDA calls, usable on hosts without a GPU and for host code (it does not
+ * wait for the device).
+ */
+struct host_timer_t {
+  using clock_t = std::chrono::steady_clock;
+
+  float time;
+
+  host_timer_t() : time(0), start_(clock_t::now()) {}
+
+  // Alias of each other, start the timer.
+  void begin() { start_ = clock_t::now(); }
+  void start() { this->begin(); }
+
+  float end() {
+    time = std::chrono::duration<float, std::milli>(clock_t::now() - start_)
+               .count();
+    return milliseconds();
+  }
+
+  float seconds() { return time * 1e-3; }
+  float milliseconds() { return time; }
+
+ private:
+  clock_t::time_point start_;
+};
+
 }  // namespace util
 }  // namespace gunrock
\ No newline at end of file
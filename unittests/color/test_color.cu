@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/applications/application.hxx>
+#include <gunrock/applications/cpu/color.hxx>
+#include <gunrock/algorithms/generate/graphs.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+/**
+ * @brief Sequential greedy coloring, in `order`: what a single-threaded run
+ * must produce, in one round.
+ */
+template <typename graph_t>
+std::vector<vertex_t> greedy(graph_t& G, std::vector<vertex_t> const& order) {
+  vertex_t n = G.get_number_of_vertices();
+  std::vector<vertex_t> colors(n, -1), forbidden(n + 1, -1);
+  for (vertex_t v : order) {
+    for (auto e = G.get_row_offsets()[v]; e < G.get_row_offsets()[v + 1]; ++e)
+      if (colors[G.get_column_indices()[e]] != -1)
+        forbidden[colors[G.get_column_indices()[e]]] = v;
+    vertex_t c = 0;
+    while (forbidden[c] == v)
+      ++c;
+    colors[v] = c;
+  }
+  return colors;
+}
+
+template <typename graph_t>
+void test_graph(std::string name,
+                graph_t& G,
+                color::cpu::ordering_t ordering,
+                int threads) {
+  vertex_t n = G.get_number_of_vertices();
+  auto Ap = G.get_row_offsets();
+  auto Aj = G.get_column_indices();
+
+  std::vector<vertex_t> colors(n);
+  color::cpu::stats_t<vertex_t> stats;
+  color::cpu::options_t options;
+  options.ordering = ordering;
+
+  int max_threads = omp_get_max_threads();
+  omp_set_num_threads(threads);
+  color::cpu::run(G, colors.data(), &stats, options);
+  omp_set_num_threads(max_threads);
+
+  // Proper: every vertex colored, no edge (other than self loops) within a
+  // color class, at most max degree + 1 colors.
+  bool passed = true;
+  edge_t max_degree = 0;
+  vertex_t max_color = -1;
+  for (vertex_t v = 0; v < n; ++v) {
+    max_degree = std::max(max_degree, Ap[v + 1] - Ap[v]);
+    max_color = std::max(max_color, colors[v]);
+    passed = passed && (colors[v] >= 0);
+    for (auto e = Ap[v]; e < Ap[v + 1]; ++e)
+      passed = passed && (Aj[e] == v || colors[Aj[e]] != colors[v]);
+  }
+  passed = passed && (stats.colors == max_color + 1) &&
+           (stats.colors <= max_degree + 1);
+
+  // Every round's conflicts are the next round's worklist; the last is empty.
+  passed = passed && (stats.rounds == (int)stats.worklists.size()) &&
+           (stats.worklists[0] == (std::size_t)n) &&
+           (stats.conflicts.back() == 0);
+  for (int r = 0; r + 1 < stats.rounds; ++r)
+    passed = passed && (stats.conflicts[r] == stats.worklists[r + 1]);
+
+  // Single thread: the sequential greedy coloring, without conflicts.
+  if (threads == 1) {
+    std::vector<vertex_t> order(n);
+    for (vertex_t v = 0; v < n; ++v)
+      order[v] = v;
+    if (ordering == color::cpu::largest_degree_first)
+      std::stable_sort(order.begin(), order.end(), [&](auto u, auto v) {
+        return Ap[u + 1] - Ap[u] > Ap[v + 1] - Ap[v];
+      });
+    passed = passed && (stats.rounds == 1) && (colors == greedy(G, order));
+  }
+
+  std::cout << name << " ("
+            << (ordering == color::cpu::natural ? "natural"
+                                                : "largest degree first")
+            << ", " << threads << " threads): " << stats.colors
+            << " colors in " << stats.rounds << " rounds, conflicts:";
+  for (auto c : stats.conflicts)
+    std::cout << " " << c;
+  std::cout << std::endl;
+  std::cout << name << ": " << (passed ? "PASSED" : "FAILED") << std::endl;
+  if (!passed)
+    exit(1);
+}
+
+void test_color(int num_arguments, char** argument_array) {
+  int scale = (num_arguments > 1) ? std::stoi(argument_array[1]) : 14;
+
+  // Undirected, with self loops and duplicate edges.
+  algo::generate::rmat_properties_t properties;
+  properties.symmetric = true;
+  algo::generate::rmat_t<vertex_t, edge_t, weight_t> rmat(scale, 8, 27,
+                                                          properties);
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  csr.from_coo(algo::generate::to_coo(rmat));
+
+  auto G = graph::build::from_csr<memory_space_t::host, graph::view_t::csr>(
+      csr.number_of_rows,           // rows
+      csr.number_of_columns,        // columns
+      csr.number_of_nonzeros,       // nonzeros
+      csr.row_offsets.data(),       // row_offsets
+      csr.column_indices.data(),    // column_indices
+      csr.nonzero_values.data());   // values
+
+  for (int threads : {1, 4, 16})
+    for (auto ordering :
+         {color::cpu::natural, color::cpu::largest_degree_first})
+      test_graph("R-MAT", G, ordering, threads);
+}
+
+int main(int argc, char** argv) {
+  test_color(argc, argv);
+}
@@ -0,0 +1,119 @@
+#include <chrono>
+#include <cstdio>
+
+#include <gunrock/error.hxx>             // error checking
+#include <gunrock/graph/graph.hxx>       // graph class
+#include <gunrock/formats/formats.hxx>   // formats (csr, compressed csr)
+#include <gunrock/memory.hxx>            // memory space
+#include <gunrock/io/matrix_market.hxx>  // matrix_market support
+
+void test_compressed_csr(int num_arguments, char** argument_array) {
+  if (num_arguments != 2) {
+    std::cerr << "usage: ./test_compressed_csr filename.mtx"
+              << " (e.g. datasets/chesapeake.mtx)" << std::endl;
+    exit(1);
+  }
+
+  std::string filename = argument_array[1];
+
+  using namespace gunrock;
+  using namespace memory;
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  csr.from_coo(mm.load(filename), format::build_properties_t(true /* sort */));
+
+  std::size_t csr_bytes = (csr.row_offsets.size() * sizeof(edge_t)) +
+                          (csr.column_indices.size() * sizeof(vertex_t));
+
+  for (auto compression :
+       {format::compression_t::varint, format::compression_t::bitpacked}) {
+    using clock_t = std::chrono::high_resolution_clock;
+    format::compressed_csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>
+        C;
+
+    auto t0 = clock_t::now();
+    C.from_csr(csr, compression);
+    auto t1 = clock_t::now();
+    format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> decoded;
+    C.to_csr(decoded);
+    auto t2 = clock_t::now();
+
+    auto medges = [&](auto begin, auto end) {
+      double seconds = std::chrono::duration<double>(end - begin).count();
+      return (double)csr.number_of_nonzeros / (seconds * 1e6);
+    };
+
+    std::cout << "Compression = "
+              << ((compression == format::compression_t::varint) ? "varint"
+                                                                  : "bitpacked")
+              << std::endl;
+    std::cout << "  Ratio (structure) = "
+              << (double)csr_bytes / C.get_size_in_bytes(false) << std::endl;
+    std::cout << "  Encode (Medges/s) = " << medges(t0, t1) << std::endl;
+    std::cout << "  Decode (Medges/s) = " << medges(t1, t2) << std::endl;
+
+    // Round trip.
+    bool passed = (decoded.row_offsets == csr.row_offsets) &&
+                  (decoded.column_indices == csr.column_indices) &&
+                  (decoded.nonzero_values == csr.nonzero_values);
+
+    // Streaming builders: the same encoding, from a sorted COO and from a
+    // binary CSR file.
+    format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t> coo(
+        csr.number_of_rows, csr.number_of_columns, csr.number_of_nonzeros);
+    for (vertex_t v = 0; v < csr.number_of_rows; ++v)
+      for (edge_t e = csr.row_offsets[v]; e < csr.row_offsets[v + 1]; ++e) {
+        coo.row_indices[e] = v;
+        coo.column_indices[e] = csr.column_indices[e];
+        coo.nonzero_values[e] = csr.nonzero_values[e];
+      }
+    std::string binary = "test_compressed_csr.csr";
+    format::binary::write(binary, csr.number_of_rows, csr.number_of_columns,
+                          csr.number_of_nonzeros, csr.row_offsets.data(),
+                          csr.column_indices.data(),
+                          csr.nonzero_values.data());
+
+    format::compressed_csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>
+        S, B;
+    S.from_sorted_coo(coo, compression);
+    B.from_binary(binary, compression);
+    std::remove(binary.c_str());
+    for (auto const* other : {&S, &B})
+      passed = passed && (other->adjacency == C.adjacency) &&
+               (other->edge_samples == C.edge_samples) &&
+               (other->byte_samples == C.byte_samples) &&
+               (other->nonzero_values == C.nonzero_values);
+
+    // Graph view.
+    auto G = graph::build::from_compressed_csr<memory_space_t::host,
+                                               graph::view_t::compressed_csr>(
+        C);
+    for (vertex_t v = 0; passed && v < csr.number_of_rows; ++v) {
+      edge_t start = csr.row_offsets[v];
+      passed = (G.get_number_of_neighbors(v) ==
+                csr.row_offsets[v + 1] - start) &&
+               (G.get_starting_edge(v) == start);
+      G.for_each_neighbor(v, [&](vertex_t const& n, edge_t const& e) {
+        passed = passed && (e < csr.row_offsets[v + 1]) &&
+                 (csr.column_indices[e] == n) &&
+                 (G.get_edge_weight(e) == csr.nonzero_values[e]) &&
+                 (G.get_source_vertex(e) == v) &&
+                 (G.get_destination_vertex(e) == n) && (G.get_edge(v, n) == e);
+      });
+    }
+
+    std::cout << "Compressed CSR: " << (passed ? "PASSED" : "FAILED")
+              << std::endl;
+    if (!passed)
+      exit(1);
+  }
+}
+
+int main(int argc, char** argv) {
+  test_compressed_csr(argc, argv);
+}
@@ -1,3 +1,8 @@
+#include <map>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #include <gunrock/error.hxx>             // error checking
 #include <gunrock/formats/formats.hxx>   // formats (csr, coo)
 #include <gunrock/memory.hxx>            // memory space
@@ -26,8 +31,24 @@ void test_coo_to_csr(int num_arguments, char** argument_array) {
               << " = " << coo.nonzero_values[i] << std::endl;
   }
 
+  // Add a duplicate of every entry, merged back (summed) by the builder.
+  auto n = coo.number_of_nonzeros;
+  coo.row_indices.resize(2 * n);
+  coo.column_indices.resize(2 * n);
+  coo.nonzero_values.resize(2 * n);
+  for (edge_t i = 0; i < n; ++i) {
+    coo.row_indices[n + i] = coo.row_indices[i];
+    coo.column_indices[n + i] = coo.column_indices[i];
+    coo.nonzero_values[n + i] = coo.nonzero_values[i];
+  }
+  coo.number_of_nonzeros = 2 * n;
+
   format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
-  csr = coo;
+  format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t> csc;
+  format::from_coo(coo, csr, csc,
+                   format::build_properties_t(true /* sort */,
+                                              true /* merge duplicates */),
+                   format::reduce::plus_t());
 
   std::cout << "Row offsets: ";
   for (auto offset : csr.row_offsets)
@@ -43,8 +64,102 @@ void test_coo_to_csr(int num_arguments, char** argument_array) {
   for (auto nz : csr.nonzero_values)
     std::cout << nz << " ";
   std::cout << std::endl;
+
+  // Every row is sorted, holds no duplicates and is the transpose of the CSC.
+  bool passed = (csr.number_of_nonzeros == n) && (csc.number_of_nonzeros == n);
+  for (vertex_t r = 0; passed && r < csr.number_of_rows; ++r) {
+    for (edge_t e = csr.row_offsets[r]; passed && e < csr.row_offsets[r + 1];
+         ++e) {
+      vertex_t c = csr.column_indices[e];
+      passed = (e == csr.row_offsets[r] || csr.column_indices[e - 1] < c);
+
+      bool found = false;
+      for (edge_t k = csc.column_offsets[c]; k < csc.column_offsets[c + 1]; ++k)
+        if (csc.row_indices[k] == r)
+          found = (csc.nonzero_values[k] == csr.nonzero_values[e]);
+      passed = passed && found;
+    }
+  }
+
+  std::cout << "Sorted, merged and transposed: "
+            << (passed ? "PASSED" : "FAILED") << std::endl;
+  if (!passed)
+    exit(1);
+}
+
+/**
+ * @brief A small COO with its entries out of order and repeated (up to three
+ * times), against a reference built with std::map, for every reducer.
+ */
+void test_unordered_duplicates() {
+  using namespace gunrock;
+  using namespace memory;
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+  using key_t = std::pair<vertex_t, vertex_t>;
+
+  // (row, column, value): out of order within and across rows.
+  std::vector<std::tuple<vertex_t, vertex_t, weight_t>> entries = {
+      {3, 1, 1}, {0, 2, 2}, {3, 0, 3}, {1, 3, 4}, {0, 2, 5}, {2, 2, 6},
+      {3, 1, 7}, {0, 0, 8}, {1, 3, 9}, {3, 1, 10}, {2, 0, 11}, {0, 2, 12}};
+  vertex_t n = 4;
+  edge_t nnz = (edge_t)entries.size();
+
+  format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t> coo(n, n,
+                                                                       nnz);
+  for (edge_t i = 0; i < nnz; ++i)
+    std::tie(coo.row_indices[i], coo.column_indices[i],
+             coo.nonzero_values[i]) = entries[i];
+
+  auto check = [&](auto op, char const* name) {
+    std::map<key_t, weight_t> expected;
+    for (auto const& [r, c, w] : entries) {
+      auto it = expected.find({r, c});
+      if (it == expected.end())
+        expected[{r, c}] = w;
+      else
+        it->second = op(it->second, w);
+    }
+
+    format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+    format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t> csc;
+    format::from_coo(coo, csr, csc,
+                     format::build_properties_t(true /* sort */,
+                                                true /* merge duplicates */),
+                     op);
+
+    // Both formats hold exactly the reference, in (row, column) order.
+    bool passed = (csr.number_of_nonzeros == (edge_t)expected.size()) &&
+                  (csc.number_of_nonzeros == (edge_t)expected.size());
+    std::map<key_t, weight_t> rows, columns;
+    for (vertex_t r = 0; passed && r < n; ++r)
+      for (edge_t e = csr.row_offsets[r]; e < csr.row_offsets[r + 1]; ++e)
+        rows[{r, csr.column_indices[e]}] = csr.nonzero_values[e];
+    for (vertex_t c = 0; passed && c < n; ++c)
+      for (edge_t e = csc.column_offsets[c]; e < csc.column_offsets[c + 1];
+           ++e)
+        columns[{csc.row_indices[e], c}] = csc.nonzero_values[e];
+    edge_t e = 0;
+    for (auto const& [key, w] : expected)
+      passed = passed && (csr.column_indices[e++] == key.second);
+    passed = passed && (rows == expected) && (columns == expected);
+
+    std::cout << "Unordered duplicates (" << name
+              << "): " << (passed ? "PASSED" : "FAILED") << std::endl;
+    if (!passed)
+      exit(1);
+  };
+
+  check(format::reduce::plus_t(), "plus");
+  check(format::reduce::first_t(), "first");
+  check(format::reduce::last_t(), "last");
+  check(format::reduce::minimum_t(), "minimum");
+  check(format::reduce::maximum_t(), "maximum");
 }
 
 int main(int argc, char** argv) {
   test_coo_to_csr(argc, argv);
-}
\ No newline at end of file
+  test_unordered_duplicates();
+}
@@ -0,0 +1,113 @@
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <gunrock/applications/application.hxx>
+#include <gunrock/applications/cpu/sssp.hxx>
+#include <gunrock/algorithms/generate/graphs.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+using csr_type =
+    format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+
+/**
+ * @brief Dijkstra, the reference distances (same float additions).
+ */
+std::vector<weight_t> dijkstra(csr_type const& csr, vertex_t source) {
+  std::vector<weight_t> distances(csr.number_of_rows,
+                                  std::numeric_limits<weight_t>::max());
+  using entry_t = std::pair<weight_t, vertex_t>;
+  std::priority_queue<entry_t, std::vector<entry_t>, std::greater<entry_t>>
+      queue;
+  distances[source] = 0;
+  queue.push({0, source});
+  while (!queue.empty()) {
+    auto [d, u] = queue.top();
+    queue.pop();
+    if (d > distances[u])
+      continue;
+    for (edge_t e = csr.row_offsets[u]; e < csr.row_offsets[u + 1]; ++e) {
+      vertex_t v = csr.column_indices[e];
+      weight_t candidate = d + csr.nonzero_values[e];
+      if (candidate < distances[v]) {
+        distances[v] = candidate;
+        queue.push({candidate, v});
+      }
+    }
+  }
+  return distances;
+}
+
+/**
+ * @brief Delta-stepping from `source` with bucket width `delta`, against
+ * Dijkstra.
+ */
+bool check(csr_type& csr, vertex_t source, weight_t delta, char const* name) {
+  auto G = graph::build::from_csr<memory_space_t::host, graph::view_t::csr>(
+      csr.number_of_rows, csr.number_of_columns, csr.number_of_nonzeros,
+      csr.row_offsets.data(), csr.column_indices.data(),
+      csr.nonzero_values.data());
+
+  std::vector<weight_t> distances(csr.number_of_rows);
+  std::vector<vertex_t> predecessors(csr.number_of_rows);
+  sssp::cpu::run(G, source, distances.data(), predecessors.data(), delta);
+
+  bool passed = (distances == dijkstra(csr, source));
+  std::cout << name << " (delta = " << delta
+            << "): " << (passed ? "PASSED" : "FAILED") << std::endl;
+  return passed;
+}
+
+void test_delta_stepping() {
+  bool passed = true;
+
+  // In float, 984.995728 / delta rounds up to 1321 while delta * 1321
+  // rounds above 984.995728: vertex 1 must still be relaxed in bucket 1321.
+  {
+    format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t> coo(3, 3,
+                                                                        2);
+    coo.row_indices[0] = 0;
+    coo.column_indices[0] = 1;
+    coo.nonzero_values[0] = 984.995728f;
+    coo.row_indices[1] = 1;
+    coo.column_indices[1] = 2;
+    coo.nonzero_values[1] = 1;
+    csr_type csr;
+    csr.from_coo(coo);
+    passed = check(csr, 0, 0.745644033f, "Bucket boundary") && passed;
+  }
+
+  // Non-integer weights, fractional deltas (narrow ones slide the window).
+  {
+    algo::generate::rmat_t<vertex_t, edge_t, weight_t> rmat(
+        12, 8, 5, algo::generate::rmat_properties_t(),
+        algo::generate::weights_t<weight_t>(algo::generate::uniform_real,
+                                            0.1, 1000));
+    csr_type csr;
+    csr.from_coo(algo::generate::to_coo(rmat));
+    vertex_t source = 0;
+    for (vertex_t v = 0; v < csr.number_of_rows; ++v)
+      if (csr.row_offsets[v + 1] - csr.row_offsets[v] >
+          csr.row_offsets[source + 1] - csr.row_offsets[source])
+        source = v;
+    for (weight_t delta : {0.745644033f, 0.1f, 3.3f, 77.7f})
+      passed = check(csr, source, delta, "R-MAT, real weights") && passed;
+  }
+
+  std::cout << "Delta-stepping: " << (passed ? "PASSED" : "FAILED")
+            << std::endl;
+  if (!passed)
+    exit(1);
+}
+
+int main(int argc, char** argv) {
+  test_delta_stepping();
+}
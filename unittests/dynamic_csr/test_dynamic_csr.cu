@@ -0,0 +1,239 @@
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gunrock/applications/application.hxx>
+#include <gunrock/applications/cpu/bfs.hxx>
+#include <gunrock/applications/cpu/sssp.hxx>
+#include <gunrock/applications/cpu/repair.hxx>
+#include <gunrock/algorithms/generate/graphs.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+using dynamic_csr_t =
+    format::dynamic_csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+using update_t = format::edge_update_t<vertex_t, weight_t>;
+using edges_t = std::map<std::pair<vertex_t, vertex_t>, weight_t>;
+
+/**
+ * @brief Random batch: erasures of existing edges, insertions of new edges
+ * and new weights for existing ones (integer weights, so that distances are
+ * exact), sorted.
+ */
+std::vector<update_t> make_batch(edges_t const& edges,
+                                 vertex_t n,
+                                 std::size_t size,
+                                 std::uint64_t seed) {
+  algo::generate::random::counter_t rng(seed);
+  std::vector<std::pair<vertex_t, vertex_t>> keys;
+  for (auto const& [key, w] : edges)
+    keys.push_back(key);
+
+  std::vector<update_t> batch;
+  for (std::size_t k = 0; k < size; ++k) {
+    weight_t w = (weight_t)(1 + rng(4 * k) % 16);
+    switch (rng(4 * k + 1) % 3) {
+      case 0: {
+        auto [u, v] = keys[rng(4 * k + 2) % keys.size()];
+        batch.push_back({u, v, w, format::update_t::erase});
+        break;
+      }
+      case 1: {
+        auto [u, v] = keys[rng(4 * k + 2) % keys.size()];
+        batch.push_back({u, v, w, format::update_t::insert});
+        break;
+      }
+      default:
+        batch.push_back({(vertex_t)(rng(4 * k + 2) % n),
+                         (vertex_t)(rng(4 * k + 3) % n), w,
+                         format::update_t::insert});
+    }
+  }
+  std::stable_sort(batch.begin(), batch.end());
+  return batch;
+}
+
+/**
+ * @brief The same batch, on the reverse graph.
+ */
+std::vector<update_t> transpose(std::vector<update_t> batch) {
+  for (auto& update : batch)
+    std::swap(update.source, update.destination);
+  std::stable_sort(batch.begin(), batch.end());
+  return batch;
+}
+
+void apply_batch(edges_t& edges, std::vector<update_t> const& batch) {
+  for (auto const& update : batch)
+    if (update.op == format::update_t::insert)
+      edges[{update.source, update.destination}] = update.weight;
+    else
+      edges.erase({update.source, update.destination});
+}
+
+/**
+ * @brief The graph view of `D` against the reference edges: neighbors in
+ * order, edge ids, weights and lookups.
+ */
+template <typename graph_t>
+bool check_graph(graph_t& G, dynamic_csr_t const& D, edges_t const& edges) {
+  bool passed = (D.number_of_nonzeros == (edge_t)edges.size()) &&
+                (G.get_number_of_edges() == D.get_number_of_slots());
+  auto it = edges.begin();
+  for (vertex_t v = 0; passed && v < G.get_number_of_vertices(); ++v) {
+    edge_t expected = G.get_starting_edge(v);
+    G.for_each_neighbor(v, [&](vertex_t const& u, edge_t const& e) {
+      passed = passed && (it != edges.end()) &&
+               (it->first == std::make_pair(v, u)) && (e == expected++) &&
+               (G.get_source_vertex(e) == v) &&
+               (G.get_destination_vertex(e) == u) &&
+               (G.get_edge_weight(e) == it->second) && (G.get_edge(v, u) == e);
+      ++it;
+    });
+    passed = passed && (expected - G.get_starting_edge(v) ==
+                        G.get_number_of_neighbors(v));
+  }
+  return passed && (it == edges.end());
+}
+
+void test_dynamic_csr(int num_arguments, char** argument_array) {
+  int scale = (num_arguments > 1) ? std::stoi(argument_array[1]) : 12;
+
+  algo::generate::rmat_t<vertex_t, edge_t, weight_t> rmat(
+      scale, 8, 27, algo::generate::rmat_properties_t(),
+      algo::generate::weights_t<weight_t>(
+          algo::generate::uniform_integer, 1, 16));
+  auto coo = algo::generate::to_coo(rmat);
+
+  csr_t csr, csr_t_;
+  format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t> csc;
+  format::from_coo(coo, csr, csc);
+  csr_t_.number_of_rows = csc.number_of_columns;
+  csr_t_.number_of_columns = csc.number_of_rows;
+  csr_t_.number_of_nonzeros = csc.number_of_nonzeros;
+  csr_t_.row_offsets = csc.column_offsets;
+  csr_t_.column_indices = csc.row_indices;
+  csr_t_.nonzero_values = csc.nonzero_values;
+
+  // Tight storage policy: many relocations and compactions.
+  format::dynamic_csr_properties_t properties;
+  properties.slack = 0;
+  properties.minimum_slack = 1;
+  properties.compaction_threshold = 0.05;
+
+  dynamic_csr_t D, T;
+  D.from_csr(csr, properties);
+  T.from_csr(csr_t_, properties);
+
+  // Reference: parallel edges merged, smallest weight.
+  edges_t edges;
+  for (vertex_t u = 0; u < csr.number_of_rows; ++u)
+    for (edge_t e = csr.row_offsets[u]; e < csr.row_offsets[u + 1]; ++e) {
+      auto key = std::make_pair(u, csr.column_indices[e]);
+      auto found = edges.find(key);
+      if (found == edges.end() || csr.nonzero_values[e] < found->second)
+        edges[key] = csr.nonzero_values[e];
+    }
+
+  vertex_t n = D.number_of_rows;
+  vertex_t source = 0;
+  std::vector<weight_t> distances(n), expected(n);
+  std::vector<vertex_t> predecessors(n), depths(n), parents(n),
+      expected_depths(n), scratch(n);
+
+  auto G = graph::build::from_dynamic_csr<memory_space_t::host,
+                                          graph::view_t::dynamic_csr>(D);
+  bool passed = check_graph(G, D, edges);
+
+  // Initial solutions, from scratch on the static graph.
+  auto solve = [&](std::vector<weight_t>& sssp_distances,
+                   std::vector<vertex_t>& sssp_predecessors,
+                   std::vector<vertex_t>& bfs_depths,
+                   std::vector<vertex_t>& bfs_parents) {
+    csr_t S;
+    D.to_csr(S);
+    auto H = graph::build::from_csr<memory_space_t::host, graph::view_t::csr>(
+        S.number_of_rows, S.number_of_columns, S.number_of_nonzeros,
+        S.row_offsets.data(), S.column_indices.data(),
+        S.nonzero_values.data());
+    sssp::cpu::run(H, source, sssp_distances.data(),
+                   sssp_predecessors.data());
+    bfs::cpu::run(H, source, bfs_depths.data(), bfs_parents.data());
+  };
+  solve(distances, predecessors, depths, parents);
+
+  for (int b = 0; passed && b < 20; ++b) {
+    auto batch = make_batch(edges, n, (b % 2) ? 64 : 2048, 100 + b);
+    auto reverse = transpose(batch);
+    apply_batch(edges, batch);
+    D.update(batch);
+    T.update(reverse);
+
+    auto G = graph::build::from_dynamic_csr<memory_space_t::host,
+                                            graph::view_t::dynamic_csr>(D);
+    auto R = graph::build::from_dynamic_csr<memory_space_t::host,
+                                            graph::view_t::dynamic_csr>(T);
+    passed = passed && check_graph(G, D, edges);
+    for (auto const& update : batch)
+      if (edges.count({update.source, update.destination}) == 0)
+        passed = passed && !util::limits::is_valid(
+                               G.get_edge(update.source, update.destination));
+
+    repair::cpu::stats_t sssp_stats, bfs_stats;
+    repair::cpu::sssp(G, R, source, batch.data(), batch.size(),
+                      distances.data(), predecessors.data(), &sssp_stats);
+    repair::cpu::bfs(G, R, source, batch.data(), batch.size(), depths.data(),
+                     parents.data(), &bfs_stats);
+    solve(expected, scratch, expected_depths, scratch);
+
+    // Same distances as from scratch, and trees of tight edges.
+    passed = passed && (distances == expected) && (depths == expected_depths);
+    for (vertex_t v = 0; passed && v < n; ++v) {
+      if (v == source || depths[v] == -1) {
+        passed = (predecessors[v] == -1) && (parents[v] == -1);
+        continue;
+      }
+      edge_t e = G.get_edge(predecessors[v], v);
+      passed = util::limits::is_valid(e) &&
+               (distances[predecessors[v]] + G.get_edge_weight(e) ==
+                distances[v]) &&
+               util::limits::is_valid(G.get_edge(parents[v], v)) &&
+               (depths[parents[v]] + 1 == depths[v]);
+    }
+
+    std::cout << "Batch " << b << " (" << batch.size()
+              << " updates): sssp invalidated " << sssp_stats.invalidated
+              << ", settled " << sssp_stats.settled << "; bfs invalidated "
+              << bfs_stats.invalidated << ", settled " << bfs_stats.settled
+              << std::endl;
+  }
+
+  passed = passed && (D.stats.relocations > 0) && (D.stats.inserted > 0) &&
+           (D.stats.erased > 0) && (D.stats.reweighted > 0);
+
+  // Explicit compaction: same graph, no dead slots.
+  D.compact();
+  auto C = graph::build::from_dynamic_csr<memory_space_t::host,
+                                          graph::view_t::dynamic_csr>(D);
+  passed = passed && check_graph(C, D, edges) &&
+           (D.get_number_of_dead_slots() == 0);
+
+  std::cout << "Dynamic CSR (" << D.stats.batches << " batches, "
+            << D.stats.relocations << " relocations, " << D.stats.compactions
+            << " compactions): " << (passed ? "PASSED" : "FAILED")
+            << std::endl;
+  if (!passed)
+    exit(1);
+}
+
+int main(int argc, char** argv) {
+  test_dynamic_csr(argc, argv);
+}
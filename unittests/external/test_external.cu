@@ -0,0 +1,154 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <gunrock/applications/application.hxx>
+#include <gunrock/applications/cpu/bfs.hxx>
+#include <gunrock/applications/cpu/sssp.hxx>
+#include <gunrock/applications/cpu/pr.hxx>
+#include <gunrock/applications/cpu/external.hxx>
+#include <gunrock/algorithms/generate/graphs.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+using external_t = format::binary::external_csr_t<vertex_t, edge_t, weight_t>;
+
+void log_stats(std::string name, external::cpu::stats_t const& stats) {
+  std::cout << name << " (" << stats.iterations << " iterations), bytes read:";
+  for (auto bytes : stats.bytes_read)
+    std::cout << " " << bytes;
+  std::cout << " (total " << stats.total_bytes_read << ")" << std::endl;
+}
+
+void test_external(int num_arguments, char** argument_array) {
+  int scale = (num_arguments > 1) ? std::stoi(argument_array[1]) : 12;
+
+  algo::generate::rmat_t<vertex_t, edge_t, weight_t> rmat(
+      scale, 8, 3, algo::generate::rmat_properties_t(),
+      algo::generate::weights_t<weight_t>(
+          algo::generate::uniform_integer, 1, 16));
+  auto coo = algo::generate::to_coo(rmat);
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t> csc;
+  format::from_coo(coo, csr, csc);
+
+  auto H = graph::build::from_csr_and_csc<
+      memory_space_t::host, graph::view_t::csr | graph::view_t::csc>(
+      csr.number_of_rows, csr.number_of_columns, csr.number_of_nonzeros,
+      csr.row_offsets.data(), csr.column_indices.data(),
+      csr.nonzero_values.data(), csc.column_offsets.data(),
+      csc.row_indices.data(), csc.nonzero_values.data());
+
+  vertex_t n = csr.number_of_rows;
+  edge_t const* Ap = csr.row_offsets.data();
+  vertex_t source = 0;
+  for (vertex_t v = 0; v < n; ++v)
+    if (Ap[v + 1] - Ap[v] > Ap[source + 1] - Ap[source])
+      source = v;
+
+  // Weighted and pattern-only files, small blocks (many reads).
+  std::string weighted = "test_external.csr", pattern = "test_pattern.csr";
+  format::binary::write(weighted, n, csr.number_of_columns,
+                        csr.number_of_nonzeros, Ap, csr.column_indices.data(),
+                        csr.nonzero_values.data());
+  format::binary::write(pattern, n, csr.number_of_columns,
+                        csr.number_of_nonzeros, Ap, csr.column_indices.data(),
+                        (weight_t const*)nullptr);
+
+  format::binary::external_csr_properties_t properties;
+  properties.block_bytes = 4096;
+  external_t E(weighted, properties), P(pattern, properties);
+  std::remove(weighted.c_str());  // descriptors stay valid.
+  std::remove(pattern.c_str());
+
+  // Edge-balanced blocks covering the rows.
+  std::size_t blocks = E.get_number_of_blocks();
+  bool passed = (blocks > 16) && (E.block_offsets.front() == 0) &&
+                (E.block_offsets.back() == n);
+  for (std::size_t b = 0; passed && b < blocks; ++b)
+    passed = (E.block_offsets[b] < E.block_offsets[b + 1]) &&
+             (E.get_block_bytes(b) <= properties.block_bytes ||
+              E.block_offsets[b + 1] == E.block_offsets[b] + 1);
+
+  // BFS: same depths, valid tree; the first level reads one block.
+  std::vector<vertex_t> depths(n), parents(n), expected_depths(n),
+      expected_parents(n);
+  external::cpu::stats_t bfs_stats;
+  external::cpu::bfs(E, source, depths.data(), parents.data(), &bfs_stats);
+  bfs::cpu::run(H, source, expected_depths.data(), expected_parents.data());
+  log_stats("BFS", bfs_stats);
+
+  passed = passed && (depths == expected_depths) &&
+           (bfs_stats.blocks[0] == 1) &&
+           (bfs_stats.bytes_read[0] ==
+            E.get_block_bytes(E.get_block(source),
+                              format::binary::contents_t::adjacency));
+  for (vertex_t v = 0; passed && v < n; ++v) {
+    if (v == source || depths[v] == -1) {
+      passed = (parents[v] == -1);
+      continue;
+    }
+    vertex_t u = parents[v];
+    passed = (depths[u] + 1 == depths[v]) &&
+             std::count(csr.column_indices.data() + Ap[u],
+                        csr.column_indices.data() + Ap[u + 1], v) > 0;
+  }
+
+  // SSSP: same distances and predecessors (integer weights, exact).
+  std::vector<weight_t> distances(n), expected_distances(n);
+  std::vector<vertex_t> predecessors(n), expected_predecessors(n);
+  external::cpu::stats_t sssp_stats;
+  external::cpu::sssp(E, source, distances.data(), predecessors.data(),
+                      &sssp_stats);
+  sssp::cpu::run(H, source, expected_distances.data(),
+                 expected_predecessors.data());
+  log_stats("SSSP", sssp_stats);
+  passed = passed && (distances == expected_distances) &&
+           (predecessors == expected_predecessors);
+
+  // Pattern-only file: unit weights, distances are the depths.
+  external::cpu::sssp(P, source, distances.data());
+  for (vertex_t v = 0; passed && v < n; ++v)
+    passed = (depths[v] == -1)
+                 ? distances[v] == std::numeric_limits<weight_t>::max()
+                 : distances[v] == (weight_t)depths[v];
+
+  // PageRank: the ranks of the in-memory power iteration.
+  pr::param_t<weight_t> param(0.85, 1e-6);
+  std::vector<weight_t> ranks(n), expected_ranks(n);
+  external::cpu::stats_t pr_stats;
+  external::cpu::pr(E, param, pr::result_t<weight_t>(ranks.data()),
+                    &pr_stats);
+  pr::cpu::run(H, param, pr::result_t<weight_t>(expected_ranks.data()));
+  weight_t largest = 0;
+  for (vertex_t v = 0; v < n; ++v)
+    largest = std::max(largest, std::abs(ranks[v] - expected_ranks[v]));
+  std::cout << "PR (" << pr_stats.iterations
+            << " iterations), largest difference : " << largest << std::endl;
+
+  // Every iteration streams the adjacency and the values once.
+  std::size_t edge_bytes =
+      csr.number_of_nonzeros * (sizeof(vertex_t) + sizeof(weight_t));
+  passed = passed && (largest < 1e-5) &&
+           (pr_stats.bytes_read[0] == edge_bytes) &&
+           (pr_stats.total_bytes_read ==
+            pr_stats.iterations * edge_bytes +
+                csr.number_of_nonzeros * sizeof(weight_t));
+
+  std::cout << "Semi-external (" << blocks << " blocks): "
+            << (passed ? "PASSED" : "FAILED") << std::endl;
+  if (!passed)
+    exit(1);
+}
+
+int main(int argc, char** argv) {
+  test_external(argc, argv);
+}
@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <vector>
+
+#include <gunrock/error.hxx>                          // error checking
+#include <gunrock/framework/frontier/frontier.hxx>    // frontiers
+#include <gunrock/framework/operators/operators.hxx>  // advance
+#include <gunrock/graph/graph.hxx>                    // graph class
+#include <gunrock/memory.hxx>                         // memory space
+
+/**
+ * @brief Host advance of every `advance_type_t` on a small graph, dense and
+ * sparse: inputs and outputs are vertices or edges as the type says.
+ */
+bool test_advance() {
+  using namespace gunrock;
+  using namespace memory;
+  using namespace operators;
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+  using bitmap_t =
+      frontier_t<vertex_t, frontier_storage_t::bitmap, memory_space_t::host>;
+
+  // 0 -> {1, 2}, 1 -> {2}, 2 -> {0, 3}, 3 -> {}.
+  std::vector<edge_t> Ap = {0, 2, 3, 5, 5};
+  std::vector<vertex_t> Aj = {1, 2, 2, 0, 3};
+  std::vector<weight_t> Ax(Aj.size(), 1);
+  auto G = graph::build::from_csr<memory_space_t::host, graph::view_t::csr>(
+      4, 4, 5, Ap.data(), Aj.data(), Ax.data());
+
+  auto all = [](vertex_t const&, vertex_t const&, edge_t const&,
+                weight_t const&) { return true; };
+  auto items = [](bitmap_t& f) {
+    std::vector<vertex_t> out(f.get_capacity());
+    out.resize(f.compact(out.data()));
+    return out;
+  };
+
+  bitmap_t vertices, edges, output;
+  vertices.reserve(4);
+  vertices.insert(0);
+  vertices.insert(1);
+  edges.reserve(5);
+  edges.insert(1);  // 0 -> 2
+  edges.insert(4);  // 2 -> 3
+
+  advance::host_mapped::execute_dense<advance_type_t::vertex_to_vertex>(
+      G, all, &vertices, &output);
+  bool passed = (items(output) == std::vector<vertex_t>{1, 2});
+  advance::host_mapped::execute_dense<advance_type_t::vertex_to_edge>(
+      G, all, &vertices, &output);
+  passed = passed && (output.get_capacity() >= 5) &&
+           (items(output) == std::vector<vertex_t>{0, 1, 2});
+  advance::host_mapped::execute_dense<advance_type_t::edge_to_vertex>(
+      G, all, &edges, &output);
+  passed = passed && (items(output) == std::vector<vertex_t>{2, 3});
+  advance::host_mapped::execute_dense<advance_type_t::edge_to_edge>(
+      G, all, &edges, &output);
+  passed = passed && (items(output) == std::vector<vertex_t>{1, 4});
+
+  // Sparse frontiers: the same items, whatever the density.
+  using vector_t =
+      frontier_t<vertex_t, frontier_storage_t::vector, memory_space_t::host>;
+  vector_t sparse_vertices, sparse_edges, sparse_output;
+  sparse_vertices.push_back(0);
+  sparse_vertices.push_back(1);
+  sparse_edges.push_back(1);
+  sparse_edges.push_back(4);
+  std::vector<edge_t> segments;
+  auto sparse_items = [](vector_t& f) {
+    std::vector<vertex_t> out(f.begin(), f.end());
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+    return out;
+  };
+
+  advance::host_mapped::execute_sparse<advance_type_t::vertex_to_vertex>(
+      G, all, &sparse_vertices, &sparse_output, segments);
+  passed = passed &&
+           (sparse_items(sparse_output) == std::vector<vertex_t>{1, 2});
+  advance::host_mapped::execute_sparse<advance_type_t::vertex_to_edge>(
+      G, all, &sparse_vertices, &sparse_output, segments);
+  passed = passed &&
+           (sparse_items(sparse_output) == std::vector<vertex_t>{0, 1, 2});
+  advance::host_mapped::execute_sparse<advance_type_t::edge_to_vertex>(
+      G, all, &sparse_edges, &sparse_output, segments);
+  passed = passed &&
+           (sparse_items(sparse_output) == std::vector<vertex_t>{2, 3});
+  advance::host_mapped::execute_sparse<advance_type_t::edge_to_edge>(
+      G, all, &sparse_edges, &sparse_output, segments);
+  passed = passed &&
+           (sparse_items(sparse_output) == std::vector<vertex_t>{1, 4});
+
+  std::cout << "Dense and sparse advance (all types): "
+            << (passed ? "PASSED" : "FAILED") << std::endl;
+  return passed;
+}
+
+void test_frontier() {
+  using namespace gunrock;
+  using namespace memory;
+
+  using vertex_t = int;
+
+  std::size_t universe = 1 << 16;
+
+  // Every 7th vertex, inserted twice.
+  std::vector<vertex_t> items;
+  for (vertex_t v = 0; v < (vertex_t)universe; v += 7)
+    items.push_back(v);
+
+  frontier_t<vertex_t, frontier_storage_t::bitmap, memory_space_t::host> bitmap;
+  frontier_t<vertex_t, frontier_storage_t::boolmap, memory_space_t::host>
+      boolmap;
+  bitmap.reserve(universe);
+  boolmap.reserve(universe);
+  for (auto v : items) {
+    bitmap.insert(v);
+    bitmap.insert(v);
+    boolmap.insert(v);
+    boolmap.insert(v);
+  }
+
+  std::vector<vertex_t> compacted(universe);
+  std::size_t size = bitmap.compact(compacted.data());
+  compacted.resize(size);
+
+  bool passed = (bitmap.popcount() == items.size()) &&
+                (boolmap.popcount() == items.size()) && (compacted == items);
+
+  compacted.resize(universe);
+  compacted.resize(boolmap.compact(compacted.data()));
+  passed = passed && (compacted == items);
+
+  std::cout << "Bitmap size (bytes) = " << bitmap.get_allocated_size_in_bytes()
+            << std::endl;
+  std::cout << "Boolmap size (bytes) = "
+            << boolmap.get_allocated_size_in_bytes() << std::endl;
+  std::cout << "Insert, popcount and compact: "
+            << (passed ? "PASSED" : "FAILED") << std::endl;
+
+  // Hybrid: sparse (with duplicates and an invalid) -> dense -> sparse.
+  frontier_t<vertex_t, frontier_storage_t::hybrid, memory_space_t::host>
+      hybrid;
+  for (auto v : items) {
+    hybrid.push_back(v);
+    hybrid.push_back(v);
+  }
+  hybrid.push_back(gunrock::numeric_limits<vertex_t>::invalid());
+
+  hybrid.to_dense(universe);
+  bool converted = hybrid.is_dense() &&
+                   (hybrid.get_number_of_elements() == items.size());
+
+  hybrid.to_sparse();
+  converted = converted && !hybrid.is_dense() &&
+              std::equal(hybrid.begin(), hybrid.end(), items.begin(),
+                         items.end());
+
+  std::cout << "Sparse to dense to sparse: "
+            << (converted ? "PASSED" : "FAILED") << std::endl;
+
+  bool advanced = test_advance();
+  if (!passed || !converted || !advanced)
+    exit(1);
+}
+
+int main(int argc, char** argv) {
+  test_frontier();
+}
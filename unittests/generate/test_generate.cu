@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include <omp.h>
+
+#include <gunrock/error.hxx>                       // error checking
+#include <gunrock/formats/formats.hxx>             // formats (csr, coo)
+#include <gunrock/memory.hxx>                      // memory space
+#include <gunrock/algorithms/generate/graphs.hxx>  // graph generators
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = long;
+using weight_t = float;
+
+using coo_t = format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+using csr_t = format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t>;
+
+bool equal(coo_t const& a, coo_t const& b) {
+  return a.number_of_rows == b.number_of_rows &&
+         a.number_of_nonzeros == b.number_of_nonzeros &&
+         std::equal(a.row_indices.begin(), a.row_indices.end(),
+                    b.row_indices.begin()) &&
+         std::equal(a.column_indices.begin(), a.column_indices.end(),
+                    b.column_indices.begin()) &&
+         std::equal(a.nonzero_values.begin(), a.nonzero_values.end(),
+                    b.nonzero_values.begin());
+}
+
+bool equal(csr_t const& a, csr_t const& b) {
+  return a.number_of_rows == b.number_of_rows &&
+         a.number_of_nonzeros == b.number_of_nonzeros &&
+         std::equal(a.row_offsets.begin(), a.row_offsets.end(),
+                    b.row_offsets.begin()) &&
+         std::equal(a.column_indices.begin(), a.column_indices.end(),
+                    b.column_indices.begin()) &&
+         std::equal(a.nonzero_values.begin(), a.nonzero_values.end(),
+                    b.nonzero_values.begin());
+}
+
+/**
+ * @brief The CSR generated directly has the edges of the COO, rows sorted.
+ */
+bool same_edges(coo_t const& coo, csr_t const& csr) {
+  if (csr.number_of_nonzeros != coo.number_of_nonzeros)
+    return false;
+  std::vector<std::vector<std::pair<vertex_t, weight_t>>> rows(
+      coo.number_of_rows);
+  for (edge_t e = 0; e < coo.number_of_nonzeros; ++e)
+    rows[coo.row_indices[e]].emplace_back(coo.column_indices[e],
+                                          coo.nonzero_values[e]);
+  for (vertex_t u = 0; u < coo.number_of_rows; ++u) {
+    std::sort(rows[u].begin(), rows[u].end());
+    if ((edge_t)rows[u].size() != csr.row_offsets[u + 1] - csr.row_offsets[u])
+      return false;
+    for (std::size_t k = 0; k < rows[u].size(); ++k) {
+      edge_t e = csr.row_offsets[u] + k;
+      if (rows[u][k] != std::make_pair(csr.column_indices[e],
+                                       csr.nonzero_values[e]))
+        return false;
+    }
+  }
+  return true;
+}
+
+template <typename generator_t>
+void test_generator(std::string name,
+                    generator_t const& generator,
+                    weight_t low,
+                    weight_t high,
+                    bool symmetric,
+                    std::function<bool(edge_t)> valid_edges) {
+  int threads = std::max(4, omp_get_max_threads());
+
+  // Same graph for any number of threads.
+  omp_set_num_threads(1);
+  auto serial = algo::generate::to_coo(generator);
+  auto serial_csr = algo::generate::to_csr(generator);
+  omp_set_num_threads(threads);
+  auto t0 = std::chrono::high_resolution_clock::now();
+  auto coo = algo::generate::to_coo(generator);
+  auto t1 = std::chrono::high_resolution_clock::now();
+  double medges = coo.number_of_nonzeros /
+                  (std::chrono::duration<double>(t1 - t0).count() * 1e6);
+  auto csr = algo::generate::to_csr(generator);
+
+  bool passed = equal(serial, coo) && equal(serial_csr, csr) &&
+                same_edges(coo, csr) && valid_edges(coo.number_of_nonzeros);
+
+  // Edges in range, weights in range, symmetric graphs have every reverse.
+  vertex_t n = coo.number_of_rows;
+  for (edge_t e = 0; passed && e < coo.number_of_nonzeros; ++e)
+    passed = coo.row_indices[e] >= 0 && coo.row_indices[e] < n &&
+             coo.column_indices[e] >= 0 && coo.column_indices[e] < n &&
+             coo.nonzero_values[e] >= low && coo.nonzero_values[e] <= high;
+  for (vertex_t u = 0; passed && symmetric && u < n; ++u)
+    for (edge_t e = csr.row_offsets[u]; passed && e < csr.row_offsets[u + 1];
+         ++e) {
+      vertex_t v = csr.column_indices[e];
+      passed = std::binary_search(
+          csr.column_indices.begin() + csr.row_offsets[v],
+          csr.column_indices.begin() + csr.row_offsets[v + 1], u);
+    }
+
+  std::cout << name << ": vertices = " << n
+            << ", edges = " << coo.number_of_nonzeros
+            << ", COO (MEdges/s) = " << medges << " (" << threads
+            << " threads)" << std::endl;
+  std::cout << name << ": " << (passed ? "PASSED" : "FAILED") << std::endl;
+  if (!passed)
+    exit(1);
+}
+
+void test_generate(int num_arguments, char** argument_array) {
+  int scale = (num_arguments > 1) ? std::stoi(argument_array[1]) : 14;
+  std::uint64_t seed = 27;
+
+  using namespace algo::generate;
+
+  // R-MAT (Graph500): exactly edge_factor * 2^scale edges.
+  rmat_t<vertex_t, edge_t, weight_t> rmat(
+      scale, 16, seed, rmat_properties_t(),
+      weights_t<weight_t>(uniform_real, 1, 64));
+  test_generator("R-MAT", rmat, 1, 64, false,
+                 [&](edge_t m) { return m == ((edge_t)16 << scale); });
+
+  rmat_properties_t undirected;
+  undirected.symmetric = true;
+  rmat_t<vertex_t, edge_t, weight_t> rmat_undirected(scale, 8, seed,
+                                                     undirected);
+  test_generator("R-MAT (symmetric)", rmat_undirected, 1, 1, true,
+                 [&](edge_t m) { return m == ((edge_t)16 << scale); });
+
+  // Erdős–Rényi: about n * degree edges.
+  vertex_t n = 1 << scale;
+  double degree = 8;
+  auto er = erdos_renyi_t<vertex_t, edge_t, weight_t>::with_average_degree(
+      n, degree, seed, erdos_renyi_properties_t(),
+      weights_t<weight_t>(uniform_integer, 1, 10));
+  test_generator("Erdos-Renyi", er, 1, 10, false, [&](edge_t m) {
+    double expected = n * degree;
+    return std::fabs(m - expected) < 6 * std::sqrt(expected);
+  });
+
+  erdos_renyi_properties_t symmetric;
+  symmetric.symmetric = true;
+  erdos_renyi_t<vertex_t, edge_t, weight_t> er_undirected(n, 4.0 / n, seed,
+                                                          symmetric);
+  test_generator("Erdos-Renyi (symmetric)", er_undirected, 1, 1, true,
+                 [&](edge_t m) { return m > 0 && m % 2 == 0; });
+
+  // Grid: every horizontal and vertical edge, both directions.
+  vertex_t width = 1 << (scale / 2), height = n / width;
+  grid_t<vertex_t, edge_t, weight_t> grid(width, height, seed);
+  test_generator("Grid", grid, 1, 1, true, [&](edge_t m) {
+    return m == 2 * ((edge_t)height * (width - 1) +
+                     (edge_t)(height - 1) * width);
+  });
+
+  // Road-like: some edges removed, some diagonals added, lengths as weights.
+  grid_properties_t road;
+  road.removal_probability = 0.2;
+  road.diagonal_probability = 0.1;
+  grid_t<vertex_t, edge_t, weight_t> road_like(
+      width, height, seed, road, weights_t<weight_t>(exponential, 1, 100));
+  test_generator("Road-like", road_like, 1, 1e9, true,
+                 [&](edge_t m) { return m > 0 && m % 2 == 0; });
+
+  // Different seeds, different graphs.
+  rmat_t<vertex_t, edge_t, weight_t> other(
+      scale, 16, seed + 1, rmat_properties_t(),
+      weights_t<weight_t>(uniform_real, 1, 64));
+  bool passed = !equal(to_coo(rmat), to_coo(other));
+  std::cout << "Seeds: " << (passed ? "PASSED" : "FAILED") << std::endl;
+  if (!passed)
+    exit(1);
+}
+
+int main(int argc, char** argv) {
+  test_generate(argc, argv);
+}
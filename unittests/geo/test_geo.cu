@@ -0,0 +1,185 @@
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <gunrock/applications/application.hxx>
+#include <gunrock/applications/geo.hxx>      // scalar reference kernels
+#include <gunrock/applications/cpu/geo.hxx>  // structure-of-arrays engine
+#include <gunrock/algorithms/generate/graphs.hxx>
+#include <gunrock/io/labels.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+bool same(float a, float b) {
+  return util::limits::is_valid(a) == util::limits::is_valid(b) &&
+         (!util::limits::is_valid(a) || a == b);
+}
+
+/**
+ * @brief Comments, blank lines, missing coordinates, and a file spanning
+ * several chunks.
+ */
+bool test_loader() {
+  vertex_t n = 200000;
+  std::string filename = "test_geo.labels";
+  std::vector<float> expected_latitudes(n, numeric_limits<float>::invalid()),
+      expected_longitudes(n, numeric_limits<float>::invalid());
+
+  FILE* file = fopen(filename.c_str(), "w");
+  fprintf(file, "%%%%Labels Formatted File\n%%\n%% comments\n%%\n");
+  fprintf(file, "%d 2 2\n", n);
+  std::size_t expected_valid = 0;
+  for (vertex_t v = n - 1; v >= 0; --v) {
+    if (v % 7 == 3)
+      continue;  // node missing altogether.
+    if (v % 5 == 1) {
+      fprintf(file, "%d\n", v);  // coordinates missing.
+      continue;
+    }
+    if (v % 1000 == 0)
+      fprintf(file, "%% comment\n\n");
+    expected_latitudes[v] = (float)(v % 180) - 89.5f;
+    expected_longitudes[v] = (float)(v % 360) - 179.25f;
+    fprintf(file, "%d %.2f %.2f\n", v, expected_latitudes[v],
+            expected_longitudes[v]);
+    ++expected_valid;
+  }
+  fclose(file);
+
+  std::vector<float> latitudes(n), longitudes(n);
+  io::labels_t<vertex_t> labels;
+  std::size_t valid =
+      labels.load(filename, n, latitudes.data(), longitudes.data());
+  std::remove(filename.c_str());
+
+  bool passed = (valid == expected_valid) && (labels.valid == valid) &&
+                (labels.number_of_nodes == (std::size_t)n);
+  for (vertex_t v = 0; passed && v < n; ++v)
+    passed = same(latitudes[v], expected_latitudes[v]) &&
+             same(longitudes[v], expected_longitudes[v]);
+
+  std::cout << "Labels loader (" << valid << " valid): "
+            << (passed ? "PASSED" : "FAILED") << std::endl;
+  return passed;
+}
+
+/**
+ * @brief Scalar reference: the kernels of `geo.hxx` (array of structures),
+ * one round at a time from the coordinates of the previous round.
+ */
+template <typename graph_t>
+void reference(graph_t& G,
+               std::vector<geo::coordinates_t>& coordinates,
+               unsigned int total_iterations) {
+  vertex_t n = G.get_number_of_vertices();
+  std::vector<float> Dinv(G.get_number_of_edges());
+  auto valid = [](geo::coordinates_t const& c) {
+    return util::limits::is_valid(c.latitude) &&
+           util::limits::is_valid(c.longitude);
+  };
+
+  for (unsigned int iteration = 0; iteration < total_iterations; ++iteration) {
+    auto previous = coordinates;
+    for (vertex_t v = 0; v < n; ++v) {
+      if (valid(previous[v]))
+        continue;
+      std::vector<vertex_t> neighbors;
+      for (auto e = G.get_starting_edge(v);
+           e < G.get_starting_edge(v) + G.get_number_of_neighbors(v); ++e)
+        if (valid(previous[G.get_destination_vertex(e)]))
+          neighbors.push_back(G.get_destination_vertex(e));
+
+      if (neighbors.size() == 1) {
+        coordinates[v] = previous[neighbors[0]];
+      } else if (neighbors.size() == 2) {
+        coordinates[v] =
+            geo::midpoint(previous[neighbors[0]], previous[neighbors[1]], v);
+      } else if (neighbors.size() > 2) {
+        geo::spatial_median(G, neighbors.size(), previous.data(), v,
+                            Dinv.data());
+        coordinates[v] = previous[v];
+        previous[v].latitude = previous[v].longitude =
+            numeric_limits<float>::invalid();
+      }
+    }
+  }
+}
+
+template <typename graph_t>
+bool test_engine(graph_t& G) {
+  vertex_t n = G.get_number_of_vertices();
+
+  // A fifth of the vertices located, away from the poles and antimeridian.
+  algo::generate::random::counter_t rng(5);
+  std::vector<float> latitudes(n, numeric_limits<float>::invalid()),
+      longitudes(n, numeric_limits<float>::invalid());
+  std::vector<geo::coordinates_t> coordinates(n);
+  for (vertex_t v = 0; v < n; ++v) {
+    if (rng(3 * v) % 5 == 0) {
+      latitudes[v] = (float)(rng(3 * v + 1) % 12000) / 100 - 60;
+      longitudes[v] = (float)(rng(3 * v + 2) % 24000) / 100 - 120;
+    }
+    coordinates[v] = {latitudes[v], longitudes[v]};
+  }
+
+  geo::cpu::options_t options;
+  options.total_iterations = 20;
+  geo::cpu::stats_t stats;
+  geo::cpu::run(G, latitudes.data(), longitudes.data(), &stats, options);
+  reference(G, coordinates, options.total_iterations);
+
+  // Same vertices located, at (nearly) the same place: the engine works in
+  // double precision.
+  bool passed = (stats.copies > 0) && (stats.midpoints > 0) &&
+                (stats.medians > 0);
+  std::size_t located = 0, far = 0;
+  for (vertex_t v = 0; passed && v < n; ++v) {
+    passed = util::limits::is_valid(latitudes[v]) ==
+             util::limits::is_valid(coordinates[v].latitude);
+    if (!util::limits::is_valid(latitudes[v]))
+      continue;
+    ++located;
+    far += geo::haversine(coordinates[v], {latitudes[v], longitudes[v]}) > 5;
+  }
+  passed = passed && (far * 1000 <= located);  // medians stop within eps.
+
+  std::cout << "Geolocation (" << stats.iterations << " rounds, " << located
+            << " located, " << stats.medians << " medians, " << far
+            << " > 5 km from the reference): "
+            << (passed ? "PASSED" : "FAILED") << std::endl;
+  return passed;
+}
+
+void test_geo(int num_arguments, char** argument_array) {
+  int scale = (num_arguments > 1) ? std::stoi(argument_array[1]) : 12;
+
+  algo::generate::rmat_properties_t properties;
+  properties.symmetric = true;
+  algo::generate::rmat_t<vertex_t, edge_t, weight_t> rmat(scale, 4, 11,
+                                                          properties);
+  auto coo = algo::generate::to_coo(rmat);
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t> csc;
+  format::from_coo(coo, csr, csc);
+
+  auto G = graph::build::from_csr<memory_space_t::host, graph::view_t::csr>(
+      csr.number_of_rows, csr.number_of_columns, csr.number_of_nonzeros,
+      csr.row_offsets.data(), csr.column_indices.data(),
+      csr.nonzero_values.data());
+
+  bool passed = test_loader();
+  passed = test_engine(G) && passed;
+  if (!passed)
+    exit(1);
+}
+
+int main(int argc, char** argv) {
+  test_geo(argc, argv);
+}
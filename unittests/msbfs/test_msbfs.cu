@@ -0,0 +1,108 @@
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gunrock/applications/application.hxx>
+#include <gunrock/applications/cpu/bfs.hxx>    // single-source reference
+#include <gunrock/applications/cpu/msbfs.hxx>  // multi-source bfs
+#include <gunrock/algorithms/generate/graphs.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+/**
+ * @brief Every source of a multi-source run against a single-source BFS.
+ */
+template <typename graph_t>
+void test_graph(std::string name,
+                graph_t& G,
+                std::vector<vertex_t> const& sources,
+                int batch_size) {
+  vertex_t n = G.get_number_of_vertices();
+  std::size_t k = sources.size();
+
+  std::vector<vertex_t> distances(k * n), reached(k);
+  std::vector<std::uint64_t> sums(k);
+  msbfs::cpu::options_t options;
+  options.batch_size = batch_size;
+  msbfs::cpu::stats_t stats;
+  msbfs::cpu::run(
+      G, sources.data(), k,
+      msbfs::cpu::result_t<vertex_t>(distances.data(), sums.data(),
+                                     reached.data()),
+      &stats, options);
+
+  bool passed = true;
+  std::vector<vertex_t> expected(n), predecessors(n);
+  for (std::size_t s = 0; passed && s < k; ++s) {
+    bfs::cpu::run(G, sources[s], expected.data(), predecessors.data());
+    std::uint64_t sum = 0;
+    vertex_t count = 0;
+    for (vertex_t v = 0; v < n; ++v)
+      if (expected[v] != -1) {
+        sum += expected[v];
+        count++;
+      }
+    passed = std::equal(expected.begin(), expected.end(),
+                        distances.begin() + s * n) &&
+             (sums[s] == sum) && (reached[s] == count);
+  }
+
+  std::cout << name << " (" << k << " sources, batches of " << batch_size
+            << "):" << std::endl;
+  stats.print();
+  std::cout << name << ": " << (passed ? "PASSED" : "FAILED") << std::endl;
+  if (!passed)
+    exit(1);
+}
+
+void test_msbfs(int num_arguments, char** argument_array) {
+  int scale = (num_arguments > 1) ? std::stoi(argument_array[1]) : 12;
+
+  algo::generate::rmat_t<vertex_t, edge_t, weight_t> rmat(scale, 8, 27);
+  auto coo = algo::generate::to_coo(rmat);
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  format::csc_t<memory_space_t::host, vertex_t, edge_t, weight_t> csc;
+  format::from_coo(coo, csr, csc);
+
+  auto G = graph::build::from_csr<memory_space_t::host, graph::view_t::csr>(
+      csr.number_of_rows,           // rows
+      csr.number_of_columns,        // columns
+      csr.number_of_nonzeros,       // nonzeros
+      csr.row_offsets.data(),       // row_offsets
+      csr.column_indices.data(),    // column_indices
+      csr.nonzero_values.data());   // values
+
+  auto H = graph::build::from_csr_and_csc<
+      memory_space_t::host, graph::view_t::csr | graph::view_t::csc>(
+      csr.number_of_rows,          // rows
+      csr.number_of_columns,       // columns
+      csr.number_of_nonzeros,      // nonzeros
+      csr.row_offsets.data(),      // row_offsets
+      csr.column_indices.data(),   // column_indices
+      csr.nonzero_values.data(),   // values
+      csc.column_offsets.data(),   // column_offsets
+      csc.row_indices.data(),      // row_indices
+      csc.nonzero_values.data());  // values (column order)
+
+  // Partial last batches, and a duplicate source.
+  vertex_t n = G.get_number_of_vertices();
+  std::vector<vertex_t> sources;
+  for (vertex_t s = 0; s < 300; ++s)
+    sources.push_back((vertex_t)(((std::int64_t)s * 7919) % n));
+  sources.push_back(sources[0]);
+
+  test_graph("R-MAT, top-down", G, sources, 64);
+  test_graph("R-MAT, top-down", G, sources, 512);
+  test_graph("R-MAT, direction-optimizing", H, sources, 128);
+  test_graph("R-MAT, direction-optimizing", H, sources, 512);
+}
+
+int main(int argc, char** argv) {
+  test_msbfs(argc, argv);
+}
@@ -1,4 +1,5 @@
 #include <cstdlib>  // EXIT_SUCCESS
+#include <cstring>  // strcmp
 
 #include <gunrock/applications/application.hxx>
 
@@ -6,11 +7,30 @@ using namespace gunrock;
 using namespace memory;
 
 void test_mtx2bin(int num_arguments, char** argument_array) {
-  if (num_arguments != 2) {
-    std::cerr << "usage: ./bin/mtx2bin <inpath>" << std::endl;
+  std::string inpath;
+  std::string outpath;
+  bool with_values = true;
+
+  for (int i = 1; i < num_arguments; ++i) {
+    if (std::strcmp(argument_array[i], "--no-values") == 0)
+      with_values = false;
+    else if (inpath.empty())
+      inpath = argument_array[i];
+    else if (outpath.empty())
+      outpath = argument_array[i];
+    else
+      inpath.clear();  // too many arguments.
+  }
+
+  if (inpath.empty()) {
+    std::cerr << "usage: ./bin/mtx2bin <inpath> [outpath] [--no-values]"
+              << std::endl;
     exit(1);
   }
 
+  if (outpath.empty())
+    outpath = inpath + ".csr";
+
   // --
   // Define types
 
@@ -21,24 +41,51 @@ void test_mtx2bin(int num_arguments, char** argument_array) {
   // --
   // IO
 
-  std::string inpath  = argument_array[1];
-  std::string outpath = inpath + ".csr";
-
   io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
 
-  using csr_t = format::csr_t<memory::memory_space_t::device, vertex_t, edge_t, weight_t>;
+  using csr_t =
+      format::csr_t<memory::memory_space_t::host, vertex_t, edge_t, weight_t>;
   csr_t csr;
   csr.from_coo(mm.load(inpath));
 
-  std::cout << "csr.number_of_rows     = " << csr.number_of_rows     << std::endl;
-  std::cout << "csr.number_of_columns  = " << csr.number_of_columns  << std::endl;
-  std::cout << "csr.number_of_nonzeros = " << csr.number_of_nonzeros << std::endl;
-  std::cout << "writing to             = " << outpath                << std::endl;
+  std::cout << "csr.number_of_rows     = " << csr.number_of_rows << std::endl;
+  std::cout << "csr.number_of_columns  = " << csr.number_of_columns
+            << std::endl;
+  std::cout << "csr.number_of_nonzeros = " << csr.number_of_nonzeros
+            << std::endl;
+  std::cout << "values                 = " << (with_values ? "yes" : "no")
+            << std::endl;
+  std::cout << "writing to             = " << outpath << std::endl;
+
+  csr.write_binary(outpath, with_values);
+
+  // --
+  // Read back (verifying checksums) and compare.
+
+  auto mapped = csr_t::open_mapped(outpath, true /* verify */);
+
+  bool same = (mapped.has_values() == with_values) &&
+              (mapped.number_of_rows == csr.number_of_rows) &&
+              (mapped.number_of_columns == csr.number_of_columns) &&
+              (mapped.number_of_nonzeros == csr.number_of_nonzeros);
+
+  for (vertex_t i = 0; same && i <= csr.number_of_rows; ++i)
+    same = (mapped.row_offsets[i] == csr.row_offsets[i]);
+
+  for (edge_t e = 0; same && e < csr.number_of_nonzeros; ++e)
+    same = (mapped.column_indices[e] == csr.column_indices[e]) &&
+           (mapped.get_value(e) ==
+            (with_values ? csr.nonzero_values[e] : (weight_t)1));
 
-  csr.write_binary(outpath);
+  if (!same) {
+    std::cerr << "Verification failed: " << outpath << std::endl;
+    exit(1);
+  }
+
+  std::cout << "verified               = " << outpath << std::endl;
 }
 
 int main(int argc, char** argv) {
   test_mtx2bin(argc, argv);
   return EXIT_SUCCESS;
-}
\ No newline at end of file
+}
@@ -0,0 +1,71 @@
+#include <gunrock/error.hxx>             // error checking
+#include <gunrock/formats/formats.hxx>   // formats (csr, coo)
+#include <gunrock/graph/reorder.hxx>     // vertex reordering
+#include <gunrock/memory.hxx>            // memory space
+#include <gunrock/io/matrix_market.hxx>  // matrix_market support
+
+void test_reorder(int num_arguments, char** argument_array) {
+  if (num_arguments != 2) {
+    std::cerr << "usage: ./test_reorder filename.mtx"
+              << " (e.g. datasets/chesapeake.mtx)" << std::endl;
+    exit(1);
+  }
+
+  std::string filename = argument_array[1];
+
+  using namespace gunrock;
+  using namespace memory;
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  csr.from_coo(mm.load(filename), format::build_properties_t(true /* sort */));
+
+  for (auto algorithm : {graph::reorder::degree, graph::reorder::hub_cluster,
+                         graph::reorder::rcm}) {
+    graph::reorder::permutation_t<vertex_t> p;
+    graph::reorder::report_t report;
+    auto reordered = graph::reorder::reorder(csr, algorithm, p, &report);
+
+    std::cout << "Algorithm = " << algorithm << std::endl;
+    report.print();
+
+    // Every edge (u, v, w) is (p(u), p(v), w) in the reordered graph.
+    bool passed = (reordered.number_of_nonzeros == csr.number_of_nonzeros);
+    for (vertex_t u = 0; passed && u < csr.number_of_rows; ++u) {
+      vertex_t i = p.to_internal(u);
+      passed = (p.to_original(i) == u);
+      for (edge_t e = csr.row_offsets[u]; passed && e < csr.row_offsets[u + 1];
+           ++e) {
+        bool found = false;
+        for (edge_t k = reordered.row_offsets[i];
+             k < reordered.row_offsets[i + 1]; ++k)
+          found = found || ((reordered.column_indices[k] ==
+                             p.to_internal(csr.column_indices[e])) &&
+                            (reordered.nonzero_values[k] ==
+                             csr.nonzero_values[e]));
+        passed = found;
+      }
+    }
+
+    // Per-vertex values round trip.
+    std::vector<vertex_t> ids(csr.number_of_rows), internal(ids.size()),
+        original(ids.size());
+    for (vertex_t v = 0; v < csr.number_of_rows; ++v)
+      ids[v] = v;
+    p.to_internal(ids.data(), internal.data());
+    p.to_original(internal.data(), original.data());
+    passed = passed && (ids == original);
+
+    std::cout << "Permuted: " << (passed ? "PASSED" : "FAILED") << std::endl;
+    if (!passed)
+      exit(1);
+  }
+}
+
+int main(int argc, char** argv) {
+  test_reorder(argc, argv);
+}
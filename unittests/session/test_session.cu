@@ -0,0 +1,168 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include <gunrock/applications/bfs.hxx>   // bfs (run and session)
+#include <gunrock/applications/sssp.hxx>  // sssp (run and session)
+
+// Every heap allocation of the process, including the ones the session does
+// not pool (e.g. the operators' per-thread buffers).
+std::atomic<std::size_t> heap_allocations{0};
+
+void* allocate(std::size_t size, std::size_t alignment) {
+  heap_allocations++;
+  size = std::max<std::size_t>(size, 1);
+  void* p = (alignment > alignof(std::max_align_t))
+                ? std::aligned_alloc(alignment,
+                                     (size + alignment - 1) / alignment *
+                                         alignment)
+                : std::malloc(size);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+
+void* operator new(std::size_t size) {
+  return allocate(size, 0);
+}
+void* operator new[](std::size_t size) {
+  return allocate(size, 0);
+}
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return allocate(size, (std::size_t)alignment);
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return allocate(size, (std::size_t)alignment);
+}
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+void operator delete[](void* p) noexcept {
+  std::free(p);
+}
+void operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+void operator delete[](void* p, std::size_t) noexcept {
+  std::free(p);
+}
+void operator delete(void* p, std::align_val_t) noexcept {
+  std::free(p);
+}
+void operator delete[](void* p, std::align_val_t) noexcept {
+  std::free(p);
+}
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept {
+  std::free(p);
+}
+
+void test_session(int num_arguments, char** argument_array) {
+  if (num_arguments != 2) {
+    std::cerr << "usage: ./test_session filename.mtx"
+              << " (e.g. datasets/chesapeake.mtx)" << std::endl;
+    exit(1);
+  }
+
+  std::string filename = argument_array[1];
+
+  using namespace gunrock;
+  using namespace memory;
+
+  using vertex_t = int;
+  using edge_t = int;
+  using weight_t = float;
+
+  // Disjoint copies of the input graph: a query only visits its own copy, so
+  // the sessions reset a fraction of the graph between queries.
+  constexpr vertex_t copies = 64;
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  auto input = mm.load(filename);
+  vertex_t n = input.number_of_rows;
+  edge_t m = input.number_of_nonzeros;
+
+  format::coo_t<memory_space_t::host, vertex_t, edge_t, weight_t> coo(
+      n * copies, n * copies, m * copies);
+  for (vertex_t c = 0; c < copies; ++c)
+    for (edge_t e = 0; e < m; ++e) {
+      coo.row_indices[c * m + e] = c * n + input.row_indices[e];
+      coo.column_indices[c * m + e] = c * n + input.column_indices[e];
+      coo.nonzero_values[c * m + e] = input.nonzero_values[e];
+    }
+
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  csr.from_coo(coo);
+
+  auto G = graph::build::from_csr<memory_space_t::host, graph::view_t::csr>(
+      csr.number_of_rows,           // rows
+      csr.number_of_columns,        // columns
+      csr.number_of_nonzeros,       // nonzeros
+      csr.row_offsets.data(),       // row_offsets
+      csr.column_indices.data(),    // column_indices
+      csr.nonzero_values.data());   // values
+
+  vertex_t n_vertices = G.get_number_of_vertices();
+  std::vector<vertex_t> sources;
+  for (vertex_t v = 0; v < n_vertices; v += std::max(1, n_vertices / 512))
+    sources.push_back(v);
+
+  std::vector<vertex_t> distances(n_vertices), predecessors(n_vertices);
+  std::vector<vertex_t> expected(n_vertices);
+  std::vector<weight_t> sssp_distances(n_vertices),
+      sssp_expected(n_vertices);
+
+  auto bfs_session =
+      bfs::make_session(G, distances.data(), predecessors.data());
+  auto sssp_session =
+      sssp::make_session(G, sssp_distances.data(), predecessors.data());
+
+  // Two passes over the same sources: the first one warms the buffers up,
+  // the second one must not allocate, neither in the session's counters nor
+  // on the heap.
+  bool passed = true;
+  std::size_t allocations = 0, heap = 0;
+  auto query = [&](auto& session, vertex_t source) {
+    std::size_t before = heap_allocations;
+    session.query(source);
+    return heap_allocations - before;
+  };
+  for (int pass = 0; pass < 2; ++pass) {
+    for (auto source : sources) {
+      std::size_t queries_heap = query(bfs_session, source);
+      bfs::run(G, source, expected.data(), predecessors.data());
+      passed = passed && (distances == expected);
+
+      queries_heap += query(sssp_session, source);
+      sssp::run(G, source, sssp_expected.data(), predecessors.data());
+      passed = passed && (sssp_distances == sssp_expected);
+
+      if (pass == 1) {
+        allocations += bfs_session.get_stats().query_allocations +
+                       sssp_session.get_stats().query_allocations;
+        heap += queries_heap;
+      }
+    }
+  }
+
+  std::cout << "BFS session:" << std::endl;
+  bfs_session.get_stats().print();
+  std::cout << "SSSP session:" << std::endl;
+  sssp_session.get_stats().print();
+
+  std::cout << "Heap allocations (warm queries) = " << heap << std::endl;
+
+  passed = passed && (allocations == 0) && (heap == 0) &&
+           (bfs_session.get_stats().full_resets < sources.size());
+  std::cout << "Session: " << (passed ? "PASSED" : "FAILED") << std::endl;
+  if (!passed)
+    exit(1);
+}
+
+int main(int argc, char** argv) {
+  test_session(argc, argv);
+}
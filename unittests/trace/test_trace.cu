@@ -0,0 +1,109 @@
+#include <vector>
+
+#include <gunrock/applications/bfs.hxx>
+#include <gunrock/framework/trace.hxx>
+
+using namespace gunrock;
+using namespace memory;
+
+using vertex_t = int;
+using edge_t = int;
+using weight_t = float;
+
+/**
+ * @brief Trace a BFS from vertex 0 of `G` and check the records against an
+ * uninstrumented run.
+ */
+template <typename graph_t>
+bool check_trace(graph_t& G, std::string const& output) {
+  vertex_t n_vertices = G.get_number_of_vertices();
+  vertex_t source = 0;
+  std::vector<vertex_t> distances(n_vertices), predecessors(n_vertices);
+  std::vector<vertex_t> expected(n_vertices);
+
+  trace_t trace;
+  enactor_properties_t properties;
+  properties.trace = &trace;
+
+  bfs::run(G, source, distances.data(), predecessors.data(), properties);
+  bfs::run(G, source, expected.data(), predecessors.data());
+  trace.print();
+
+  // Same result with and without instrumentation.
+  bool passed = (distances == expected);
+
+  // One run, one record per iteration, chained frontier sizes.
+  passed = passed && (trace.runs.size() == 1) &&
+           (trace.iterations.size() == (std::size_t)trace.runs[0].iterations);
+  for (std::size_t i = 0; i < trace.iterations.size(); ++i) {
+    auto const& record = trace.iterations[i];
+    passed = passed && (record.iteration == (int)i) &&
+             (record.operators == 2) && (record.swaps == 2);
+    if (i + 1 < trace.iterations.size())
+      passed = passed && (record.output == trace.iterations[i + 1].input);
+  }
+  passed = passed && (trace.iterations.back().output == 0);
+
+  // Every advance expands the input frontier: the first one, the source.
+  passed = passed && (trace.operators.size() == 2 * trace.iterations.size());
+  passed = passed && (std::string(trace.operators[0].name) == "advance") &&
+           (trace.operators[0].input == 1) &&
+           (trace.operators[0].edges ==
+            (std::size_t)G.get_number_of_neighbors(source));
+
+  // Edges visited by the whole run: every reachable vertex is expanded once.
+  std::size_t edges = 0, reached = 0;
+  for (vertex_t v = 0; v < n_vertices; ++v)
+    if (expected[v] != -1) {
+      edges += G.get_number_of_neighbors(v);
+      reached++;
+    }
+  std::size_t traced = 0;
+  for (auto const& record : trace.iterations)
+    traced += record.edges;
+  passed = passed && (traced == edges) && (reached > 1);
+
+  trace.write_chrome_trace(output);
+  return passed;
+}
+
+
+void test_trace(int num_arguments, char** argument_array) {
+  if (num_arguments != 2) {
+    std::cerr << "usage: ./test_trace filename.mtx" << std::endl;
+    exit(1);
+  }
+
+  std::string filename = argument_array[1];
+
+  io::matrix_market_t<vertex_t, edge_t, weight_t> mm;
+  format::csr_t<memory_space_t::host, vertex_t, edge_t, weight_t> csr;
+  csr.from_coo(mm.load(filename));
+
+  auto G = graph::build::from_csr<memory_space_t::host, graph::view_t::csr>(
+      csr.number_of_rows,           // rows
+      csr.number_of_columns,        // columns
+      csr.number_of_nonzeros,       // nonzeros
+      csr.row_offsets.data(),       // row_offsets
+      csr.column_indices.data(),    // column_indices
+      csr.nonzero_values.data());   // values
+
+  // Two components: {0, 1, 2, 3} is reachable from 0, {4, 5, 6} is not.
+  std::vector<edge_t> Ap = {0, 2, 3, 4, 4, 6, 7, 7};
+  std::vector<vertex_t> Aj = {1, 2, 3, 0, 5, 6, 4};
+  std::vector<weight_t> Ax(Aj.size(), 1);
+  auto U = graph::build::from_csr<memory_space_t::host, graph::view_t::csr>(
+      (vertex_t)Ap.size() - 1, (vertex_t)Ap.size() - 1, (edge_t)Aj.size(),
+      Ap.data(), Aj.data(), Ax.data());
+
+  bool passed = check_trace(G, "test_trace.json");
+  passed = check_trace(U, "test_trace_unreachable.json") && passed;
+
+  std::cout << "Trace: " << (passed ? "PASSED" : "FAILED") << std::endl;
+  if (!passed)
+    exit(1);
+}
+
+int main(int argc, char** argv) {
+  test_trace(argc, argv);
+}